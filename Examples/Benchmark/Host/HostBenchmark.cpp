@@ -0,0 +1,858 @@
+// HostBenchmark.cpp
+//
+// Host-native (Linux) counterpart of the Benchmark sketch.
+// Runs the same suites and reports cycles/op, ns/op and throughput percentiles,
+// with optional JSON output to track regressions per commit.
+//
+// Build and run from the repository root:
+//	cmake -S . -B build && cmake --build build --target host_benchmark
+//	./build/Examples/Benchmark/Host/host_benchmark [--json <file>] [--label <text>] [--samples <count>] [--filter <text>]
+// With "--json -" the JSON document goes to stdout and the result table to stderr.
+// Or without CMake:
+//	g++ -std=c++17 -O2 -march=native -Isrc Examples/Benchmark/Host/HostBenchmark.cpp -o host_benchmark
+
+#if !defined(PROGMEM)
+#define PROGMEM
+#endif
+
+#include <IntegerSignal.h>
+#include <IntegerTrigonometry.h>
+#include <IntegerTrigonometry8.h>
+#include <IntegerTrigonometry16.h>
+#include <Trigonometry/Lut/Sine32Lut.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "HostBenchmark.h"
+
+using namespace IntegerSignal;
+using namespace IntegerSignal::Trigonometry;
+using namespace IntegerSignal::FixedPoint::ScalarFraction;
+using namespace IntegerSignal::FixedPoint::FactorScale;
+using HostBenchmark::Keep;
+
+static constexpr uint16_t TestSize = 5000;
+
+static void BenchmarkSine(HostBenchmark::Runner& runner)
+{
+	static constexpr uint32_t Angles = (uint32_t)ANGLE_RANGE + 1;
+
+	runner.Run("Sine", "Sine8", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+				Keep(Sine8(angle_t(i)));
+		});
+	runner.Run("Sine", "Sine8 polynomial", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+				Keep(Polynomial::Sine8(angle_t(i)));
+		});
+	runner.Run("Sine", "Sine16", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+				Keep(Sine16(angle_t(i)));
+		});
+	runner.Run("Sine", "Sine16 polynomial", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+				Keep(Polynomial::Sine16(angle_t(i)));
+		});
+	runner.Run("Sine", "Sine32", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+				Keep(Sine32(angle_t(i)));
+		});
+	runner.Run("Sine", "Sine32 polynomial", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+				Keep(Polynomial::Sine32(angle_t(i)));
+		});
+	runner.Run("Sine", "Sine32 LUT linear", ANGLE_90, []()
+		{
+			for (uint32_t i = 0; i < ANGLE_90; i++)
+				Keep((static_cast<uint32_t>(Lut::Sine16::GetInterpolated(angle_t(i))) + 3) << 14);
+		});
+	runner.Run("Sine", "Sine32 LUT Hermite", ANGLE_90, []()
+		{
+			for (uint32_t i = 0; i < ANGLE_90; i++)
+				Keep(Lut::Sine32::GetInterpolated(angle_t(i)));
+		});
+	runner.Run("Sine", "Sine16 + Cosine16", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+				Keep(Sine16(angle_t(i)) ^ Cosine16(angle_t(i)));
+		});
+	runner.Run("Sine", "SineCosine16", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+			{
+				fraction16_t sine, cosine;
+				SineCosine16(angle_t(i), sine, cosine);
+				Keep(sine ^ cosine);
+			}
+		});
+	runner.Run("Sine", "SineCosine32", Angles, []()
+		{
+			for (uint32_t i = 0; i < Angles; i++)
+			{
+				Fraction32::scalar_t sine, cosine;
+				SineCosine32(angle_t(i), sine, cosine);
+				Keep(sine ^ cosine);
+			}
+		});
+	runner.Run("Sine", "Rotate (int16_t)", Angles, []()
+		{
+			int16_t x = 12345, y = -5432;
+			for (uint32_t i = 0; i < Angles; i++)
+			{
+				Rotate(x, y, angle_t(i));
+			}
+			Keep(x ^ y);
+		});
+	runner.Run("Sine", "Rotate (int32_t)", Angles, []()
+		{
+			int32_t x = 123456789, y = -54321;
+			for (uint32_t i = 0; i < Angles; i++)
+			{
+				Rotate(x, y, angle_t(i));
+			}
+			Keep(x ^ y);
+		});
+
+	static angle_t angles[Angles];
+	static fraction16_t output16[Angles];
+	static Fraction32::scalar_t output32[Angles];
+	for (uint32_t i = 0; i < Angles; i++)
+	{
+		angles[i] = angle_t(i);
+	}
+
+	runner.Run("Sine", "Sine16Batch", Angles, []()
+		{
+			Sine16Batch(angles, output16, Angles);
+			Keep(output16[Angles / 3]);
+		});
+	runner.Run("Sine", "Sine32Batch", Angles, []()
+		{
+			Sine32Batch(angles, output32, Angles);
+			Keep(output32[Angles / 3]);
+		});
+}
+
+static void BenchmarkTangent(HostBenchmark::Runner& runner)
+{
+	static constexpr angle_t AngleRange = GetAngle(45 / 2);
+
+	runner.Run("Tangent", "Tangent8", AngleRange, []()
+		{
+			for (uint16_t i = 0; i < AngleRange; i++)
+				Keep(Tangent8(i));
+		});
+	runner.Run("Tangent", "Tangent8 polynomial", AngleRange, []()
+		{
+			for (uint16_t i = 0; i < AngleRange; i++)
+				Keep(Polynomial::Tangent8(i));
+		});
+	runner.Run("Tangent", "Tangent16", AngleRange, []()
+		{
+			for (uint16_t i = 0; i < AngleRange; i++)
+				Keep(Tangent16(i));
+		});
+	runner.Run("Tangent", "Tangent16 polynomial", AngleRange, []()
+		{
+			for (uint16_t i = 0; i < AngleRange; i++)
+				Keep(Polynomial::Tangent16(i));
+		});
+	runner.Run("Tangent", "Tangent32", AngleRange, []()
+		{
+			for (uint16_t i = 0; i < AngleRange; i++)
+				Keep(Tangent32(i));
+		});
+	runner.Run("Tangent", "Tangent32 polynomial", AngleRange, []()
+		{
+			for (uint16_t i = 0; i < AngleRange; i++)
+				Keep(Polynomial::Tangent32(i));
+		});
+}
+
+static void BenchmarkArcTangent(HostBenchmark::Runner& runner)
+{
+	static int32_t y[TestSize];
+	static int32_t x[TestSize];
+	static angle_t angles[TestSize];
+	static uint32_t magnitudes[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		y[i] = int32_t(i * 2654435761u) >> (i % 24);
+		x[i] = int32_t(i * 40503u * 2654435761u) >> (i % 20);
+	}
+
+	runner.Run("ArcTangent", "atan2 (float)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(atan2f((float)y[i], (float)x[i]));
+		});
+	runner.Run("ArcTangent", "ArcTangent2 (CORDIC)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(ArcTangent2(y[i], x[i]));
+		});
+	runner.Run("ArcTangent", "ArcTangent16 (LUT)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(ArcTangent16(y[i], x[i]));
+		});
+	runner.Run("ArcTangent", "PolarBatch (CORDIC)", TestSize, []()
+		{
+			PolarBatch(y, x, magnitudes, angles, TestSize);
+			Keep(angles[TestSize / 3]);
+		});
+	runner.Run("ArcTangent", "Polar16Batch (LUT)", TestSize, []()
+		{
+			Polar16Batch(y, x, magnitudes, angles, TestSize);
+			Keep(angles[TestSize / 3]);
+		});
+}
+
+static void BenchmarkArcSine(HostBenchmark::Runner& runner)
+{
+	static fraction16_t values[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		values[i] = fraction16_t(((i * 2654435761u) % ((2 * FRACTION16_1X) + 1)) - FRACTION16_1X);
+	}
+
+	runner.Run("ArcSine", "asin (float)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(asinf((float)values[i] / FRACTION16_1X));
+		});
+	runner.Run("ArcSine", "ArcSine16 (LUT search)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+			{
+				const ArcSines::Folded folded(values[i]);
+				Keep(folded.Unfold(ArcSines::Search::Get(folded.Sine)));
+			}
+		});
+	runner.Run("ArcSine", "ArcSine16 (direct LUT)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+			{
+				const ArcSines::Folded folded(values[i]);
+				Keep(folded.Unfold(ArcSines::Direct::Get(folded.Sine)));
+			}
+		});
+	runner.Run("ArcSine", "ArcCosine16", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(ArcCosine16(values[i]));
+		});
+}
+
+static void BenchmarkResize(HostBenchmark::Runner& runner)
+{
+	runner.Run("Resize", "GetFactor8", UINT8_MAX, []()
+		{
+			for (uint8_t i = 1; i < UINT8_MAX; i++)
+				Keep(GetFactor8(uint8_t(UINT8_MAX - i), i));
+		});
+	runner.Run("Resize", "GetFactor16", TestSize, []()
+		{
+			for (uint16_t i = 1; i <= TestSize; i++)
+				Keep(GetFactor16(uint16_t(TestSize - i), i));
+		});
+	runner.Run("Resize", "GetFactor32", TestSize, []()
+		{
+			for (uint32_t i = 1; i <= TestSize; i++)
+				Keep(GetFactor32(uint32_t(TestSize - i), i));
+		});
+	runner.Run("Resize", "Scale8", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(Scale(scale8_t(i), uint8_t(i)));
+		});
+	runner.Run("Resize", "Scale16", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(Scale(scale16_t(i * UINT8_MAX), uint16_t(i)));
+		});
+	runner.Run("Resize", "Scale32", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(Scale(scale32_t(i * UINT16_MAX), i));
+		});
+}
+
+static void BenchmarkUFraction(HostBenchmark::Runner& runner)
+{
+	runner.Run("UFraction", "GetScalarU8", UINT8_MAX, []()
+		{
+			for (uint8_t i = 0; i < UINT8_MAX; i++)
+				Keep(GetScalarU8(i, uint8_t(UINT8_MAX)));
+		});
+	runner.Run("UFraction", "GetScalarU16", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(GetScalarU16(i, TestSize));
+		});
+	runner.Run("UFraction", "GetScalarU32", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(GetScalarU32(i, uint32_t(TestSize)));
+		});
+	runner.Run("UFraction", "Fraction8", UFRACTION8_1X + 1, []()
+		{
+			for (uint16_t i = 0; i <= UFRACTION8_1X; i++)
+				Keep(Fraction(ufraction8_t(i), uint8_t(i)));
+		});
+	runner.Run("UFraction", "Fraction16", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(Fraction(ufraction16_t(i), uint16_t(i)));
+		});
+	runner.Run("UFraction", "Fraction32", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(Fraction(ufraction32_t(i * UINT16_MAX), i));
+		});
+
+	static uint16_t values[TestSize];
+	static uint16_t targets[TestSize];
+	static uint16_t output[TestSize];
+	static ufraction16_t scalars[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		values[i] = uint16_t(i * 2654435761u);
+		targets[i] = uint16_t(~values[i]);
+		scalars[i] = ufraction16_t(i % (UFRACTION16_1X + 1));
+	}
+	runner.Run("UFraction", "FractionBlock16", TestSize, []()
+		{
+			FractionBlock(ufraction16_t(12345), values, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("UFraction", "FractionBlock16 Scalars", TestSize, []()
+		{
+			FractionBlock(scalars, values, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("UFraction", "InterpolateBlock16", TestSize, []()
+		{
+			InterpolateBlock(ufraction16_t(12345), values, targets, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+}
+
+static void BenchmarkRgb8(HostBenchmark::Runner& runner)
+{
+	static Rgb8::color_t from[TestSize];
+	static Rgb8::color_t to[TestSize];
+	static Rgb8::color_t output[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		from[i] = Rgb8::color_t(i * 2654435761u);
+		to[i] = ~from[i];
+	}
+
+	runner.Run("Rgb8", "InterpolateLinear", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				output[i] = Rgb8::ColorInterpolateLinear(from[i], to[i], ufraction16_t(12345));
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("Rgb8", "InterpolateLinearBlock", TestSize, []()
+		{
+			Rgb8::ColorInterpolateLinearBlock(ufraction16_t(12345), from, to, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("Rgb8", "Interpolate", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				output[i] = Rgb8::ColorInterpolate(from[i], to[i], ufraction16_t(12345));
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("Rgb8", "InterpolateBlock", TestSize, []()
+		{
+			Rgb8::ColorInterpolateBlock(ufraction16_t(12345), from, to, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("Rgb8", "AlphaBlend", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				output[i] = Rgb8::ColorAlphaBlend(from[i], to[i]);
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("Rgb8", "AlphaBlendBlock", TestSize, []()
+		{
+			Rgb8::ColorAlphaBlendBlock(from, to, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+
+	static ufraction16_t hue[TestSize];
+	static ufraction16_t saturation[TestSize];
+	static ufraction16_t value[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		hue[i] = ufraction16_t((i * 7919u) % (UFRACTION16_1X + 1));
+		saturation[i] = ufraction16_t((i * 104729u) % (UFRACTION16_1X + 1));
+		value[i] = ufraction16_t((i * 65537u) % (UFRACTION16_1X + 1));
+	}
+	runner.Run("Rgb8", "HsvFraction", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				output[i] = Rgb8::ColorHsvFraction(hue[i], saturation[i], value[i]);
+			Keep(output[TestSize - 1]);
+		});
+	runner.Run("Rgb8", "HsvFractionBlock", TestSize, []()
+		{
+			Rgb8::ColorHsvFractionBlock(hue, saturation, value, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+}
+
+static void BenchmarkMix(HostBenchmark::Runner& runner)
+{
+	runner.Run("Mix", "LinearU8", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(Mix::LinearU8(uint8_t(i), UINT8_MAX, uint8_t(i >> 3)));
+		});
+	runner.Run("Mix", "LinearU16", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(Mix::LinearU16(i, UINT16_MAX, uint8_t(i >> 3)));
+		});
+	runner.Run("Mix", "LinearU32", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(Mix::LinearU32(i, UINT32_MAX, uint8_t(i >> 3)));
+		});
+	runner.Run("Mix", "Power2U8", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(Mix::Power2U8(uint8_t(i), UINT8_MAX));
+		});
+	runner.Run("Mix", "Power2U16", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(Mix::Power2U16(i, UINT16_MAX));
+		});
+	runner.Run("Mix", "Power2U32", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(Mix::Power2U32(i, UINT32_MAX));
+		});
+}
+
+static void BenchmarkScaleUp(HostBenchmark::Runner& runner)
+{
+	runner.Run("ScaleUp", "U8ToU16", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(U8ToU16(uint8_t(i)));
+		});
+	runner.Run("ScaleUp", "U8ToU32", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(U8ToU32(uint8_t(i)));
+		});
+	runner.Run("ScaleUp", "U8ToU64", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(U8ToU64(uint8_t(i)));
+		});
+	runner.Run("ScaleUp", "U16ToU32", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(U16ToU32(i));
+		});
+	runner.Run("ScaleUp", "U32ToU64", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(U32ToU64(i * UINT16_MAX));
+		});
+}
+
+static void BenchmarkSquareRoot(HostBenchmark::Runner& runner)
+{
+	runner.Run("SquareRoot", "SquareRoot16", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(SquareRoot16(uint16_t(i * 13)));
+		});
+	runner.Run("SquareRoot", "SquareRoot32", TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(SquareRoot32(i * 858993u));
+		});
+	runner.Run("SquareRoot", "SquareRoot64", TestSize, []()
+		{
+			for (uint64_t i = 0; i < TestSize; i++)
+				Keep(SquareRoot64(i * 3689348814741910ull));
+		});
+
+	static uint32_t values32[TestSize];
+	static uint16_t roots32[TestSize];
+	static uint64_t values64[TestSize];
+	static uint32_t roots64[TestSize];
+	for (uint32_t i = 0; i < TestSize; i++)
+	{
+		values32[i] = i * 858993u;
+		values64[i] = i * 3689348814741910ull;
+	}
+
+	runner.Run("SquareRoot", "SquareRoot32Batch", TestSize, []()
+		{
+			SquareRoot32Batch(values32, roots32, TestSize);
+			Keep(roots32[TestSize - 1]);
+		});
+	runner.Run("SquareRoot", "SquareRoot64Batch", TestSize, []()
+		{
+			SquareRoot64Batch(values64, roots64, TestSize);
+			Keep(roots64[TestSize - 1]);
+		});
+}
+
+template<typename FilterType, typename value_t>
+static void BenchmarkFilter(HostBenchmark::Runner& runner, const char* name)
+{
+	static FilterType filter{};
+	filter.Clear();
+
+	runner.Run("Filters", name, TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+			{
+				filter.Set(value_t(i * 2654435761u));
+				filter.Step();
+				Keep(filter.Get());
+			}
+		});
+}
+
+template<typename FilterType, typename value_t>
+static void BenchmarkFilterBlock(HostBenchmark::Runner& runner, const char* name)
+{
+	static FilterType filter{};
+	static value_t input[TestSize];
+	static value_t output[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		input[i] = value_t(i * 2654435761u);
+	}
+	filter.Clear();
+
+	runner.Run("Filters", name, TestSize, []()
+		{
+			filter.ProcessBlock(input, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+}
+
+template<typename FilterType, typename value_t>
+static void BenchmarkFir(HostBenchmark::Runner& runner, const char* name)
+{
+	static FilterType filter{};
+	static value_t input[TestSize];
+	static value_t output[TestSize];
+	typename FilterType::tap_t taps[FilterType::TapCount];
+	for (uint16_t i = 0; i < FilterType::TapCount; i++)
+	{
+		// Boxcar taps, unit gain.
+		taps[i] = typename FilterType::tap_t((sizeof(value_t) == 2 ? FRACTION16_1X : FRACTION32_1X) / FilterType::TapCount);
+	}
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		input[i] = value_t(i * 2654435761u);
+	}
+	filter.SetTaps(taps);
+	filter.Clear();
+
+	runner.Run("Filters", name, TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+			{
+				filter.Set(input[i]);
+				filter.Step();
+				Keep(filter.Get());
+			}
+		});
+	runner.Run("Filters", (std::string(name) + " Block").c_str(), TestSize, []()
+		{
+			filter.ProcessBlock(input, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+}
+
+template<typename FilterType, typename value_t, typename Coefficients>
+static void BenchmarkBiquad(HostBenchmark::Runner& runner, const char* name, const Coefficients& coefficients)
+{
+	static FilterType filter{};
+	static value_t input[TestSize];
+	static value_t output[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		input[i] = value_t(i * 2654435761u);
+	}
+	filter.SetCoefficients(coefficients);
+	filter.Clear();
+
+	runner.Run("Filters", name, TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+			{
+				filter.Set(input[i]);
+				filter.Step();
+				Keep(filter.Get());
+			}
+		});
+	runner.Run("Filters", (std::string(name) + " Block").c_str(), TestSize, []()
+		{
+			filter.ProcessBlock(input, output, TestSize);
+			Keep(output[TestSize - 1]);
+		});
+}
+
+static void BenchmarkFilters(HostBenchmark::Runner& runner)
+{
+	static Filters::LowPassU16<> lowPass{};
+	static Filter::IFilter<uint16_t>* virtualFilter = &lowPass;
+	runner.Run("Filters", "IFilter(LowPassU16)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+			{
+				virtualFilter->Set(uint16_t(i * 2654435761u));
+				virtualFilter->Step();
+				Keep(virtualFilter->Get());
+			}
+		});
+
+	BenchmarkFilter<Filters::LowPassU8<>, uint8_t>(runner, "LowPassU8");
+	BenchmarkFilter<Filters::LowPassU16<>, uint16_t>(runner, "LowPassU16");
+	BenchmarkFilter<Filters::LowPassU32<>, uint32_t>(runner, "LowPassU32");
+	BenchmarkFilter<Filters::EmaU8<>, uint8_t>(runner, "EmaU8");
+	BenchmarkFilter<Filters::EmaU16<>, uint16_t>(runner, "EmaU16");
+	BenchmarkFilter<Filters::EmaU32<>, uint32_t>(runner, "EmaU32");
+	BenchmarkFilter<Filters::DemaU8<>, uint8_t>(runner, "DemaU8");
+	BenchmarkFilter<Filters::DemaU16<>, uint16_t>(runner, "DemaU16");
+	BenchmarkFilter<Filters::DemaU32<>, uint32_t>(runner, "DemaU32");
+	BenchmarkFilter<Filters::MovingAverageU16<>, uint16_t>(runner, "MovingAverageU16");
+	BenchmarkFilter<Filters::Static::MedianU16<5>, uint16_t>(runner, "Static::MedianU16<5>");
+	BenchmarkFilter<Filters::Static::MedianU16<9>, uint16_t>(runner, "Static::MedianU16<9>");
+	BenchmarkFilter<Filters::Static::MedianU16<31>, uint16_t>(runner, "Static::MedianU16<31>");
+
+	BenchmarkFilter<Filters::Static::EmaI16<>, int16_t>(runner, "Static::EmaI16");
+	BenchmarkFilter<Filters::EmaI16<>, int16_t>(runner, "EmaI16");
+	BenchmarkFilter<Filters::StrengthU16<Filters::Static::EmaU16<>, 128>, uint16_t>(runner, "Static::StrengthU16");
+	BenchmarkFilter<Filters::StrengthU16<Filters::EmaU16<>, 128>, uint16_t>(runner, "StrengthU16");
+
+	BenchmarkFilterBlock<Filters::LowPassU16<>, uint16_t>(runner, "LowPassU16 Block");
+	BenchmarkFilterBlock<Filters::EmaU16<>, uint16_t>(runner, "EmaU16 Block");
+	BenchmarkFilterBlock<Filters::DemaU16<>, uint16_t>(runner, "DemaU16 Block");
+	BenchmarkFilterBlock<Filters::MovingAverageU16<>, uint16_t>(runner, "MovingAverageU16 Block");
+	BenchmarkFilterBlock<Filters::PipelineU16<Filters::Static::LowPassU16<>, Filters::Static::EmaU16<>, Curves::Power2U16<>>, uint16_t>(runner, "PipelineU16 Block");
+
+	BenchmarkFir<Filters::Static::FirI16<32>, int16_t>(runner, "Static::FirI16<32>");
+	BenchmarkFir<Filters::Static::SymmetricFirI16<32>, int16_t>(runner, "Static::SymmetricFirI16<32>");
+	BenchmarkFir<Filters::Static::FirI32<32>, int32_t>(runner, "Static::FirI32<32>");
+	BenchmarkFir<Filters::Static::SymmetricFirI32<32>, int32_t>(runner, "Static::SymmetricFirI32<32>");
+
+	BenchmarkBiquad<Filters::Static::BiquadCascadeI16<2>, int16_t>(runner, "Static::BiquadCascadeI16<2>",
+		Filters::Biquad::Design::LowPass<Fraction16>(0.1));
+	BenchmarkBiquad<Filters::Static::BiquadCascadeI32<2>, int32_t>(runner, "Static::BiquadCascadeI32<2>",
+		Filters::Biquad::Design::LowPass<Fraction32>(0.1));
+
+	static Filters::FilterBank<Filters::Static::BiquadCascadeI16<2>, 8> biquadBank{};
+	static int16_t interleaved[TestSize * 8];
+	for (uint32_t i = 0; i < TestSize * 8; i++)
+	{
+		interleaved[i] = int16_t(i * 2654435761u);
+	}
+	biquadBank.SetCoefficients(Filters::Biquad::Design::LowPass<Fraction16>(0.1));
+	biquadBank.Clear();
+	runner.Run("Filters", "FilterBank<BiquadCascadeI16<2>, 8> Interleaved", TestSize * 8, []()
+		{
+			biquadBank.ProcessInterleaved(interleaved, interleaved, TestSize);
+			Keep(interleaved[0]);
+		});
+
+	static Filters::CicDecimatorU16<4, 64> cicDecimator{};
+	static uint16_t cicInput[TestSize];
+	static uint16_t cicOutput[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		cicInput[i] = uint16_t(i * 2654435761u);
+	}
+	cicDecimator.Clear();
+	runner.Run("Filters", "CicDecimatorU16<4, 64> Block", TestSize, []()
+		{
+			Keep(cicDecimator.ProcessBlock(cicInput, cicOutput, TestSize));
+		});
+
+	static Filters::CicInterpolatorU16<4, 8> cicInterpolator{};
+	static uint16_t cicInterpolated[TestSize * 8];
+	cicInterpolator.Clear();
+	runner.Run("Filters", "CicInterpolatorU16<4, 8> Block", TestSize * 8, []()
+		{
+			cicInterpolator.ProcessBlock(cicInput, cicInterpolated, TestSize);
+			Keep(cicInterpolated[0]);
+		});
+}
+
+template<typename FftType, typename value_t, uint32_t values>
+static void BenchmarkFft(HostBenchmark::Runner& runner, const char* name)
+{
+	static FftType fft{};
+	static value_t source[values];
+	static value_t data[values];
+	for (uint32_t i = 0; i < values; i++)
+	{
+		source[i] = value_t(i * 2654435761u);
+	}
+
+	runner.Run("Spectrum", name, FftType::Size, []()
+		{
+			for (uint32_t i = 0; i < values; i++)
+				data[i] = source[i];
+			Keep(fft.Forward(data));
+		});
+}
+
+static void BenchmarkSpectrum(HostBenchmark::Runner& runner)
+{
+	BenchmarkFft<Spectrum::FftI16<256>, int16_t, 2 * 256>(runner, "FftI16<256>");
+	BenchmarkFft<Spectrum::FftI16<1024>, int16_t, 2 * 1024>(runner, "FftI16<1024>");
+	BenchmarkFft<Spectrum::FftI32<1024>, int32_t, 2 * 1024>(runner, "FftI32<1024>");
+	BenchmarkFft<Spectrum::RealFftI16<1024>, int16_t, 1024>(runner, "RealFftI16<1024>");
+	BenchmarkFft<Spectrum::RealFftI32<1024>, int32_t, 1024>(runner, "RealFftI32<1024>");
+
+	static int16_t block[TestSize];
+	for (uint16_t i = 0; i < TestSize; i++)
+	{
+		block[i] = int16_t(i * 2654435761u);
+	}
+
+	static Spectrum::GoertzelI16 goertzel(Spectrum::Goertzel::GetAngle(697, 8000));
+	runner.Run("Spectrum", "GoertzelI16 Block", TestSize, []()
+		{
+			goertzel.Clear();
+			goertzel.ProcessBlock(block, TestSize);
+			Keep(goertzel.GetPower());
+		});
+
+	static Spectrum::GoertzelBankI16<8> goertzelBank{};
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		goertzelBank.SetAngle(i, Spectrum::Goertzel::GetAngle(697 + (i * 131), 8000));
+	}
+	runner.Run("Spectrum", "GoertzelBankI16<8> Block", TestSize * 8, []()
+		{
+			goertzelBank.Clear();
+			goertzelBank.ProcessBlock(block, TestSize);
+			Keep(goertzelBank.GetPower(7));
+		});
+}
+
+template<typename CurveType, typename value_t>
+static void BenchmarkCurve(HostBenchmark::Runner& runner, const char* name)
+{
+	runner.Run("Curves", name, TestSize, []()
+		{
+			for (uint32_t i = 0; i < TestSize; i++)
+				Keep(CurveType::Get(value_t(i * 2654435761u)));
+		});
+}
+
+static void BenchmarkCurves(HostBenchmark::Runner& runner)
+{
+	static Curves::Template::Interface<Curves::Template::Curve<uint16_t>, uint16_t> interfaceCurve{};
+	static Curves::ICurve<uint16_t>* virtualCurve = &interfaceCurve;
+	runner.Run("Curves", "ICurve(U16)", TestSize, []()
+		{
+			for (uint16_t i = 0; i < TestSize; i++)
+				Keep(virtualCurve->Get(uint16_t(i * 2654435761u)));
+		});
+
+	BenchmarkCurve<Curves::Template::SignedI16<Curves::Template::Curve<uint16_t>>, int16_t>(runner, "SignedI16");
+	BenchmarkCurve<Curves::LimitU16<0, INT16_MAX>, uint16_t>(runner, "LimitU16");
+	BenchmarkCurve<Curves::ScaleDownU16<INT8_MAX>, uint16_t>(runner, "ScaleDownU16");
+	BenchmarkCurve<Curves::Power2U8<>, uint8_t>(runner, "Power2U8");
+	BenchmarkCurve<Curves::Power2U16<>, uint16_t>(runner, "Power2U16");
+	BenchmarkCurve<Curves::Power2U32<>, uint32_t>(runner, "Power2U32");
+	BenchmarkCurve<Curves::Power3U16<>, uint16_t>(runner, "Power3U16");
+	BenchmarkCurve<Curves::Root2U8<>, uint8_t>(runner, "Root2U8");
+	BenchmarkCurve<Curves::Root2U16<>, uint16_t>(runner, "Root2U16");
+	BenchmarkCurve<Curves::Root2U32<>, uint32_t>(runner, "Root2U32");
+	BenchmarkCurve<Curves::LimitU16<0, INT16_MAX, Curves::Power2U16<>>, uint16_t>(runner, "Power2U16+LimitU16");
+}
+
+int main(int argc, char** argv)
+{
+	HostBenchmark::Runner runner{};
+	const char* jsonPath = nullptr;
+	const char* label = nullptr;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const bool hasValue = (i + 1) < argc;
+		if (hasValue && strcmp(argv[i], "--json") == 0)
+			jsonPath = argv[++i];
+		else if (hasValue && strcmp(argv[i], "--label") == 0)
+			label = argv[++i];
+		else if (hasValue && strcmp(argv[i], "--samples") == 0)
+			runner.Samples = (uint32_t)strtoul(argv[++i], nullptr, 10);
+		else if (hasValue && strcmp(argv[i], "--filter") == 0)
+			runner.Filter = argv[++i];
+		else
+		{
+			fprintf(stderr, "Usage: %s [--json <file>] [--label <text>] [--samples <count>] [--filter <text>]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	if (runner.Samples == 0)
+	{
+		runner.Samples = 1;
+	}
+
+	// Keep stdout a parseable JSON document with --json -.
+	if (jsonPath != nullptr && strcmp(jsonPath, "-") == 0)
+	{
+		runner.Log = stderr;
+	}
+
+	fprintf(runner.Log, "Integer Signals Benchmark (host, %s)\n\n", HostBenchmark::Clock::HasCycles ? "rdtsc" : "clock_gettime");
+
+	BenchmarkSine(runner);
+	BenchmarkTangent(runner);
+	BenchmarkArcTangent(runner);
+	BenchmarkArcSine(runner);
+	BenchmarkResize(runner);
+	BenchmarkUFraction(runner);
+	BenchmarkRgb8(runner);
+	BenchmarkMix(runner);
+	BenchmarkScaleUp(runner);
+	BenchmarkSquareRoot(runner);
+	BenchmarkFilters(runner);
+	BenchmarkSpectrum(runner);
+	BenchmarkCurves(runner);
+
+	if (jsonPath != nullptr)
+	{
+		FILE* file = (strcmp(jsonPath, "-") == 0) ? stdout : fopen(jsonPath, "w");
+		if (file == nullptr)
+		{
+			fprintf(stderr, "Cannot open %s\n", jsonPath);
+			return 1;
+		}
+		runner.WriteJson(file, label);
+		if (file != stdout)
+		{
+			fclose(file);
+		}
+	}
+
+	return 0;
+}
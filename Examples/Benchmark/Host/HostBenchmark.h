@@ -0,0 +1,330 @@
+// HostBenchmark.h
+
+#ifndef _HOST_BENCHMARK_h
+#define _HOST_BENCHMARK_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HOST_BENCHMARK_RDTSC
+#endif
+
+namespace HostBenchmark
+{
+	/// <summary>
+	/// Keeps a value alive without forcing it to memory, so the measured work is not optimized away.
+	/// </summary>
+	template<typename T>
+	static inline void Keep(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "g"(value) : "memory");
+#else
+		static volatile T Sink;
+		Sink = value;
+#endif
+	}
+
+	/// <summary>
+	/// Monotonic wall clock and, where available, the CPU time stamp counter.
+	/// </summary>
+	struct Clock
+	{
+#if defined(HOST_BENCHMARK_RDTSC)
+		static constexpr bool HasCycles = true;
+#else
+		static constexpr bool HasCycles = false;
+#endif
+
+		static uint64_t Nanoseconds()
+		{
+			timespec now;
+			clock_gettime(CLOCK_MONOTONIC, &now);
+
+			return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+		}
+
+		static uint64_t Cycles()
+		{
+#if defined(HOST_BENCHMARK_RDTSC)
+			return __rdtsc();
+#else
+			return 0;
+#endif
+		}
+	};
+
+	/// <summary>
+	/// Per-operation distribution over all samples.
+	/// </summary>
+	struct Distribution
+	{
+		double Min = 0;
+		double P50 = 0;
+		double P90 = 0;
+		double P99 = 0;
+		double Max = 0;
+		double Mean = 0;
+
+		/// <summary>
+		/// Nearest-rank percentiles.
+		/// </summary>
+		/// <param name="values">Samples, sorted in place.</param>
+		static Distribution From(std::vector<double>& values)
+		{
+			Distribution distribution{};
+			if (values.empty())
+			{
+				return distribution;
+			}
+
+			std::sort(values.begin(), values.end());
+
+			double sum = 0;
+			for (const double value : values)
+			{
+				sum += value;
+			}
+
+			distribution.Min = values.front();
+			distribution.P50 = Percentile(values, 50);
+			distribution.P90 = Percentile(values, 90);
+			distribution.P99 = Percentile(values, 99);
+			distribution.Max = values.back();
+			distribution.Mean = sum / (double)values.size();
+
+			return distribution;
+		}
+
+	private:
+		static double Percentile(const std::vector<double>& sorted, const uint8_t percent)
+		{
+			const size_t rank = ((sorted.size() * percent) + 99) / 100;
+
+			return sorted[(rank > 0) ? (rank - 1) : 0];
+		}
+	};
+
+	struct Result
+	{
+		std::string Suite;
+		std::string Name;
+		uint64_t OperationsPerSample = 0;
+		Distribution Nanoseconds{};
+		Distribution Cycles{};
+	};
+
+	/// <summary>
+	/// Runs each benchmark in repeated samples and collects cycles/op, ns/op and throughput.
+	/// Each sample repeats the workload until it spans at least SampleNanoseconds,
+	/// to stay well above the clock resolution.
+	/// </summary>
+	class Runner
+	{
+	public:
+		uint32_t Samples = 31;
+		uint64_t SampleNanoseconds = 200000;
+		const char* Filter = nullptr;
+
+		/// <summary>
+		/// Human-readable results, moved to stderr when the JSON document goes to stdout.
+		/// </summary>
+		FILE* Log = stdout;
+
+	private:
+		std::vector<Result> Results;
+
+	public:
+		/// <summary>
+		/// Measures a workload.
+		/// </summary>
+		/// <param name="suite">Suite name (e.g. "Sine").</param>
+		/// <param name="name">Benchmark name (e.g. "Sine16").</param>
+		/// <param name="operations">Number of operations performed by one workload call.</param>
+		/// <param name="workload">Callable that performs the operations.</param>
+		template<typename Workload>
+		void Run(const char* suite, const char* name, const uint32_t operations, Workload&& workload)
+		{
+			if (Filter != nullptr
+				&& strstr(suite, Filter) == nullptr
+				&& strstr(name, Filter) == nullptr)
+			{
+				return;
+			}
+
+			// Warm up caches and branch predictors, then calibrate the repetitions.
+			workload();
+			uint32_t repetitions = 1;
+			while (true)
+			{
+				const uint64_t start = Clock::Nanoseconds();
+				for (uint32_t r = 0; r < repetitions; r++)
+				{
+					workload();
+				}
+				const uint64_t duration = Clock::Nanoseconds() - start;
+
+				if (duration >= SampleNanoseconds || repetitions >= (UINT32_MAX / 2))
+				{
+					break;
+				}
+				repetitions *= 2;
+			}
+
+			std::vector<double> nanoseconds;
+			std::vector<double> cycles;
+			nanoseconds.reserve(Samples);
+			cycles.reserve(Samples);
+
+			const double sampleOperations = (double)operations * repetitions;
+			for (uint32_t s = 0; s < Samples; s++)
+			{
+				const uint64_t startCycles = Clock::Cycles();
+				const uint64_t start = Clock::Nanoseconds();
+				for (uint32_t r = 0; r < repetitions; r++)
+				{
+					workload();
+				}
+				const uint64_t duration = Clock::Nanoseconds() - start;
+				const uint64_t durationCycles = Clock::Cycles() - startCycles;
+
+				nanoseconds.push_back((double)duration / sampleOperations);
+				cycles.push_back((double)durationCycles / sampleOperations);
+			}
+
+			Result result{};
+			result.Suite = suite;
+			result.Name = name;
+			result.OperationsPerSample = (uint64_t)operations * repetitions;
+			result.Nanoseconds = Distribution::From(nanoseconds);
+			result.Cycles = Distribution::From(cycles);
+
+			PrintResult(result);
+			Results.push_back(result);
+		}
+
+		const std::vector<Result>& GetResults() const
+		{
+			return Results;
+		}
+
+		/// <summary>
+		/// Writes all results as a single JSON document.
+		/// </summary>
+		/// <param name="file">Output stream.</param>
+		/// <param name="label">Free text run label (e.g. commit id), may be null.</param>
+		void WriteJson(FILE* file, const char* label) const
+		{
+			fprintf(file, "{\n");
+			fprintf(file, "\t\"library\": \"IntegerSignal\",\n");
+			fprintf(file, "\t\"label\": ");
+			WriteJsonString(file, (label != nullptr) ? label : "");
+			fprintf(file, ",\n");
+			fprintf(file, "\t\"timer\": \"%s\",\n", Clock::HasCycles ? "rdtsc+clock_gettime" : "clock_gettime");
+			fprintf(file, "\t\"samples\": %u,\n", Samples);
+			fprintf(file, "\t\"results\": [\n");
+			for (size_t i = 0; i < Results.size(); i++)
+			{
+				const Result& result = Results[i];
+				fprintf(file, "\t\t{\n");
+				fprintf(file, "\t\t\t\"suite\": ");
+				WriteJsonString(file, result.Suite.c_str());
+				fprintf(file, ",\n\t\t\t\"name\": ");
+				WriteJsonString(file, result.Name.c_str());
+				fprintf(file, ",\n");
+				fprintf(file, "\t\t\t\"operations_per_sample\": %llu,\n", (unsigned long long)result.OperationsPerSample);
+				fprintf(file, "\t\t\t\"ops_per_second\": %.1f,\n", GetThroughput(result));
+				fprintf(file, "\t\t\t\"ns_per_op\": ");
+				WriteJson(file, result.Nanoseconds);
+				fprintf(file, ",\n\t\t\t\"cycles_per_op\": ");
+				if (Clock::HasCycles)
+				{
+					WriteJson(file, result.Cycles);
+				}
+				else
+				{
+					fprintf(file, "null");
+				}
+				fprintf(file, "\n\t\t}%s\n", (i + 1 < Results.size()) ? "," : "");
+			}
+			fprintf(file, "\t]\n");
+			fprintf(file, "}\n");
+		}
+
+	private:
+		/// <summary>
+		/// Median throughput in operations per second.
+		/// </summary>
+		static double GetThroughput(const Result& result)
+		{
+			return (result.Nanoseconds.P50 > 0) ? (1e9 / result.Nanoseconds.P50) : 0;
+		}
+
+		/// <summary>
+		/// Writes a quoted JSON string, escaping quotes, backslashes and control characters.
+		/// </summary>
+		static void WriteJsonString(FILE* file, const char* text)
+		{
+			fputc('"', file);
+			for (const char* c = text; *c != '\0'; c++)
+			{
+				const unsigned char character = (unsigned char)*c;
+				switch (character)
+				{
+				case '"':
+					fputs("\\\"", file);
+					break;
+				case '\\':
+					fputs("\\\\", file);
+					break;
+				case '\n':
+					fputs("\\n", file);
+					break;
+				case '\r':
+					fputs("\\r", file);
+					break;
+				case '\t':
+					fputs("\\t", file);
+					break;
+				default:
+					if (character < 0x20)
+					{
+						fprintf(file, "\\u%04x", character);
+					}
+					else
+					{
+						fputc(character, file);
+					}
+					break;
+				}
+			}
+			fputc('"', file);
+		}
+
+		static void WriteJson(FILE* file, const Distribution& distribution)
+		{
+			fprintf(file, "{ \"min\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f, \"mean\": %.4f }",
+				distribution.Min, distribution.P50, distribution.P90, distribution.P99, distribution.Max, distribution.Mean);
+		}
+
+		void PrintResult(const Result& result) const
+		{
+			fprintf(Log, "%-12s %-24s %10.3f ns/op (p90 %8.3f, p99 %8.3f)", result.Suite.c_str(), result.Name.c_str(),
+				result.Nanoseconds.P50, result.Nanoseconds.P90, result.Nanoseconds.P99);
+			if (Clock::HasCycles)
+			{
+				fprintf(Log, " %10.2f cycles/op", result.Cycles.P50);
+			}
+			fprintf(Log, " %12.0f op/s\n", GetThroughput(result));
+		}
+	};
+}
+#endif
@@ -0,0 +1,66 @@
+// Arduino.h
+//
+// Minimal host (Linux) stand-in for the Arduino core, just enough to build and run the UnitTests sketch.
+// Serial prints to stdout, flash storage is plain memory.
+
+#ifndef _HOST_ARDUINO_h
+#define _HOST_ARDUINO_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <math.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+#define pgm_read_dword(address) (*(const uint32_t*)(address))
+
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(text))
+
+using std::min;
+using std::max;
+
+template<typename T>
+static inline T constrain(const T value, const T low, const T high)
+{
+	return (value < low) ? low : ((value > high) ? high : value);
+}
+
+static inline void delay(const uint32_t) {}
+
+class HostSerial
+{
+public:
+	void begin(const uint32_t) {}
+	void flush() { fflush(stdout); }
+	explicit operator bool() const { return true; }
+
+	void print(const __FlashStringHelper* text) { fputs(reinterpret_cast<const char*>(text), stdout); }
+	void print(const char* text) { fputs(text, stdout); }
+	void print(const char value) { fputc(value, stdout); }
+	void print(const double value, const int digits = 2) { printf("%.*f", digits, value); }
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+	void print(const T value) { printf("%lld", (long long)value); }
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>
+	void print(const T value) { printf("%llu", (unsigned long long)value); }
+
+	void println() { fputc('\n', stdout); }
+
+	template<typename... Args>
+	void println(const Args... args)
+	{
+		print(args...);
+		println();
+	}
+};
+
+static HostSerial Serial;
+
+#endif
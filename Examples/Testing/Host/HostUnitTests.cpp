@@ -0,0 +1,58 @@
+// HostUnitTests.cpp
+//
+// Host-native (Linux) runner for the unit test suites that cover the accelerated block kernels.
+// Built with the host's vector extensions (-march=native) and without INTEGER_SIGNAL_DISABLE_ACCELERATION,
+// so the AVX2 paths are checked bit-exact against their scalar references.
+// The sse2 and neon variants build the same suites for baseline x86-64 and over the emulated arm_neon.h.
+// The UnitTests sketch keeps acceleration disabled and covers the portable paths.
+//
+// Build and run from the repository root:
+//	cmake -S . -B build && cmake --build build && ctest --test-dir build --output-on-failure
+
+#include <Arduino.h>
+#include <IntegerSignal.h>
+#include <IntegerTrigonometry16.h>
+
+#include "SquareRootTest.h"
+#include "SineTest.h"
+#include "FixedPointFractionTest.h"
+#include "Rgb8Test.h"
+#include "HsvTest.h"
+#include "FirFilterTest.h"
+
+int main()
+{
+	static constexpr uint32_t MaxIterations = 1000;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+	Serial.println(F("Integer Signal Unit Testing (host, AVX2)"));
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+	Serial.println(F("Integer Signal Unit Testing (host, NEON)"));
+#elif defined(__SSE2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+	Serial.println(F("Integer Signal Unit Testing (host, SSE2)"));
+#else
+	Serial.println(F("Integer Signal Unit Testing (host, portable)"));
+#endif
+	Serial.println();
+
+	bool pass = true;
+
+	pass &= IntegerSignal::SquareRoot::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Trigonometry::Sine::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::FixedPoint::ScalarFraction::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Rgb8::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Hsv::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Fir::Test::RunTests<MaxIterations>();
+
+	Serial.println();
+	if (pass)
+	{
+		Serial.println(F("Integer Signal host tests PASSED."));
+	}
+	else
+	{
+		Serial.println(F("Integer Signal host tests FAILED."));
+	}
+
+	return pass ? 0 : 1;
+}
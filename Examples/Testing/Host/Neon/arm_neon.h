@@ -0,0 +1,273 @@
+// arm_neon.h
+//
+// Host (x86-64) stand-in for the ARM NEON intrinsics used by the library kernels, lane by lane in plain C++.
+// Lets the NEON paths build and run bit-exact against their scalar references without an AArch64 toolchain.
+// Only the intrinsics the kernels use are provided; the host_unit_tests_neon target defines __ARM_NEON.
+
+#ifndef _HOST_ARM_NEON_h
+#define _HOST_ARM_NEON_h
+
+#include <stdint.h>
+#include <string.h>
+
+template<typename T, int N>
+struct HostNeonVector
+{
+	T Lane[N];
+};
+
+typedef HostNeonVector<uint8_t, 8> uint8x8_t;
+typedef HostNeonVector<uint16_t, 4> uint16x4_t;
+typedef HostNeonVector<int16_t, 4> int16x4_t;
+typedef HostNeonVector<uint16_t, 8> uint16x8_t;
+typedef HostNeonVector<int16_t, 8> int16x8_t;
+typedef HostNeonVector<uint32_t, 2> uint32x2_t;
+typedef HostNeonVector<int32_t, 2> int32x2_t;
+typedef HostNeonVector<uint32_t, 4> uint32x4_t;
+typedef HostNeonVector<int32_t, 4> int32x4_t;
+typedef HostNeonVector<uint64_t, 2> uint64x2_t;
+typedef HostNeonVector<int64_t, 2> int64x2_t;
+
+struct uint8x8x4_t
+{
+	uint8x8_t val[4];
+};
+
+namespace HostNeon
+{
+	template<typename V, typename T>
+	static inline V Load(const T* source)
+	{
+		V result;
+		memcpy(result.Lane, source, sizeof(result.Lane));
+		return result;
+	}
+
+	template<typename T, int N>
+	static inline void Store(T* target, const HostNeonVector<T, N> value)
+	{
+		memcpy(target, value.Lane, sizeof(value.Lane));
+	}
+
+	template<typename V, typename T>
+	static inline V Duplicate(const T value)
+	{
+		V result;
+		for (auto& lane : result.Lane) lane = value;
+		return result;
+	}
+
+	template<typename To, typename T, int N>
+	static inline To Reinterpret(const HostNeonVector<T, N> value)
+	{
+		static_assert(sizeof(To) == sizeof(value), "NEON reinterpret size mismatch");
+		To result;
+		memcpy(&result, &value, sizeof(result));
+		return result;
+	}
+
+	template<typename T, int N>
+	static inline HostNeonVector<T, N / 2> Low(const HostNeonVector<T, N> value)
+	{
+		HostNeonVector<T, N / 2> result;
+		for (int i = 0; i < N / 2; i++) result.Lane[i] = value.Lane[i];
+		return result;
+	}
+
+	template<typename T, int N>
+	static inline HostNeonVector<T, N / 2> High(const HostNeonVector<T, N> value)
+	{
+		HostNeonVector<T, N / 2> result;
+		for (int i = 0; i < N / 2; i++) result.Lane[i] = value.Lane[(N / 2) + i];
+		return result;
+	}
+
+	template<typename T, int N>
+	static inline HostNeonVector<T, N * 2> Combine(const HostNeonVector<T, N> low, const HostNeonVector<T, N> high)
+	{
+		HostNeonVector<T, N * 2> result;
+		for (int i = 0; i < N; i++)
+		{
+			result.Lane[i] = low.Lane[i];
+			result.Lane[N + i] = high.Lane[i];
+		}
+		return result;
+	}
+
+	template<typename T, int N, typename F>
+	static inline HostNeonVector<T, N> Map(const HostNeonVector<T, N> a, const HostNeonVector<T, N> b, F function)
+	{
+		HostNeonVector<T, N> result;
+		for (int i = 0; i < N; i++) result.Lane[i] = T(function(a.Lane[i], b.Lane[i]));
+		return result;
+	}
+
+	// Widening lane operation, wide_t lanes from the T lanes of a and b.
+	template<typename wide_t, typename T, int N, typename F>
+	static inline HostNeonVector<wide_t, N> Widen(const HostNeonVector<T, N> a, const HostNeonVector<T, N> b, F function)
+	{
+		HostNeonVector<wide_t, N> result;
+		for (int i = 0; i < N; i++) result.Lane[i] = wide_t(function(wide_t(a.Lane[i]), wide_t(b.Lane[i])));
+		return result;
+	}
+
+	template<typename wide_t, typename T, int N>
+	static inline HostNeonVector<wide_t, N> Extend(const HostNeonVector<T, N> value)
+	{
+		HostNeonVector<wide_t, N> result;
+		for (int i = 0; i < N; i++) result.Lane[i] = wide_t(value.Lane[i]);
+		return result;
+	}
+
+	template<typename narrow_t, typename T, int N>
+	static inline HostNeonVector<narrow_t, N> NarrowShift(const HostNeonVector<T, N> value, const int shifts)
+	{
+		HostNeonVector<narrow_t, N> result;
+		for (int i = 0; i < N; i++) result.Lane[i] = narrow_t(value.Lane[i] >> shifts);
+		return result;
+	}
+
+	template<typename T, int N>
+	static inline HostNeonVector<T, N> Compare(const HostNeonVector<T, N> a, const HostNeonVector<T, N> b, const bool greater)
+	{
+		HostNeonVector<T, N> result;
+		for (int i = 0; i < N; i++) result.Lane[i] = ((greater ? (a.Lane[i] > b.Lane[i]) : (a.Lane[i] == b.Lane[i]))) ? T(~T(0)) : T(0);
+		return result;
+	}
+
+	template<typename T, int N>
+	static inline HostNeonVector<T, N> Shift(const HostNeonVector<T, N> value, const int shifts)
+	{
+		HostNeonVector<T, N> result;
+		for (int i = 0; i < N; i++) result.Lane[i] = T(value.Lane[i] >> shifts); // Arithmetic for signed lanes.
+		return result;
+	}
+}
+
+// Loads, stores and lane setup.
+static inline uint16x8_t vld1q_u16(const uint16_t* source) { return HostNeon::Load<uint16x8_t>(source); }
+static inline int16x8_t vld1q_s16(const int16_t* source) { return HostNeon::Load<int16x8_t>(source); }
+static inline uint32x4_t vld1q_u32(const uint32_t* source) { return HostNeon::Load<uint32x4_t>(source); }
+static inline int16x4_t vld1_s16(const int16_t* source) { return HostNeon::Load<int16x4_t>(source); }
+static inline int32x4_t vld1q_s32(const int32_t* source) { return HostNeon::Load<int32x4_t>(source); }
+
+// Interleaved 4-element structures, element j of structure i at source[(4 * i) + j].
+static inline uint8x8x4_t vld4_u8(const uint8_t* source)
+{
+	uint8x8x4_t result;
+	for (int i = 0; i < 8; i++)
+		for (int j = 0; j < 4; j++) result.val[j].Lane[i] = source[(4 * i) + j];
+	return result;
+}
+
+static inline void vst4_u8(uint8_t* target, const uint8x8x4_t value)
+{
+	for (int i = 0; i < 8; i++)
+		for (int j = 0; j < 4; j++) target[(4 * i) + j] = value.val[j].Lane[i];
+}
+
+static inline void vst1q_u16(uint16_t* target, const uint16x8_t value) { HostNeon::Store(target, value); }
+static inline void vst1q_s16(int16_t* target, const int16x8_t value) { HostNeon::Store(target, value); }
+static inline void vst1q_u32(uint32_t* target, const uint32x4_t value) { HostNeon::Store(target, value); }
+static inline void vst1q_s32(int32_t* target, const int32x4_t value) { HostNeon::Store(target, value); }
+
+static inline uint8x8_t vdup_n_u8(const uint8_t value) { return HostNeon::Duplicate<uint8x8_t>(value); }
+static inline uint16x8_t vdupq_n_u16(const uint16_t value) { return HostNeon::Duplicate<uint16x8_t>(value); }
+static inline int16x8_t vdupq_n_s16(const int16_t value) { return HostNeon::Duplicate<int16x8_t>(value); }
+static inline uint32x4_t vdupq_n_u32(const uint32_t value) { return HostNeon::Duplicate<uint32x4_t>(value); }
+static inline int32x4_t vdupq_n_s32(const int32_t value) { return HostNeon::Duplicate<int32x4_t>(value); }
+static inline int64x2_t vdupq_n_s64(const int64_t value) { return HostNeon::Duplicate<int64x2_t>(value); }
+
+static inline uint16x4_t vget_low_u16(const uint16x8_t value) { return HostNeon::Low(value); }
+static inline uint16x4_t vget_high_u16(const uint16x8_t value) { return HostNeon::High(value); }
+static inline int16x4_t vget_low_s16(const int16x8_t value) { return HostNeon::Low(value); }
+static inline int16x4_t vget_high_s16(const int16x8_t value) { return HostNeon::High(value); }
+static inline uint32x2_t vget_low_u32(const uint32x4_t value) { return HostNeon::Low(value); }
+static inline uint32x2_t vget_high_u32(const uint32x4_t value) { return HostNeon::High(value); }
+static inline int32x2_t vget_low_s32(const int32x4_t value) { return HostNeon::Low(value); }
+static inline int32x2_t vget_high_s32(const int32x4_t value) { return HostNeon::High(value); }
+
+static inline uint16x8_t vcombine_u16(const uint16x4_t low, const uint16x4_t high) { return HostNeon::Combine(low, high); }
+static inline int16x8_t vcombine_s16(const int16x4_t low, const int16x4_t high) { return HostNeon::Combine(low, high); }
+static inline uint32x4_t vcombine_u32(const uint32x2_t low, const uint32x2_t high) { return HostNeon::Combine(low, high); }
+static inline int32x4_t vcombine_s32(const int32x2_t low, const int32x2_t high) { return HostNeon::Combine(low, high); }
+
+static inline int16x4_t vreinterpret_s16_u16(const uint16x4_t value) { return HostNeon::Reinterpret<int16x4_t>(value); }
+static inline int16x8_t vreinterpretq_s16_u16(const uint16x8_t value) { return HostNeon::Reinterpret<int16x8_t>(value); }
+static inline uint16x8_t vreinterpretq_u16_s16(const int16x8_t value) { return HostNeon::Reinterpret<uint16x8_t>(value); }
+static inline int32x4_t vreinterpretq_s32_u32(const uint32x4_t value) { return HostNeon::Reinterpret<int32x4_t>(value); }
+static inline uint32x4_t vreinterpretq_u32_s32(const int32x4_t value) { return HostNeon::Reinterpret<uint32x4_t>(value); }
+
+// Lane-wise arithmetic.
+static inline uint16x8_t vaddq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint32_t x, uint32_t y) { return x + y; }); }
+static inline uint16x8_t vsubq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint32_t x, uint32_t y) { return x - y; }); }
+static inline uint16x8_t vminq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint16_t x, uint16_t y) { return (x < y) ? x : y; }); }
+static inline uint16x8_t vhaddq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint32_t x, uint32_t y) { return (x + y) >> 1; }); }
+static inline uint16x8_t vandq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint16_t x, uint16_t y) { return x & y; }); }
+static inline uint16x8_t vorrq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint16_t x, uint16_t y) { return x | y; }); }
+static inline uint16x8_t veorq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint16_t x, uint16_t y) { return x ^ y; }); }
+static inline uint16x8_t vbicq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint16_t x, uint16_t y) { return x & ~y; }); }
+static inline uint16x8_t vceqq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Compare(a, b, false); }
+static inline uint16x8_t vcgtq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Compare(a, b, true); }
+static inline uint16x8_t vcleq_u16(const uint16x8_t a, const uint16x8_t b) { return vorrq_u16(vcgtq_u16(b, a), vceqq_u16(a, b)); }
+static inline uint16x8_t vbslq_u16(const uint16x8_t mask, const uint16x8_t a, const uint16x8_t b) { return vorrq_u16(vandq_u16(mask, a), vbicq_u16(b, mask)); }
+static inline uint16x8_t vmulq_u16(const uint16x8_t a, const uint16x8_t b) { return HostNeon::Map(a, b, [](uint32_t x, uint32_t y) { return x * y; }); }
+static inline uint32x4_t vaddq_u32(const uint32x4_t a, const uint32x4_t b) { return HostNeon::Map(a, b, [](uint32_t x, uint32_t y) { return x + y; }); }
+static inline uint32x4_t vsubq_u32(const uint32x4_t a, const uint32x4_t b) { return HostNeon::Map(a, b, [](uint32_t x, uint32_t y) { return x - y; }); }
+static inline int32x4_t vaddq_s32(const int32x4_t a, const int32x4_t b) { return HostNeon::Map(a, b, [](int64_t x, int64_t y) { return x + y; }); }
+static inline int32x4_t vandq_s32(const int32x4_t a, const int32x4_t b) { return HostNeon::Map(a, b, [](int32_t x, int32_t y) { return x & y; }); }
+static inline int64x2_t vaddq_s64(const int64x2_t a, const int64x2_t b) { return HostNeon::Map(a, b, [](uint64_t x, uint64_t y) { return x + y; }); }
+static inline int64x2_t vandq_s64(const int64x2_t a, const int64x2_t b) { return HostNeon::Map(a, b, [](int64_t x, int64_t y) { return x & y; }); }
+static inline uint32x4_t vmulq_u32(const uint32x4_t a, const uint32x4_t b) { return HostNeon::Map(a, b, [](uint64_t x, uint64_t y) { return x * y; }); }
+static inline int32x4_t vmulq_s32(const int32x4_t a, const int32x4_t b) { return HostNeon::Map(a, b, [](int64_t x, int64_t y) { return x * y; }); }
+static inline uint32x4_t vmlaq_u32(const uint32x4_t a, const uint32x4_t b, const uint32x4_t c) { return vaddq_u32(a, vmulq_u32(b, c)); }
+static inline int32x4_t vmlaq_s32(const int32x4_t a, const int32x4_t b, const int32x4_t c) { return vaddq_s32(a, vmulq_s32(b, c)); }
+static inline int32x2_t vadd_s32(const int32x2_t a, const int32x2_t b) { return HostNeon::Map(a, b, [](int64_t x, int64_t y) { return x + y; }); }
+static inline int32x2_t vpadd_s32(const int32x2_t a, const int32x2_t b)
+{
+	int32x2_t result;
+	result.Lane[0] = int32_t(uint32_t(a.Lane[0]) + uint32_t(a.Lane[1]));
+	result.Lane[1] = int32_t(uint32_t(b.Lane[0]) + uint32_t(b.Lane[1]));
+	return result;
+}
+static inline int16x4_t vrev64_s16(const int16x4_t value)
+{
+	int16x4_t result;
+	for (int i = 0; i < 4; i++) result.Lane[i] = value.Lane[3 - i];
+	return result;
+}
+
+// Lane reads.
+#define vget_lane_s32(value, lane) ((value).Lane[(lane)])
+#define vgetq_lane_s64(value, lane) ((value).Lane[(lane)])
+
+// Shifts by a constant.
+#define vshlq_n_u16(value, shifts) HostNeon::Map((value), (value), [](uint32_t x, uint32_t) { return x << (shifts); })
+#define vshrq_n_u16(value, shifts) HostNeon::Shift((value), (shifts))
+#define vshrq_n_s16(value, shifts) HostNeon::Shift((value), (shifts))
+#define vshrq_n_s32(value, shifts) HostNeon::Shift((value), (shifts))
+#define vshrq_n_s64(value, shifts) HostNeon::Shift((value), (shifts))
+#define vshrn_n_u32(value, shifts) HostNeon::NarrowShift<uint16_t>((value), (shifts))
+#define vshrn_n_s32(value, shifts) HostNeon::NarrowShift<int16_t>((value), (shifts))
+#define vshrn_n_u64(value, shifts) HostNeon::NarrowShift<uint32_t>((value), (shifts))
+#define vshrn_n_s64(value, shifts) HostNeon::NarrowShift<int32_t>((value), (shifts))
+
+// Widening and narrowing.
+static inline uint16x8_t vmovl_u8(const uint8x8_t value) { return HostNeon::Extend<uint16_t>(value); }
+static inline uint8x8_t vqmovn_u16(const uint16x8_t value)
+{
+	uint8x8_t result;
+	for (int i = 0; i < 8; i++) result.Lane[i] = (value.Lane[i] > UINT8_MAX) ? UINT8_MAX : uint8_t(value.Lane[i]);
+	return result;
+}
+static inline uint32x4_t vmovl_u16(const uint16x4_t value) { return HostNeon::Extend<uint32_t>(value); }
+static inline int32x4_t vmovl_s16(const int16x4_t value) { return HostNeon::Extend<int32_t>(value); }
+static inline uint32x4_t vmull_u16(const uint16x4_t a, const uint16x4_t b) { return HostNeon::Widen<uint32_t>(a, b, [](uint32_t x, uint32_t y) { return x * y; }); }
+static inline int32x4_t vmull_s16(const int16x4_t a, const int16x4_t b) { return HostNeon::Widen<int32_t>(a, b, [](int32_t x, int32_t y) { return x * y; }); }
+static inline uint64x2_t vmull_u32(const uint32x2_t a, const uint32x2_t b) { return HostNeon::Widen<uint64_t>(a, b, [](uint64_t x, uint64_t y) { return x * y; }); }
+static inline int64x2_t vmull_s32(const int32x2_t a, const int32x2_t b) { return HostNeon::Widen<int64_t>(a, b, [](int64_t x, int64_t y) { return x * y; }); }
+static inline int32x4_t vaddl_s16(const int16x4_t a, const int16x4_t b) { return HostNeon::Widen<int32_t>(a, b, [](int32_t x, int32_t y) { return x + y; }); }
+static inline int32x4_t vmlal_s16(const int32x4_t a, const int16x4_t b, const int16x4_t c) { return vaddq_s32(a, vmull_s16(b, c)); }
+static inline int64x2_t vmlal_s32(const int64x2_t a, const int32x2_t b, const int32x2_t c) { return vaddq_s64(a, vmull_s32(b, c)); }
+
+#endif
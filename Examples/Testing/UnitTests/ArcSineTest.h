@@ -0,0 +1,102 @@
+#ifndef _ARC_SINE_TEST_h
+#define _ARC_SINE_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerTrigonometry16.h>
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace ArcSine
+		{
+			// ArcSine16 and ArcCosine16 must match asin and acos for every fraction16_t,
+			// with both the Sine16 LUT search and the direct ArcSine16 LUT.
+			namespace Test
+			{
+				// Distance to the rounded reference angle, in angle_t units, modular.
+				static uint16_t GetAngleError(const angle_t angle, const double reference)
+				{
+					const double pi = 3.14159265358979323846;
+					const double scaled = reference * 65536.0 / (2.0 * pi);
+					const angle_t expected = (angle_t)(int32_t)floor(scaled + 0.5);
+					const angle_t difference = angle - expected;
+
+					return (difference > ANGLE_180) ? (angle_t)(0 - difference) : difference;
+				}
+
+				static bool Report(const char* name, const uint16_t error, const uint16_t maxError)
+				{
+					if (error > maxError)
+					{
+						Serial.print(name);
+						Serial.print(F(" error angle="));
+						Serial.println(error);
+						return false;
+					}
+
+					return true;
+				}
+
+				// Every fraction16_t in [-1 ; 1].
+				static bool TestExhaustive()
+				{
+					uint16_t searchError = 0;
+					uint16_t directError = 0;
+					uint16_t cosineError = 0;
+					for (int32_t value = -FRACTION16_1X; value <= FRACTION16_1X; value++)
+					{
+						const double fraction = (double)value / FRACTION16_1X;
+						const double reference = asin(fraction);
+						const ArcSines::Folded folded((fraction16_t)value);
+
+						const uint16_t search = GetAngleError(folded.Unfold(ArcSines::Search::Get(folded.Sine)), reference);
+						const uint16_t direct = GetAngleError(folded.Unfold(ArcSines::Direct::Get(folded.Sine)), reference);
+						const uint16_t cosine = GetAngleError(ArcCosine16((fraction16_t)value), acos(fraction));
+						searchError = (search > searchError) ? search : searchError;
+						directError = (direct > directError) ? direct : directError;
+						cosineError = (cosine > cosineError) ? cosine : cosineError;
+					}
+
+					bool pass = true;
+					pass &= Report("Exhaustive ArcSine16 search", searchError, 1);
+					pass &= Report("Exhaustive ArcSine16 direct", directError, 1);
+					pass &= Report("Exhaustive ArcCosine16", cosineError, 1);
+
+					return pass;
+				}
+
+				// Exact values, odd symmetry and saturation.
+				static bool TestSpecial()
+				{
+					if (ArcSine16(0) != 0 || ArcSine16(FRACTION16_1X) != ANGLE_90 || ArcSine16(-FRACTION16_1X) != ANGLE_270
+						|| ArcSine16(INT16_MAX) != ANGLE_90 || ArcSine16(INT16_MIN) != ANGLE_270
+						|| ArcSine16(FRACTION16_1X / 2) != (angle_t)(0 - ArcSine16(-FRACTION16_1X / 2))
+						|| ArcCosine16(FRACTION16_1X) != 0 || ArcCosine16(-FRACTION16_1X) != ANGLE_180 || ArcCosine16(0) != ANGLE_90)
+					{
+						Serial.println(F("ArcSine special values error."));
+						return false;
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting ArcSine tests..."));
+					bool pass = true;
+
+					pass &= TestExhaustive();
+					pass &= TestSpecial();
+
+					if (pass) Serial.println(F("ArcSine tests PASSED."));
+					else      Serial.println(F("ArcSine tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,225 @@
+#ifndef _ARC_TANGENT_TEST_h
+#define _ARC_TANGENT_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerTrigonometry16.h>
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace ArcTangent
+		{
+			// ArcTangent2/Polar (CORDIC) and ArcTangent16/Polar16 (LUT) must match atan2 and hypot
+			// for every angle_t, at small and full-scale radii, and for random and extreme vectors.
+			namespace Test
+			{
+				using IntegerSignal::Testing::NextRandom;
+
+				struct Errors
+				{
+					uint16_t Angle = 0;
+					double Magnitude = 0;
+				};
+
+				static double GetReferenceAngle(const int32_t y, const int32_t x)
+				{
+					const double pi = 3.14159265358979323846;
+					const double angle = atan2((double)y, (double)x) * 65536.0 / (2.0 * pi);
+
+					return (angle < 0) ? (angle + 65536.0) : angle;
+				}
+
+				// Distance to the rounded reference angle, in angle_t units, modular.
+				static uint16_t GetAngleError(const angle_t angle, const int32_t y, const int32_t x)
+				{
+					const angle_t reference = (angle_t)(uint32_t)(GetReferenceAngle(y, x) + 0.5);
+					const angle_t difference = angle - reference;
+
+					return (difference > ANGLE_180) ? (angle_t)(0 - difference) : difference;
+				}
+
+				// Relative magnitude error, beyond the integer rounding.
+				static double GetMagnitudeError(const uint32_t magnitude, const double reference)
+				{
+					const double error = fabs((double)magnitude - reference) - 0.5;
+
+					return (error > 0) ? (error / reference) : 0;
+				}
+
+				static void Check(const int32_t y, const int32_t x, Errors& cordic, Errors& lut)
+				{
+					const double reference = sqrt(((double)x * x) + ((double)y * y));
+
+					uint32_t magnitude;
+					const angle_t cordicAngle = Polar(y, x, magnitude);
+					if (cordicAngle != ArcTangent2(y, x))
+					{
+						cordic.Angle = UINT16_MAX;
+					}
+					const uint16_t cordicError = GetAngleError(cordicAngle, y, x);
+					cordic.Angle = (cordicError > cordic.Angle) ? cordicError : cordic.Angle;
+					const double cordicMagnitudeError = GetMagnitudeError(magnitude, reference);
+					cordic.Magnitude = (cordicMagnitudeError > cordic.Magnitude) ? cordicMagnitudeError : cordic.Magnitude;
+
+					const angle_t lutAngle = Polar16(y, x, magnitude);
+					if (lutAngle != ArcTangent16(y, x))
+					{
+						lut.Angle = UINT16_MAX;
+					}
+					const uint16_t lutError = GetAngleError(lutAngle, y, x);
+					lut.Angle = (lutError > lut.Angle) ? lutError : lut.Angle;
+					const double lutMagnitudeError = GetMagnitudeError(magnitude, reference);
+					lut.Magnitude = (lutMagnitudeError > lut.Magnitude) ? lutMagnitudeError : lut.Magnitude;
+				}
+
+				// LUT magnitude error, the tiny and smaller than 256 items LUTs use CORDIC.
+				static constexpr double LutMagnitudeError = ArcTangents::Tangent16::Enabled ? 0.00005 : 0.000001;
+
+				static bool Report(const char* name, const Errors& errors, const uint16_t maxAngleError, const double maxMagnitudeError)
+				{
+					if (errors.Angle > maxAngleError || errors.Magnitude > maxMagnitudeError)
+					{
+						Serial.print(name);
+						Serial.print(F(" error angle="));
+						Serial.print(errors.Angle);
+						Serial.print(F(" magnitude="));
+						Serial.print(errors.Magnitude * 1000000.0);
+						Serial.println(F("ppm"));
+						return false;
+					}
+
+					return true;
+				}
+
+				// Every angle_t, at small to full-scale radii.
+				static bool TestExhaustive()
+				{
+					const double pi = 3.14159265358979323846;
+					const double radii[] = { 20000.0, 1000000.0, 2147483647.0 };
+
+					Errors cordic{};
+					Errors lut{};
+					for (uint8_t r = 0; r < sizeof(radii) / sizeof(radii[0]); r++)
+					{
+						for (uint32_t a = 0; a <= ANGLE_RANGE; a++)
+						{
+							const double angle = 2.0 * pi * (double)a / 65536.0;
+							const double x = radii[r] * cos(angle);
+							const double y = radii[r] * sin(angle);
+							Check((int32_t)((y > 2147483647.0) ? 2147483647.0 : y), (int32_t)((x > 2147483647.0) ? 2147483647.0 : x), cordic, lut);
+						}
+					}
+
+					bool pass = true;
+					pass &= Report("Exhaustive ArcTangent2", cordic, 1, 0.000001);
+					pass &= Report("Exhaustive ArcTangent16", lut, 1, LutMagnitudeError);
+
+					return pass;
+				}
+
+				// Random vectors of any length, and extremes.
+				static bool TestRandom(const uint32_t steps)
+				{
+					Errors cordic{};
+					Errors lut{};
+
+					const int32_t extremes[] = { INT32_MIN, INT32_MIN + 1, -1, 0, 1, INT32_MAX };
+					for (uint8_t i = 0; i < 6; i++)
+					{
+						for (uint8_t j = 0; j < 6; j++)
+						{
+							if (extremes[i] != 0 || extremes[j] != 0)
+							{
+								Check(extremes[i], extremes[j], cordic, lut);
+							}
+						}
+					}
+
+					uint32_t seed = 0xA7A2;
+					for (uint32_t i = 0; i < steps; i++)
+					{
+						// Random lengths, from a few units to full scale.
+						const uint8_t shifts = NextRandom(seed) % 31;
+						const int32_t y = (int32_t)NextRandom(seed) >> shifts;
+						const int32_t x = (int32_t)NextRandom(seed) >> shifts;
+						if (x == 0 && y == 0)
+						{
+							continue;
+						}
+						Check(y, x, cordic, lut);
+					}
+
+					bool pass = true;
+					pass &= Report("Random ArcTangent2", cordic, 1, 0.000001);
+					pass &= Report("Random ArcTangent16", lut, 1, LutMagnitudeError);
+
+					uint32_t magnitude = 1;
+					if (ArcTangent2(0, 0) != 0 || ArcTangent16(0, 0) != 0
+						|| Polar(0, 0, magnitude) != 0 || magnitude != 0
+						|| ArcTangent2(0, INT32_MIN) != ANGLE_180 || ArcTangent16(0, INT32_MIN) != ANGLE_180
+						|| ArcTangent2(INT32_MIN, 0) != ANGLE_270 || ArcTangent16(INT32_MIN, 0) != ANGLE_270)
+					{
+						Serial.println(F("ArcTangent special values error."));
+						pass = false;
+					}
+
+					return pass;
+				}
+
+				static bool TestBatch()
+				{
+					static constexpr uint16_t Count = 100;
+
+					int32_t y[Count], x[Count];
+					angle_t angles[Count], lutAngles[Count], polarAngles[Count], lutPolarAngles[Count];
+					uint32_t magnitudes[Count], lutMagnitudes[Count];
+
+					uint32_t seed = 0xBA7C;
+					for (uint16_t i = 0; i < Count; i++)
+					{
+						y[i] = (int32_t)NextRandom(seed) >> (i % 31);
+						x[i] = (int32_t)NextRandom(seed) >> (i % 29);
+					}
+
+					ArcTangent2Batch(y, x, angles, Count);
+					ArcTangent16Batch(y, x, lutAngles, Count);
+					PolarBatch(y, x, magnitudes, polarAngles, Count);
+					Polar16Batch(y, x, lutMagnitudes, lutPolarAngles, Count);
+
+					for (uint16_t i = 0; i < Count; i++)
+					{
+						uint32_t magnitude, lutMagnitude;
+						const angle_t angle = Polar(y[i], x[i], magnitude);
+						const angle_t lutAngle = Polar16(y[i], x[i], lutMagnitude);
+						if (angles[i] != angle || polarAngles[i] != angle || magnitudes[i] != magnitude
+							|| lutAngles[i] != lutAngle || lutPolarAngles[i] != lutAngle || lutMagnitudes[i] != lutMagnitude)
+						{
+							Serial.println(F("ArcTangent batch mismatch."));
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting ArcTangent tests..."));
+					bool pass = true;
+
+					pass &= TestExhaustive();
+					pass &= TestRandom(MaxIterations);
+					pass &= TestBatch();
+
+					if (pass) Serial.println(F("ArcTangent tests PASSED."));
+					else      Serial.println(F("ArcTangent tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
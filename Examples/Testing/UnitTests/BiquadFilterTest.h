@@ -0,0 +1,442 @@
+#ifndef _BIQUAD_FILTER_TEST_h
+#define _BIQUAD_FILTER_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Biquad
+		{
+			// Biquad cascades must match a direct Direct Form I reference, per-sample, through ProcessBlock and in a bank.
+			// Designed filters must have the expected response, without zero-input limit cycles.
+			namespace Test
+			{
+				using Q14 = FixedPoint::ScalarFraction::Fraction16;
+				using Q30 = FixedPoint::ScalarFraction::Fraction32;
+
+				// Designers run at compile time.
+				static constexpr Coefficients<Q14> LowPass14 = Design::LowPass<Q14>(0.05);
+				static constexpr Coefficients<Q14> HighPass14 = Design::HighPass<Q14>(0.1);
+				static constexpr Coefficients<Q14> BandPass14 = Design::BandPass<Q14>(0.2, 2.0);
+				static constexpr Coefficients<Q14> Notch14 = Design::Notch<Q14>(0.125, 4.0);
+				static constexpr Coefficients<Q30> LowPass30 = Design::LowPass<Q30>(0.01);
+				static constexpr Coefficients<Q30> Notch30 = Design::Notch<Q30>(0.3, 1.0);
+				static constexpr Coefficients<Q30> LowNotch30 = Design::Notch<Q30>(0.01, 0.7);
+
+				static_assert(LowPass14.B0 == LowPass14.B2 && LowPass14.B1 > 0 && LowPass14.A1 < 0, "Biquad LowPass design error");
+				static_assert(Notch14.B0 == Notch14.B2 && Notch14.B1 == Notch14.A1, "Biquad Notch design error");
+
+				using IntegerSignal::Testing::NextRandom;
+
+				template<typename Format>
+				static bool CheckCoefficient(const char* name, const typename Format::scalar_t value, const double expected)
+				{
+					const double error = ((double)value / (double)Format::FRACTION_1X) - expected;
+					if (error > (1.0 / (double)Format::FRACTION_1X) || error < -(1.0 / (double)Format::FRACTION_1X))
+					{
+						Serial.print(F("Biquad design error "));
+						Serial.println(name);
+						return false;
+					}
+
+					return true;
+				}
+
+				// Compile-time designs against the runtime cookbook formulas.
+				template<typename Format>
+				static bool TestDesign(const Coefficients<Format>& coefficients, const double frequency, const double q, const uint8_t type)
+				{
+					const double w0 = 2 * Design::Pi * frequency;
+					const double cosW0 = cos(w0);
+					const double alpha = sin(w0) / (2 * q);
+					const double a0 = 1 + alpha;
+
+					double b0 = 0, b1 = 0, b2 = 0;
+					switch (type)
+					{
+					case 0: b0 = (1 - cosW0) / 2; b1 = 1 - cosW0; b2 = b0; break;
+					case 1: b0 = (1 + cosW0) / 2; b1 = -(1 + cosW0); b2 = b0; break;
+					case 2: b0 = alpha; b1 = 0; b2 = -alpha; break;
+					default: b0 = 1; b1 = -2 * cosW0; b2 = 1; break;
+					}
+
+					bool pass = true;
+					pass &= CheckCoefficient<Format>("B0", coefficients.B0, b0 / a0);
+					pass &= CheckCoefficient<Format>("B1", coefficients.B1, b1 / a0);
+					pass &= CheckCoefficient<Format>("B2", coefficients.B2, b2 / a0);
+					pass &= CheckCoefficient<Format>("A1", coefficients.A1, (-2 * cosW0) / a0);
+					pass &= CheckCoefficient<Format>("A2", coefficients.A2, (1 - alpha) / a0);
+
+					return pass;
+				}
+
+				// Independent DF-I cascade, with fraction saving.
+				template<typename ValueT, typename Format, uint8_t Stages>
+				struct Reference
+				{
+					int64_t X[Stages][2]{};
+					int64_t Y[Stages][2]{};
+					int64_t E[Stages]{};
+
+					ValueT Step(const Coefficients<Format>* sections, ValueT input)
+					{
+						static constexpr uint8_t Shifts = GetBitShifts(Format::FRACTION_1X);
+
+						int64_t x = input;
+						for (uint8_t i = 0; i < Stages; i++)
+						{
+							const Coefficients<Format>& c = sections[i];
+							const int64_t sum = E[i] + (c.B0 * x) + (c.B1 * X[i][0]) + (c.B2 * X[i][1]) - (c.A1 * Y[i][0]) - (c.A2 * Y[i][1]);
+							int64_t y = (sum < 0) ? -((-sum) >> Shifts) : (sum >> Shifts);
+							if (y > TypeTraits::TypeLimits::type_limits<ValueT>::Max()) { y = TypeTraits::TypeLimits::type_limits<ValueT>::Max(); E[i] = 0; }
+							else if (y < TypeTraits::TypeLimits::type_limits<ValueT>::Min()) { y = TypeTraits::TypeLimits::type_limits<ValueT>::Min(); E[i] = 0; }
+							else { E[i] = sum - (y * (int64_t)Format::FRACTION_1X); }
+
+							X[i][1] = X[i][0]; X[i][0] = x;
+							Y[i][1] = Y[i][0]; Y[i][0] = y;
+							x = y;
+						}
+
+						return (ValueT)x;
+					}
+				};
+
+				template<typename ValueT, typename Format, typename accumulator_t, uint8_t Stages>
+				static bool TestAgainstReference(const Coefficients<Format>* sections, const uint32_t samples)
+				{
+					static constexpr uint16_t BlockSize = 32;
+
+					Template::Filter<ValueT, Format, accumulator_t, Stages> filter;
+					Template::StaticFilter<ValueT, Format, accumulator_t, Stages> blockFilter;
+					IntegerSignal::Filter::IFilter<ValueT>* stepFilter = &filter;
+					Reference<ValueT, Format, Stages> reference;
+					for (uint8_t i = 0; i < Stages; i++)
+					{
+						filter.SetCoefficients(i, sections[i]);
+						blockFilter.SetCoefficients(i, sections[i]);
+					}
+					stepFilter->Clear();
+					blockFilter.Clear();
+
+					uint32_t seed = 0xB10C + Stages;
+					ValueT input[BlockSize];
+					ValueT output[BlockSize];
+					uint32_t n = 0;
+					while (n < samples)
+					{
+						const uint16_t length = (uint16_t)(1 + (n % BlockSize));
+						for (uint16_t i = 0; i < length; i++)
+						{
+							// Random, with runs of extremes to reach saturation.
+							input[i] = (((n + i) / 128) % 4 == 3)
+								? (((n + i) & 8) ? TypeTraits::TypeLimits::type_limits<ValueT>::Max() : TypeTraits::TypeLimits::type_limits<ValueT>::Min())
+								: (ValueT)(NextRandom(seed) >> ((n / 256) % 8));
+						}
+						blockFilter.ProcessBlock(input, output, length);
+
+						for (uint16_t i = 0; i < length; i++, n++)
+						{
+							const ValueT expected = reference.Step(sections, input[i]);
+							stepFilter->Set(input[i]);
+							stepFilter->Step();
+
+							if (stepFilter->Get() != expected || output[i] != expected)
+							{
+								Serial.print(F("Biquad mismatch stages="));
+								Serial.print(Stages);
+								Serial.print(F(" n=")); Serial.print(n);
+								Serial.print(F(" step=")); IntegerSignal::Testing::PrintUInt64((uint64_t)stepFilter->Get());
+								Serial.print(F(" block=")); IntegerSignal::Testing::PrintUInt64((uint64_t)output[i]);
+								Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64((uint64_t)expected);
+								Serial.println();
+								return false;
+							}
+						}
+					}
+
+					if (blockFilter.Get() != stepFilter->Get())
+					{
+						Serial.println(F("Biquad block state mismatch."));
+						return false;
+					}
+
+					return true;
+				}
+
+				// Bank outputs, stepped or interleaved, must match separate filter instances.
+				template<uint16_t Channels>
+				static bool TestBank(const uint32_t frames)
+				{
+					using FilterT = Static::BiquadCascadeI16<2>;
+
+					FilterT reference[Channels];
+					FilterBank<FilterT, Channels> bank;
+					FilterBank<FilterT, Channels> interleaved;
+
+					bank.SetCoefficients(0, LowPass14);
+					bank.SetCoefficients(1, Notch14);
+					interleaved.SetCoefficients(0, LowPass14);
+					interleaved.SetCoefficients(1, Notch14);
+					bank.Clear(100);
+					interleaved.Clear(100);
+					for (uint16_t c = 0; c < Channels; c++)
+					{
+						reference[c].SetCoefficients(0, LowPass14);
+						reference[c].SetCoefficients(1, Notch14);
+						reference[c].Clear(100);
+					}
+
+					uint32_t seed = 0xCAFE;
+					int16_t frame[Channels];
+					int16_t output[Channels * 3];
+					int16_t input[Channels * 3];
+					for (uint32_t f = 0; f < frames; f += 3)
+					{
+						for (uint16_t i = 0; i < Channels * 3; i++)
+						{
+							input[i] = (int16_t)NextRandom(seed);
+						}
+						interleaved.ProcessInterleaved(input, output, 3);
+
+						for (uint8_t k = 0; k < 3; k++)
+						{
+							for (uint16_t c = 0; c < Channels; c++)
+							{
+								frame[c] = input[(k * Channels) + c];
+							}
+							bank.Set(frame);
+							bank.Step();
+
+							for (uint16_t c = 0; c < Channels; c++)
+							{
+								reference[c].Set(frame[c]);
+								reference[c].Step();
+
+								if (reference[c].Get() != bank.Get(c)
+									|| reference[c].Get() != output[(k * Channels) + c])
+								{
+									Serial.print(F("Biquad bank mismatch frame="));
+									Serial.print(f + k);
+									Serial.print(F(" channel=")); Serial.println(c);
+									return false;
+								}
+							}
+						}
+
+						for (uint16_t c = 0; c < Channels; c++)
+						{
+							if (interleaved.Get(c) != bank.Get(c))
+							{
+								Serial.println(F("Biquad interleaved state mismatch."));
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				// Settled output for a constant input.
+				template<typename FilterT, typename ValueT>
+				static ValueT Settle(FilterT& filter, const ValueT value, const uint16_t steps)
+				{
+					for (uint16_t i = 0; i < steps; i++)
+					{
+						filter.Set(value);
+						filter.Step();
+					}
+
+					return filter.Get();
+				}
+
+				static bool TestResponse()
+				{
+					bool pass = true;
+
+					// Unit DC gain for the low-pass, from rest and from Clear().
+					Static::BiquadI16 lowPass;
+					lowPass.SetCoefficients(LowPass14);
+					lowPass.Clear();
+					const int16_t settled = Settle(lowPass, (int16_t)20000, 400);
+					lowPass.Clear(-12345);
+					const int16_t cleared = Settle(lowPass, (int16_t)-12345, 1);
+					if (settled < 19998 || settled > 20002 || cleared < -12347 || cleared > -12343)
+					{
+						Serial.println(F("Biquad LowPass DC gain error."));
+						pass = false;
+					}
+
+					// High-pass blocks DC.
+					Static::BiquadI32 highPass;
+					highPass.SetCoefficients(Design::HighPass<Q30>(0.05));
+					highPass.Clear();
+					const int32_t blocked = Settle(highPass, (int32_t)1000000000, 2000);
+					if (blocked < -2 || blocked > 2)
+					{
+						Serial.println(F("Biquad HighPass DC error."));
+						pass = false;
+					}
+
+					// Notch rejects its center frequency, passes others.
+					Static::BiquadCascadeI16<2> notch;
+					notch.SetCoefficients(Notch14);
+					notch.Clear();
+					int16_t notchedPeak = 0;
+					for (uint16_t i = 0; i < 2000; i++)
+					{
+						notch.Set((int16_t)(16000.0 * sin(2 * Design::Pi * 0.125 * i)));
+						notch.Step();
+						if (i > 1000 && abs(notch.Get()) > notchedPeak)
+							notchedPeak = abs(notch.Get());
+					}
+					if (notchedPeak > 160)
+					{
+						Serial.print(F("Biquad Notch rejection error peak="));
+						Serial.println(notchedPeak);
+						pass = false;
+					}
+
+					// Zero input after an impulse decays to exactly zero.
+					Static::BiquadI16 resonant;
+					resonant.SetCoefficients(BandPass14);
+					resonant.Clear();
+					resonant.Set(INT16_MAX);
+					resonant.Step();
+					if (Settle(resonant, (int16_t)0, 2000) != 0 || Settle(resonant, (int16_t)0, 100) != 0)
+					{
+						Serial.println(F("Biquad zero-input limit cycle."));
+						pass = false;
+					}
+
+					return pass;
+				}
+
+				// Full-scale 32 bit samples through a low-frequency notch, with b1 and a1 near -2: section sums exceed 64 bits.
+				static bool TestFullScale(const uint32_t samples)
+				{
+					static constexpr uint16_t BlockSize = 32;
+					static constexpr int32_t Tolerance = 1L << 16;
+					using limits = TypeTraits::TypeLimits::type_limits<int32_t>;
+
+					BiquadI32 filter;
+					Static::BiquadI32 blockFilter;
+					IntegerSignal::Filter::IFilter<int32_t>* stepFilter = &filter;
+					filter.SetCoefficients(LowNotch30);
+					blockFilter.SetCoefficients(LowNotch30);
+					stepFilter->Clear();
+					blockFilter.Clear();
+
+					// Floating point model of the quantized section, saturated as the filter.
+					const double b0 = (double)LowNotch30.B0 / Q30::FRACTION_1X;
+					const double b1 = (double)LowNotch30.B1 / Q30::FRACTION_1X;
+					const double b2 = (double)LowNotch30.B2 / Q30::FRACTION_1X;
+					const double a1 = (double)LowNotch30.A1 / Q30::FRACTION_1X;
+					const double a2 = (double)LowNotch30.A2 / Q30::FRACTION_1X;
+					double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+
+					// Constant extremes, full-scale Nyquist and full-scale random, in phases of 1024 samples.
+					uint32_t seed = 0xF5;
+					int32_t input[BlockSize];
+					int32_t output[BlockSize];
+					for (uint32_t n = 0; n < samples; n += BlockSize)
+					{
+						const uint8_t phase = (uint8_t)((n / 1024) % 4);
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							switch (phase)
+							{
+							case 0: input[i] = limits::Max(); break;
+							case 1: input[i] = limits::Min(); break;
+							case 2: input[i] = (i & 1) ? limits::Min() : limits::Max(); break;
+							default: input[i] = (NextRandom(seed) & 0x80000000) ? limits::Min() : limits::Max(); break;
+							}
+						}
+						blockFilter.ProcessBlock(input, output, BlockSize);
+
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							stepFilter->Set(input[i]);
+							stepFilter->Step();
+
+							double y = (b0 * input[i]) + (b1 * x1) + (b2 * x2) - (a1 * y1) - (a2 * y2);
+							y = (y > limits::Max()) ? limits::Max() : ((y < limits::Min()) ? limits::Min() : y);
+							x2 = x1; x1 = input[i];
+							y2 = y1; y1 = y;
+
+							if (stepFilter->Get() != output[i]
+								|| ((double)output[i] - y) > Tolerance || ((double)output[i] - y) < -Tolerance)
+							{
+								Serial.print(F("Biquad full-scale mismatch n="));
+								Serial.print(n + i);
+								Serial.print(F(" output="));
+								Serial.print(output[i]);
+								Serial.print(F(" expected="));
+								Serial.println(y, 0);
+								return false;
+							}
+						}
+					}
+
+					// Below full scale, the direct reference sum does not overflow.
+					Reference<int32_t, Q30, 1> reference;
+					stepFilter->Clear();
+					for (uint32_t n = 0; n < samples; n++)
+					{
+						const int32_t value = (int32_t)NextRandom(seed) >> 3;
+						stepFilter->Set(value);
+						stepFilter->Step();
+						if (stepFilter->Get() != reference.Step(&LowNotch30, value))
+						{
+							Serial.print(F("Biquad full-scale reference mismatch n="));
+							Serial.println(n);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting Biquad filter tests..."));
+					bool pass = true;
+
+					pass &= TestDesign<Q14>(LowPass14, 0.05, 0.7071067811865476, 0);
+					pass &= TestDesign<Q14>(HighPass14, 0.1, 0.7071067811865476, 1);
+					pass &= TestDesign<Q14>(BandPass14, 0.2, 2.0, 2);
+					pass &= TestDesign<Q14>(Notch14, 0.125, 4.0, 3);
+					pass &= TestDesign<Q30>(LowPass30, 0.01, 0.7071067811865476, 0);
+					pass &= TestDesign<Q30>(Notch30, 0.3, 1.0, 3);
+					pass &= TestDesign<Q30>(LowNotch30, 0.01, 0.7, 3);
+
+					const Coefficients<Q14> sections14[3] = { LowPass14, Notch14, HighPass14 };
+					const Coefficients<Q30> sections30[2] = { LowPass30, Notch30 };
+					const Coefficients<Q14> unstable14[1] = { { Q14::FRACTION_1X, 0, 0, -2 * Q14::FRACTION_1X, Q14::FRACTION_1X } };
+
+					pass &= TestAgainstReference<int16_t, Q14, int64_t, 1>(sections14, MaxIterations);
+					pass &= TestAgainstReference<int16_t, Q14, int64_t, 3>(sections14, MaxIterations);
+					pass &= TestAgainstReference<int16_t, Q14, int32_t, 1>(sections14, MaxIterations);
+					pass &= TestAgainstReference<int16_t, Q14, int64_t, 1>(unstable14, MaxIterations);
+					pass &= TestAgainstReference<int32_t, Q30, int64_t, 1>(sections30, MaxIterations);
+					pass &= TestAgainstReference<int32_t, Q30, int64_t, 2>(sections30, MaxIterations);
+
+					pass &= TestBank<1>(MaxIterations);
+					pass &= TestBank<6>(MaxIterations);
+
+					pass &= TestResponse();
+					pass &= TestFullScale(4096);
+
+					if (pass) Serial.println(F("Biquad filter tests PASSED."));
+					else      Serial.println(F("Biquad filter tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,247 @@
+#ifndef _CIC_FILTER_TEST_h
+#define _CIC_FILTER_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Cic
+		{
+			// CIC decimators and interpolators must match a direct boxcar^order convolution,
+			// per-sample and through ProcessBlock, and hold a constant input after Clear(value).
+			namespace Test
+			{
+				using IntegerSignal::Testing::NextRandom;
+
+				// Boxcar^order kernel, order * (rate - 1) + 1 taps.
+				template<uint8_t Order, uint16_t Rate>
+				static void MakeKernel(uint64_t* kernel)
+				{
+					static constexpr uint16_t Length = (Order * (Rate - 1)) + 1;
+
+					for (uint16_t i = 0; i < Length; i++)
+					{
+						kernel[i] = (i < Rate) ? 1 : 0;
+					}
+
+					for (uint8_t o = 1; o < Order; o++)
+					{
+						for (uint16_t i = Length - 1; i < Length; i--)
+						{
+							uint64_t sum = 0;
+							for (uint16_t k = 0; k < Rate && k <= i; k++)
+							{
+								sum += kernel[i - k];
+							}
+							kernel[i] = sum;
+						}
+					}
+				}
+
+				template<typename ValueT, uint8_t Order, uint16_t Rate>
+				static bool TestDecimator(const uint32_t samples)
+				{
+					using DecimatorT = Template::Decimator<ValueT, Order, Rate>;
+					static constexpr uint16_t Length = (Order * (Rate - 1)) + 1;
+					static constexpr uint8_t Shifts = Order * GetBitShifts(Rate);
+					static constexpr uint32_t MaxSamples = 4096;
+
+					uint64_t kernel[Length];
+					MakeKernel<Order, Rate>(kernel);
+
+					static ValueT input[MaxSamples];
+					const uint32_t count = (samples < MaxSamples) ? samples : MaxSamples;
+					uint32_t seed = 0xC1C + Order + Rate;
+					for (uint32_t i = 0; i < count; i++)
+					{
+						// Random, with runs of full scale.
+						input[i] = (((i / 512) % 3) == 2) ? TypeTraits::TypeLimits::type_limits<ValueT>::Max() : (ValueT)NextRandom(seed);
+					}
+
+					DecimatorT decimator;
+					DecimatorT blockDecimator;
+					decimator.Clear();
+					blockDecimator.Clear();
+
+					static ValueT output[MaxSamples];
+					uint32_t outputs = 0;
+					uint32_t n = 0;
+					while (n < count)
+					{
+						const uint32_t remaining = count - n;
+						const uint32_t length = (remaining < ((n % 37) + 1)) ? remaining : ((n % 37) + 1);
+						outputs += (uint32_t)blockDecimator.ProcessBlock(&input[n], &output[outputs], length);
+						n += length;
+					}
+
+					uint32_t checked = 0;
+					for (uint32_t m = 0; m < count; m++)
+					{
+						if (!decimator.Push(input[m]))
+						{
+							continue;
+						}
+
+						uint64_t sum = 0;
+						for (uint16_t k = 0; k < Length && k <= m; k++)
+						{
+							sum += kernel[k] * input[m - k];
+						}
+						const ValueT expected = (ValueT)(sum >> Shifts);
+
+						if (decimator.Get() != expected
+							|| checked >= outputs
+							|| output[checked] != expected)
+						{
+							Serial.print(F("CIC decimator mismatch order="));
+							Serial.print(Order);
+							Serial.print(F(" rate=")); Serial.print(Rate);
+							Serial.print(F(" m=")); Serial.print(m);
+							Serial.print(F(" got=")); IntegerSignal::Testing::PrintUInt64(decimator.Get());
+							Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64(expected);
+							Serial.println();
+							return false;
+						}
+						checked++;
+					}
+
+					if (checked != outputs || checked != count / Rate)
+					{
+						Serial.println(F("CIC decimator output count error."));
+						return false;
+					}
+
+					return true;
+				}
+
+				template<typename ValueT, uint8_t Order, uint16_t Rate>
+				static bool TestInterpolator(const uint32_t samples)
+				{
+					using InterpolatorT = Template::Interpolator<ValueT, Order, Rate>;
+					static constexpr uint16_t Length = (Order * (Rate - 1)) + 1;
+					static constexpr uint8_t Shifts = (Order - 1) * GetBitShifts(Rate);
+					static constexpr uint32_t MaxSamples = 256;
+
+					uint64_t kernel[Length];
+					MakeKernel<Order, Rate>(kernel);
+
+					static ValueT input[MaxSamples];
+					const uint32_t count = (samples < MaxSamples) ? samples : MaxSamples;
+					uint32_t seed = 0x1C1C + Order + Rate;
+					for (uint32_t i = 0; i < count; i++)
+					{
+						input[i] = ((i % 16) < 4) ? TypeTraits::TypeLimits::type_limits<ValueT>::Max() : (ValueT)NextRandom(seed);
+					}
+
+					InterpolatorT interpolator;
+					InterpolatorT blockInterpolator;
+					interpolator.Clear();
+					blockInterpolator.Clear();
+
+					static ValueT blockOutput[MaxSamples * Rate];
+					blockInterpolator.ProcessBlock(input, blockOutput, count / 2);
+					blockInterpolator.ProcessBlock(&input[count / 2], &blockOutput[(count / 2) * Rate], count - (count / 2));
+
+					ValueT output[Rate];
+					for (uint32_t i = 0; i < count; i++)
+					{
+						interpolator.Interpolate(input[i], output);
+
+						for (uint16_t p = 0; p < Rate; p++)
+						{
+							// Zero-stuffed input, only every Rate-th sample is non-zero.
+							const uint32_t j = (i * Rate) + p;
+							uint64_t sum = 0;
+							for (uint16_t k = (uint16_t)(j % Rate); k < Length && k <= j; k += Rate)
+							{
+								sum += kernel[k] * input[(j - k) / Rate];
+							}
+							const ValueT expected = (ValueT)(sum >> Shifts);
+
+							if (output[p] != expected || blockOutput[j] != expected)
+							{
+								Serial.print(F("CIC interpolator mismatch order="));
+								Serial.print(Order);
+								Serial.print(F(" rate=")); Serial.print(Rate);
+								Serial.print(F(" j=")); Serial.print(j);
+								Serial.print(F(" got=")); IntegerSignal::Testing::PrintUInt64(output[p]);
+								Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64(expected);
+								Serial.println();
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				template<typename ValueT, uint8_t Order, uint16_t Rate>
+				static bool TestClear(const ValueT value)
+				{
+					Template::Decimator<ValueT, Order, Rate> decimator;
+					Template::Interpolator<ValueT, Order, Rate> interpolator;
+					decimator.Clear(value);
+					interpolator.Clear(value);
+
+					ValueT output[Rate];
+					for (uint16_t i = 0; i < 4; i++)
+					{
+						interpolator.Interpolate(value, output);
+						for (uint16_t p = 0; p < Rate; p++)
+						{
+							if (output[p] != value)
+							{
+								Serial.println(F("CIC interpolator Clear() steady state error."));
+								return false;
+							}
+						}
+					}
+
+					for (uint16_t i = 0; i < 4 * Rate; i++)
+					{
+						if (decimator.Push(value) && decimator.Get() != value)
+						{
+							Serial.println(F("CIC decimator Clear() steady state error."));
+							return false;
+						}
+					}
+
+					return decimator.Get() == value;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting CIC filter tests..."));
+					bool pass = true;
+
+					pass &= TestDecimator<uint8_t, 1, 2>(MaxIterations);
+					pass &= TestDecimator<uint8_t, 2, 4>(MaxIterations);
+					pass &= TestDecimator<uint16_t, 3, 8>(MaxIterations);
+					pass &= TestDecimator<uint16_t, 4, 64>(MaxIterations);
+					pass &= TestDecimator<uint32_t, 2, 16>(MaxIterations);
+					pass &= TestDecimator<uint32_t, 4, 64>(MaxIterations);
+
+					pass &= TestInterpolator<uint8_t, 1, 4>(MaxIterations);
+					pass &= TestInterpolator<uint8_t, 3, 4>(MaxIterations);
+					pass &= TestInterpolator<uint16_t, 2, 8>(MaxIterations);
+					pass &= TestInterpolator<uint16_t, 4, 16>(MaxIterations);
+					pass &= TestInterpolator<uint32_t, 3, 32>(MaxIterations);
+
+					pass &= TestClear<uint8_t, 2, 4>(200);
+					pass &= TestClear<uint16_t, 4, 64>(54321);
+					pass &= TestClear<uint32_t, 3, 16>(UINT32_MAX);
+
+					if (pass) Serial.println(F("CIC filter tests PASSED."));
+					else      Serial.println(F("CIC filter tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
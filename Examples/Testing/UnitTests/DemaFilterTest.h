@@ -418,6 +418,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::DemaU8<2>;
 						pass &= TestDCConvergence<F, uint8_t>(200, 2048);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint8_t>(F("DEMA"), 123, 256);
 						pass &= TestStepMonotonic<F, uint8_t>(0, 200, 2048, true);
 						pass &= TestLinearity<F, uint8_t>(85, 3, Tol);
 						pass &= TestSaturation<F, uint8_t>(UINT8_MAX, 4096);
@@ -444,6 +445,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::DemaU16<8>;
 						pass &= TestDCConvergence<F, uint16_t>(60000, 4096);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint16_t>(F("DEMA"), 43210, 256);
 						pass &= TestStepMonotonic<F, uint16_t>(0, 60000, 4096, true);
 						pass &= TestSaturation<F, uint16_t>(UINT16_MAX, 8192);
 					}
@@ -462,6 +464,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::DemaU32<8>;
 						pass &= TestDCConvergence<F, uint32_t>(4294967295u, 8192);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint32_t>(F("DEMA"), 3000000000u, 256);
 						pass &= TestStepMonotonic<F, uint32_t>(0u, 4294967295u, 8192, true);
 						pass &= TestSaturation<F, uint32_t>(UINT32_MAX, 8192);
 					}
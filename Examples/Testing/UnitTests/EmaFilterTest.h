@@ -469,6 +469,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::EmaU8<4>;
 						pass &= TestClearSemantics<F, uint8_t, 4>(0);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint8_t>(F("EMA"), 123, 256);
 						pass &= TestDCConvergence<F, uint8_t>(200, 2048);
 						pass &= TestStepMonotonic<F, uint8_t, 4>(0, 200, 2048, true);
 						pass &= TestLinearity<F, uint8_t>(85, 3, Tol);
@@ -544,6 +545,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::EmaU16<8>;
 						pass &= TestClearSemantics<F, uint16_t, 8>(0);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint16_t>(F("EMA"), 43210, 256);
 						pass &= TestDCConvergence<F, uint16_t>(60000, 4096);
 						pass &= TestStepMonotonic<F, uint16_t, 8>(0, 60000, 4096, true);
 						pass &= TestSaturation<F, uint16_t>(UINT16_MAX, 8192);
@@ -564,6 +566,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::EmaU32<8>;
 						pass &= TestClearSemantics<F, uint32_t, 8>(0u);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint32_t>(F("EMA"), 3000000000u, 256);
 						pass &= TestDCConvergence<F, uint32_t>(4294967295u, 8192);
 						pass &= TestStepMonotonic<F, uint32_t, 8>(0u, 4294967295u, 8192, true);
 						pass &= TestSaturation<F, uint32_t>(UINT32_MAX, 8192);
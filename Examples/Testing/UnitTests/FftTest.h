@@ -0,0 +1,213 @@
+#ifndef _FFT_TEST_h
+#define _FFT_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerTrigonometry16.h>
+
+namespace IntegerSignal
+{
+	namespace Spectrum
+	{
+		namespace Fft
+		{
+			// FFT outputs, scaled by their block exponent, must match a floating-point DFT within a bound
+			// relative to full scale. Inverse transforms must recover the input.
+			namespace Test
+			{
+				using IntegerSignal::Testing::NextRandom;
+
+				static double GetScale(const int8_t exponent)
+				{
+					return (exponent >= 0) ? (double)((uint64_t)1 << exponent) : 1.0 / (double)((uint64_t)1 << -exponent);
+				}
+
+				// Test signal: a few full-scale tones plus noise, or plain full-scale noise.
+				template<typename ValueT>
+				static void MakeSignal(ValueT* data, const uint32_t count, const uint8_t type, uint32_t& seed)
+				{
+					const double amplitude = (double)TypeTraits::TypeLimits::type_limits<ValueT>::Max();
+					for (uint32_t i = 0; i < count; i++)
+					{
+						double value = 0;
+						switch (type)
+						{
+						case 0:
+							value = (0.5 * sin(0.1 * i)) + (0.3 * cos(1.3 * i)) + ((double)(NextRandom(seed) % 1000) / 10000.0);
+							break;
+						case 1:
+							value = (i == 0) ? 1.0 : 0.0;
+							break;
+						default:
+							value = ((double)(NextRandom(seed) % 2000001) / 1000000.0) - 1.0;
+							break;
+						}
+
+						const double scaled = value * amplitude;
+						data[i] = (ValueT)((scaled > amplitude) ? amplitude : ((scaled < -amplitude) ? -amplitude : scaled));
+					}
+				}
+
+				// Max error of data * 2^exponent against the DFT of input, relative to the full-scale bin Size * Max.
+				template<typename ValueT>
+				static double GetDftError(const ValueT* input, const ValueT* output, const uint16_t size, const int8_t exponent,
+					const bool complex, const bool inverse, const uint16_t bins)
+				{
+					const double pi = 3.14159265358979323846;
+					const double scale = GetScale(exponent);
+					double maxError = 0;
+
+					for (uint16_t k = 0; k < bins; k++)
+					{
+						double re = 0, im = 0;
+						for (uint16_t n = 0; n < size; n++)
+						{
+							const double angle = (inverse ? 2.0 : -2.0) * pi * (double)(((uint32_t)n * k) % size) / (double)size;
+							const double xr = complex ? input[2 * n] : input[n];
+							const double xi = complex ? input[(2 * n) + 1] : 0;
+							re += (xr * cos(angle)) - (xi * sin(angle));
+							im += (xr * sin(angle)) + (xi * cos(angle));
+						}
+						if (inverse)
+						{
+							re /= size;
+							im /= size;
+						}
+
+						double gotRe, gotIm;
+						if (complex)
+						{
+							gotRe = output[2 * k] * scale;
+							gotIm = output[(2 * k) + 1] * scale;
+						}
+						else if (k == 0)
+						{
+							gotRe = output[0] * scale;
+							gotIm = 0;
+						}
+						else if (k == size / 2)
+						{
+							gotRe = output[1] * scale;
+							gotIm = 0;
+						}
+						else
+						{
+							gotRe = output[2 * k] * scale;
+							gotIm = output[(2 * k) + 1] * scale;
+						}
+
+						const double error = fabs(gotRe - re) + fabs(gotIm - im);
+						maxError = (error > maxError) ? error : maxError;
+					}
+
+					return maxError / ((double)size * (double)TypeTraits::TypeLimits::type_limits<ValueT>::Max());
+				}
+
+				template<typename FftT, typename ValueT>
+				static bool TestComplex(const double tolerance, const double inverseTolerance)
+				{
+					static constexpr uint16_t Size = FftT::Size;
+					static FftT fft;
+					static ValueT input[2 * Size];
+					static ValueT data[2 * Size];
+
+					bool pass = true;
+					uint32_t seed = 0xFF7 + Size;
+					for (uint8_t type = 0; type < 3; type++)
+					{
+						MakeSignal(input, 2 * Size, type, seed);
+						for (uint32_t i = 0; i < 2 * Size; i++)
+						{
+							data[i] = input[i];
+						}
+
+						const int8_t exponent = fft.Forward(data);
+						const double error = GetDftError(input, data, Size, exponent, true, false, Size);
+
+						// Round trip.
+						const int8_t inverseExponent = fft.Inverse(data);
+						const double scale = GetScale(inverseExponent + exponent);
+						double roundError = 0;
+						for (uint32_t i = 0; i < 2 * Size; i++)
+						{
+							const double delta = fabs(((double)data[i] * scale) - (double)input[i]);
+							roundError = (delta > roundError) ? delta : roundError;
+						}
+						roundError /= (double)TypeTraits::TypeLimits::type_limits<ValueT>::Max();
+
+						if (error > tolerance || roundError > inverseTolerance)
+						{
+							Serial.print(F("FFT error size="));
+							Serial.print(Size);
+							Serial.print(F(" type=")); Serial.print(type);
+							Serial.print(F(" dft=")); Serial.print(error * 1000000.0);
+							Serial.print(F("ppm inverse=")); Serial.print(roundError * 1000000.0);
+							Serial.println(F("ppm"));
+							pass = false;
+						}
+					}
+
+					return pass;
+				}
+
+				template<typename FftT, typename ValueT>
+				static bool TestReal(const double tolerance)
+				{
+					static constexpr uint16_t Size = FftT::Size;
+					static FftT fft;
+					static ValueT input[Size];
+					static ValueT data[Size];
+
+					bool pass = true;
+					uint32_t seed = 0x4EA1 + Size;
+					for (uint8_t type = 0; type < 3; type++)
+					{
+						MakeSignal(input, Size, type, seed);
+						for (uint32_t i = 0; i < Size; i++)
+						{
+							data[i] = input[i];
+						}
+
+						const int8_t exponent = fft.Forward(data);
+						const double error = GetDftError(input, data, Size, exponent, false, false, (Size / 2) + 1);
+						if (error > tolerance)
+						{
+							Serial.print(F("Real FFT error size="));
+							Serial.print(Size);
+							Serial.print(F(" type=")); Serial.print(type);
+							Serial.print(F(" dft=")); Serial.print(error * 1000000.0);
+							Serial.println(F("ppm"));
+							pass = false;
+						}
+					}
+
+					return pass;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting FFT tests..."));
+					bool pass = true;
+
+					// Bounded by the twiddle accuracy, then by rounding at each stage.
+					pass &= TestComplex<FftI16<64>, int16_t>(0.0001, 0.001);
+					pass &= TestComplex<FftI16<256>, int16_t>(0.0001, 0.0015);
+					pass &= TestComplex<FftI16<1024>, int16_t>(0.0001, 0.003);
+					pass &= TestComplex<FftI32<64>, int32_t>(0.0001, 0.001);
+					pass &= TestComplex<FftI32<512>, int32_t>(0.0001, 0.001);
+
+					pass &= TestReal<RealFftI16<64>, int16_t>(0.0001);
+					pass &= TestReal<RealFftI16<1024>, int16_t>(0.0001);
+					pass &= TestReal<RealFftI32<128>, int32_t>(0.0001);
+					pass &= TestReal<RealFftI32<512>, int32_t>(0.0001);
+
+					if (pass) Serial.println(F("FFT tests PASSED."));
+					else      Serial.println(F("FFT tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
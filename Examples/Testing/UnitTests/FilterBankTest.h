@@ -0,0 +1,113 @@
+#ifndef _FILTER_BANK_TEST_h
+#define _FILTER_BANK_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Bank
+		{
+			namespace Test
+			{
+				// Bank outputs must be identical to Channels separate filter instances.
+				template<typename FilterT, typename ValueT, uint16_t Channels>
+				static bool TestAgainstSeparate(const ValueT init, const uint32_t steps)
+				{
+					FilterT reference[Channels];
+					IntegerSignal::Filters::FilterBank<FilterT, Channels> bank;
+
+					bank.Clear(init);
+					for (uint16_t c = 0; c < Channels; c++)
+					{
+						reference[c].Clear(init);
+					}
+
+					// Per-channel Clear on a few channels.
+					for (uint16_t c = 0; c < Channels; c += 7)
+					{
+						const ValueT value = (ValueT)(init ^ (ValueT)(c * 2654435761u));
+						bank.Clear(c, value);
+						reference[c].Clear(value);
+					}
+
+					ValueT inputs[Channels];
+					uint32_t seed = 0xACE1u;
+
+					for (uint32_t s = 0; s < steps; s++)
+					{
+						for (uint16_t c = 0; c < Channels; c++)
+						{
+							seed = (seed * 1103515245u) + 12345u;
+							inputs[c] = (ValueT)(((uint64_t)seed << 32 | (seed >> 3)) >> ((s + c) % 32));
+						}
+
+						// Alternate bulk and per-channel input setting.
+						if (s & 1)
+						{
+							bank.Set(inputs);
+						}
+						else
+						{
+							for (uint16_t c = 0; c < Channels; c++)
+							{
+								bank.Set(c, inputs[c]);
+							}
+						}
+						bank.Step();
+
+						const ValueT* outputs = bank.GetOutputs();
+						for (uint16_t c = 0; c < Channels; c++)
+						{
+							reference[c].Set(inputs[c]);
+							reference[c].Step();
+
+							if (reference[c].Get() != bank.Get(c)
+								|| outputs[c] != bank.Get(c))
+							{
+								Serial.print(F("FilterBank mismatch at step "));
+								Serial.print(s);
+								Serial.print(F(" channel=")); Serial.print(c);
+								Serial.print(F(" got=")); IntegerSignal::Testing::PrintUInt64(bank.Get(c));
+								Serial.print(F(" ref=")); IntegerSignal::Testing::PrintUInt64(reference[c].Get());
+								Serial.println();
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting FilterBank tests..."));
+					bool pass = true;
+
+					constexpr uint32_t Steps = (MaxIterations > 10) ? (MaxIterations / 10) : 1;
+
+					pass &= TestAgainstSeparate<LowPassU8<4>, uint8_t, 33>(123, Steps);
+					pass &= TestAgainstSeparate<LowPassU16<8>, uint16_t, 33>(43210, Steps);
+					pass &= TestAgainstSeparate<LowPassU32<8>, uint32_t, 33>(3000000000u, Steps);
+
+					pass &= TestAgainstSeparate<EmaU8<4>, uint8_t, 33>(123, Steps);
+					pass &= TestAgainstSeparate<EmaU16<4>, uint16_t, 33>(43210, Steps);
+					pass &= TestAgainstSeparate<EmaU32<8>, uint32_t, 33>(3000000000u, Steps);
+
+					pass &= TestAgainstSeparate<DemaU8<2>, uint8_t, 33>(123, Steps);
+					pass &= TestAgainstSeparate<DemaU16<4>, uint16_t, 33>(43210, Steps);
+					pass &= TestAgainstSeparate<DemaU32<8>, uint32_t, 33>(3000000000u, Steps);
+
+					if (pass) Serial.println(F("FilterBank tests PASSED."));
+					else      Serial.println(F("FilterBank tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,198 @@
+#ifndef _FIR_FILTER_TEST_h
+#define _FIR_FILTER_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Fir
+		{
+			// FIR filters must match a direct convolution, per-sample and through ProcessBlock,
+			// with and without symmetric tap folding.
+			namespace Test
+			{
+				using IntegerSignal::Testing::NextRandom;
+
+				// Random taps with a sum of absolute values below 2.
+				template<typename tap_t, uint16_t TapCount>
+				static void MakeTaps(tap_t* taps, const tap_t unit, uint32_t& seed, const bool symmetric)
+				{
+					const int64_t range = ((int64_t)unit * 2) / TapCount;
+					for (uint16_t i = 0; i < TapCount; i++)
+					{
+						taps[i] = (tap_t)(((int64_t)(NextRandom(seed) % (2 * range + 1))) - range);
+					}
+
+					if (symmetric)
+					{
+						for (uint16_t i = 0; i < TapCount / 2; i++)
+						{
+							taps[TapCount - 1 - i] = taps[i];
+						}
+					}
+				}
+
+				template<typename ValueT, typename tap_t, uint8_t Shifts, uint16_t TapCount>
+				static ValueT Reference(const ValueT* samples, const uint32_t n, const tap_t* taps)
+				{
+					int64_t sum = 0;
+					for (uint16_t k = 0; k < TapCount && k <= n; k++)
+					{
+						sum += (int64_t)samples[n - k] * taps[k];
+					}
+
+					const int64_t result = SignedRightShift(sum, Shifts);
+					if (result > TypeTraits::TypeLimits::type_limits<ValueT>::Max()) return TypeTraits::TypeLimits::type_limits<ValueT>::Max();
+					if (result < TypeTraits::TypeLimits::type_limits<ValueT>::Min()) return TypeTraits::TypeLimits::type_limits<ValueT>::Min();
+
+					return (ValueT)result;
+				}
+
+				template<typename FilterT, typename StaticT, typename ValueT, typename Format, uint16_t TapCount, bool Symmetric>
+				static bool TestConvolution(const uint32_t samples)
+				{
+					using tap_t = typename Format::scalar_t;
+					static constexpr uint8_t Shifts = GetBitShifts(Format::FRACTION_1X);
+					static constexpr uint16_t BlockSize = 40;
+					static constexpr uint32_t MaxSamples = 1200;
+
+					uint32_t seed = 0x5EED + TapCount;
+					tap_t taps[TapCount];
+					MakeTaps<tap_t, TapCount>(taps, Format::FRACTION_1X, seed, Symmetric);
+
+					static ValueT input[MaxSamples];
+					const uint32_t count = (samples < MaxSamples) ? samples : MaxSamples;
+					for (uint32_t i = 0; i < count; i++)
+					{
+						// Full scale, with runs of extremes to reach saturation.
+						input[i] = ((i / 64) % 4 == 3) ? ((i & 1) ? TypeTraits::TypeLimits::type_limits<ValueT>::Max() : TypeTraits::TypeLimits::type_limits<ValueT>::Min())
+							: (ValueT)NextRandom(seed);
+					}
+
+					FilterT filter;
+					StaticT blockFilter;
+					IntegerSignal::Filter::IFilter<ValueT>* reference = &filter;
+					filter.SetTaps(taps);
+					blockFilter.SetTaps(taps);
+					reference->Clear();
+					blockFilter.Clear();
+
+					ValueT output[BlockSize];
+					uint32_t n = 0;
+					while (n < count)
+					{
+						const uint32_t remaining = count - n;
+						const uint16_t length = (uint16_t)((remaining < (n % BlockSize) + 1) ? remaining : (n % BlockSize) + 1);
+						blockFilter.ProcessBlock(&input[n], output, length);
+
+						for (uint16_t i = 0; i < length; i++, n++)
+						{
+							const ValueT expected = Reference<ValueT, tap_t, Shifts, TapCount>(input, n, taps);
+							reference->Set(input[n]);
+							reference->Step();
+
+							if (reference->Get() != expected || output[i] != expected)
+							{
+								Serial.print(F("FIR mismatch taps="));
+								Serial.print(TapCount);
+								Serial.print(F(" n=")); Serial.print(n);
+								Serial.print(F(" step=")); IntegerSignal::Testing::PrintUInt64((uint64_t)reference->Get());
+								Serial.print(F(" block=")); IntegerSignal::Testing::PrintUInt64((uint64_t)output[i]);
+								Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64((uint64_t)expected);
+								Serial.println();
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				// A single tap is a plain Fraction() of the input.
+				static bool TestSingleTap()
+				{
+					using Q14 = FixedPoint::ScalarFraction::Fraction16;
+					static constexpr Q14::scalar_t tap = -12345;
+
+					Static::FirI16<1> filter;
+					filter.SetTaps(&tap);
+					filter.Clear();
+
+					for (int32_t x = INT16_MIN; x <= INT16_MAX; x += 7)
+					{
+						filter.Set((int16_t)x);
+						filter.Step();
+						if (filter.Get() != Q14::Fraction(tap, (int16_t)x))
+						{
+							Serial.print(F("FIR single tap mismatch x="));
+							Serial.println(x);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				// Clear(value) starts from the steady state of a constant input.
+				static bool TestClear()
+				{
+					static constexpr uint16_t TapCount = 9;
+					using Q14 = FixedPoint::ScalarFraction::Fraction16;
+					Q14::scalar_t taps[TapCount];
+					uint32_t seed = 42;
+					MakeTaps<Q14::scalar_t, TapCount>(taps, Q14::FRACTION_1X, seed, false);
+
+					FirI16<TapCount> filter;
+					filter.SetTaps(taps);
+					filter.Clear(1000);
+					const int16_t cleared = filter.Get();
+					filter.Set(1000);
+					filter.Step();
+
+					if (cleared != filter.Get())
+					{
+						Serial.println(F("FIR Clear steady state error."));
+						return false;
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting FIR filter tests..."));
+					bool pass = true;
+
+					using Q14 = FixedPoint::ScalarFraction::Fraction16;
+					using Q30 = FixedPoint::ScalarFraction::Fraction32;
+
+					pass &= TestSingleTap();
+					pass &= TestClear();
+
+					pass &= TestConvolution<FirI16<1>, Static::FirI16<1>, int16_t, Q14, 1, false>(MaxIterations);
+					pass &= TestConvolution<FirI16<7>, Static::FirI16<7>, int16_t, Q14, 7, false>(MaxIterations);
+					pass &= TestConvolution<FirI16<32>, Static::FirI16<32>, int16_t, Q14, 32, false>(MaxIterations);
+					pass &= TestConvolution<FirI16<45>, Static::FirI16<45>, int16_t, Q14, 45, false>(MaxIterations);
+					pass &= TestConvolution<FirI32<5>, Static::FirI32<5>, int32_t, Q30, 5, false>(MaxIterations);
+					pass &= TestConvolution<FirI32<27>, Static::FirI32<27>, int32_t, Q30, 27, false>(MaxIterations);
+
+					pass &= TestConvolution<SymmetricFirI16<2>, Static::SymmetricFirI16<2>, int16_t, Q14, 2, true>(MaxIterations);
+					pass &= TestConvolution<SymmetricFirI16<15>, Static::SymmetricFirI16<15>, int16_t, Q14, 15, true>(MaxIterations);
+					pass &= TestConvolution<SymmetricFirI16<40>, Static::SymmetricFirI16<40>, int16_t, Q14, 40, true>(MaxIterations);
+					pass &= TestConvolution<SymmetricFirI32<11>, Static::SymmetricFirI32<11>, int32_t, Q30, 11, true>(MaxIterations);
+					pass &= TestConvolution<SymmetricFirI32<24>, Static::SymmetricFirI32<24>, int32_t, Q30, 24, true>(MaxIterations);
+
+					if (pass) Serial.println(F("FIR filter tests PASSED."));
+					else      Serial.println(F("FIR filter tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
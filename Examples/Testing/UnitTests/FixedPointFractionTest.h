@@ -979,6 +979,198 @@ namespace IntegerSignal
 				}
 
 
+				// Edge values by edge scalars, including the negative products one short of a unit step.
+				template<typename Format, typename T, uint16_t BlockSize = 64>
+				static bool TestFractionBlockEdges(const typename Format::scalar_t minScalar, const typename Format::scalar_t maxScalar)
+				{
+					using scalar_t = typename Format::scalar_t;
+
+					const int64_t unit = (int64_t)Format::SCALAR_UNIT;
+					const T edgeValues[] = { 0, 1, (T)-1, TypeTraits::TypeLimits::type_limits<T>::Min(), TypeTraits::TypeLimits::type_limits<T>::Max(),
+						(T)(unit - 1), (T)(1 - unit), (T)(unit + 1), (T)(-1 - unit), (T)(unit / 2), (T)(-unit / 2) };
+					const scalar_t edgeScalars[] = { minScalar, maxScalar, 0, 1, (scalar_t)(minScalar < 0 ? -1 : 2), (scalar_t)(maxScalar - 1) };
+					const uint8_t valueCount = sizeof(edgeValues) / sizeof(edgeValues[0]);
+					const uint8_t scalarCount = sizeof(edgeScalars) / sizeof(edgeScalars[0]);
+
+					T values[BlockSize];
+					T output[BlockSize];
+					scalar_t scalars[BlockSize];
+
+					for (uint8_t s = 0; s < scalarCount; s++)
+					{
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							values[i] = edgeValues[i % valueCount];
+							scalars[i] = edgeScalars[(s + (i / valueCount)) % scalarCount];
+						}
+
+						FractionBlock(edgeScalars[s], values, output, BlockSize);
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							if (output[i] != Format::Fraction(edgeScalars[s], values[i]))
+							{
+								Serial.print(F("FractionBlock edge mismatch at i="));
+								Serial.println(i);
+								return false;
+							}
+						}
+
+						FractionBlock(scalars, values, output, BlockSize);
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							if (output[i] != Format::Fraction(scalars[i], values[i]))
+							{
+								Serial.print(F("FractionBlock (per-element) edge mismatch at i="));
+								Serial.println(i);
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				// FractionBlock must be bit-exact with Fraction, for a block scalar and per-element scalars.
+				// Odd block sizes cover the accelerated prefix and the portable tail.
+				template<typename Format, typename T, uint16_t BlockSize = 67>
+				static bool TestFractionBlock(const typename Format::scalar_t minScalar, const typename Format::scalar_t maxScalar, const uint32_t blocks)
+				{
+					using scalar_t = typename Format::scalar_t;
+
+					if (!TestFractionBlockEdges<Format, T>(minScalar, maxScalar))
+					{
+						return false;
+					}
+
+					T values[BlockSize];
+					T output[BlockSize];
+					scalar_t scalars[BlockSize];
+					uint32_t seed = 0x2468ACE;
+					const uint64_t scalarRange = (uint64_t)((int64_t)maxScalar - minScalar) + 1;
+
+					for (uint32_t b = 0; b < blocks; b++)
+					{
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							seed = (seed * 1103515245u) + 12345u;
+							values[i] = (T)(((uint64_t)seed << 32 | (seed >> 3)) >> (b % 24));
+							scalars[i] = (scalar_t)((int64_t)minScalar + (int64_t)((((uint64_t)seed * 2654435761u) >> 7) % scalarRange));
+						}
+						if (b % 4 == 0) scalars[0] = maxScalar;
+						if (b % 4 == 1) scalars[0] = minScalar;
+
+						const uint16_t count = BlockSize - (b % 19);
+
+						FractionBlock(scalars[0], values, output, count);
+						for (uint16_t i = 0; i < count; i++)
+						{
+							if (output[i] != Format::Fraction(scalars[0], values[i]))
+							{
+								Serial.print(F("FractionBlock mismatch at i="));
+								Serial.println(i);
+								return false;
+							}
+						}
+
+						FractionBlock(scalars, values, output, count);
+						for (uint16_t i = 0; i < count; i++)
+						{
+							if (output[i] != Format::Fraction(scalars[i], values[i]))
+							{
+								Serial.print(F("FractionBlock (per-element) mismatch at i="));
+								Serial.println(i);
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				// InterpolateBlock must be bit-exact with Interpolate, including in-place output.
+				template<typename Format, typename T, uint16_t BlockSize = 67>
+				static bool TestInterpolateBlock(const uint32_t blocks)
+				{
+					using scalar_t = typename Format::scalar_t;
+
+					T from[BlockSize];
+					T to[BlockSize];
+					T output[BlockSize];
+					scalar_t scalars[BlockSize];
+					uint32_t seed = 0x13579BD;
+
+					for (uint32_t b = 0; b < blocks; b++)
+					{
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							seed = (seed * 1103515245u) + 12345u;
+							from[i] = (T)(((uint64_t)seed << 32 | (seed >> 3)) >> (b % 24));
+							to[i] = (T)(((uint64_t)seed * 2654435761u) >> 11);
+							scalars[i] = (scalar_t)((((uint64_t)seed * 40503u) >> 5) % ((uint64_t)Format::SCALAR_UNIT + 1));
+						}
+						if (b % 4 == 0) scalars[0] = Format::SCALAR_UNIT;
+						if (b % 4 == 1) scalars[0] = 0;
+
+						const uint16_t count = BlockSize - (b % 19);
+
+						InterpolateBlock(scalars, from, to, output, count);
+						for (uint16_t i = 0; i < count; i++)
+						{
+							if (output[i] != Format::Interpolate(scalars[i], from[i], to[i]))
+							{
+								Serial.print(F("InterpolateBlock (per-element) mismatch at i="));
+								Serial.println(i);
+								return false;
+							}
+						}
+
+						for (uint16_t i = 0; i < count; i++)
+						{
+							output[i] = from[i];
+						}
+						InterpolateBlock(scalars[0], output, to, output, count);
+						for (uint16_t i = 0; i < count; i++)
+						{
+							if (output[i] != Format::Interpolate(scalars[0], from[i], to[i]))
+							{
+								Serial.print(F("InterpolateBlock mismatch at i="));
+								Serial.println(i);
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations>
+				static bool TestBlocks()
+				{
+					bool pass = true;
+					const uint32_t blocks = (MaxIterations / 500) + 16;
+
+					pass &= TestFractionBlock<UFraction8::Base, uint8_t>(0, UFraction8::FRACTION_1X, blocks);
+					pass &= TestFractionBlock<UFraction16::Base, uint16_t>(0, UFraction16::FRACTION_1X, blocks);
+					pass &= TestFractionBlock<UFraction16::Base, int16_t>(0, UFraction16::FRACTION_1X, blocks);
+					pass &= TestFractionBlock<UFraction32::Base, uint32_t>(0, UFraction32::FRACTION_1X, blocks);
+					pass &= TestFractionBlock<Fraction8::Base, int8_t>(Fraction8::FRACTION_1X_NEGATIVE, Fraction8::FRACTION_1X, blocks);
+					pass &= TestFractionBlock<Fraction16::Base, int16_t>(Fraction16::FRACTION_1X_NEGATIVE, Fraction16::FRACTION_1X, blocks);
+					pass &= TestFractionBlock<Fraction16::Base, int32_t>(Fraction16::FRACTION_1X_NEGATIVE, Fraction16::FRACTION_1X, blocks);
+					pass &= TestFractionBlock<Fraction32::Base, int32_t>(Fraction32::FRACTION_1X_NEGATIVE, Fraction32::FRACTION_1X, blocks);
+
+					pass &= TestInterpolateBlock<UFraction8::Base, uint8_t>(blocks);
+					pass &= TestInterpolateBlock<UFraction16::Base, uint16_t>(blocks);
+					pass &= TestInterpolateBlock<UFraction16::Base, int16_t>(blocks);
+					pass &= TestInterpolateBlock<UFraction32::Base, uint32_t>(blocks);
+
+					if (!pass)
+					{
+						Serial.println(F("Fraction block tests FAILED."));
+					}
+
+					return pass;
+				}
+
 				template<uint32_t MaxIterations = 50000, uint8_t maxError32 = 0>
 				static bool RunTests()
 				{
@@ -1004,6 +1196,8 @@ namespace IntegerSignal
 					pass &= TestFraction32Sample<MaxIterations>();
 					pass &= TestUFraction32Sample<MaxIterations>();
 
+					pass &= TestBlocks<MaxIterations>();
+
 					if (!pass)
 					{
 						Serial.println(F("FractionScale tests FAILED."));
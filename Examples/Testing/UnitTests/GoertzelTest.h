@@ -0,0 +1,236 @@
+#ifndef _GOERTZEL_TEST_h
+#define _GOERTZEL_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerTrigonometry16.h>
+
+namespace IntegerSignal
+{
+	namespace Spectrum
+	{
+		namespace Goertzel
+		{
+			// Goertzel bins must match a floating-point DFT at the same angle,
+			// banks must be bit-exact with single detectors, and tones must land in their bin.
+			namespace Test
+			{
+				using IntegerSignal::Testing::NextRandom;
+
+				template<typename ValueT>
+				static void MakeSignal(ValueT* data, const uint32_t count, const uint8_t type, uint32_t& seed)
+				{
+					const double amplitude = (double)TypeTraits::TypeLimits::type_limits<ValueT>::Max();
+					for (uint32_t i = 0; i < count; i++)
+					{
+						double value;
+						switch (type)
+						{
+						case 0:
+							// Full scale DC, the largest state growth.
+							value = 1.0;
+							break;
+						case 1:
+							value = (0.6 * sin(0.19 * i)) + (0.3 * cos(0.83 * i)) + ((double)(NextRandom(seed) % 1000) / 10000.0);
+							break;
+						default:
+							value = ((double)(NextRandom(seed) % 2000001) / 1000000.0) - 1.0;
+							break;
+						}
+						data[i] = (ValueT)(value * amplitude);
+					}
+				}
+
+				// Max |X| error against the DFT at the detector angle, relative to the full-scale bin Size * Max.
+				template<typename ValueT, typename DetectorT>
+				static bool TestAgainstDft(const uint32_t size, const double tolerance)
+				{
+					static constexpr uint8_t Angles = 6;
+					static ValueT data[4096];
+					const Trigonometry::angle_t angles[Angles] = { 0, GetAngle(1, size), GetAngle(7, size), GetAngle(size / 4, size), 12345, GetAngle(size / 2, size) };
+					const double pi = 3.14159265358979323846;
+					const double fullScale = (double)size * (double)TypeTraits::TypeLimits::type_limits<ValueT>::Max();
+
+					bool pass = true;
+					uint32_t seed = 0x6E27 + size;
+					for (uint8_t type = 0; type < 3; type++)
+					{
+						MakeSignal(data, size, type, seed);
+						for (uint8_t a = 0; a < Angles; a++)
+						{
+							const double w = 2.0 * pi * (double)angles[a] / 65536.0;
+							double re = 0, im = 0;
+							for (uint32_t n = 0; n < size; n++)
+							{
+								re += data[n] * cos(w * n);
+								im -= data[n] * sin(w * n);
+							}
+							const double expected = sqrt((re * re) + (im * im));
+
+							DetectorT detector(angles[a]);
+							detector.Clear();
+							detector.ProcessBlock(data, size);
+
+							typename DetectorT::state_t real, imaginary;
+							detector.GetComponents(real, imaginary);
+							const double magnitude = sqrt(((double)real * real) + ((double)imaginary * imaginary));
+							const double power = ldexp((double)detector.GetPower(), 2 * DetectorT::PowerShifts);
+							const double error = fabs(magnitude - expected) / fullScale;
+							const double powerError = fabs(sqrt(power) - magnitude) / fullScale;
+
+							if (error > tolerance || powerError > 0.00001)
+							{
+								Serial.print(F("Goertzel error size="));
+								Serial.print(size);
+								Serial.print(F(" type=")); Serial.print(type);
+								Serial.print(F(" angle=")); Serial.print(angles[a]);
+								Serial.print(F(" dft=")); Serial.print(error * 1000000.0);
+								Serial.print(F("ppm power=")); Serial.print(powerError * 1000000.0);
+								Serial.println(F("ppm"));
+								pass = false;
+							}
+						}
+					}
+
+					return pass;
+				}
+
+				// Bank bins equal single detectors, per sample and through ProcessBlock.
+				template<typename ValueT, typename DetectorT, typename BankT>
+				static bool TestBank(const uint32_t steps)
+				{
+					static constexpr uint16_t BlockSize = 37;
+
+					BankT bank;
+					DetectorT detectors[BankT::Bins];
+					for (uint8_t i = 0; i < BankT::Bins; i++)
+					{
+						const Trigonometry::angle_t angle = Trigonometry::angle_t(i * 2654435761u);
+						bank.SetAngle(i, angle);
+						detectors[i].SetAngle(angle);
+						detectors[i].Clear();
+					}
+					bank.Clear();
+
+					uint32_t seed = 0xBA2C;
+					ValueT input[BlockSize];
+					for (uint32_t n = 0; n < steps; n += BlockSize)
+					{
+						for (uint16_t i = 0; i < BlockSize; i++)
+						{
+							input[i] = (ValueT)NextRandom(seed);
+						}
+
+						bank.ProcessBlock(input, BlockSize);
+						for (uint8_t b = 0; b < BankT::Bins; b++)
+						{
+							for (uint16_t i = 0; i < BlockSize; i++)
+							{
+								detectors[b].Push(input[i]);
+							}
+
+							typename DetectorT::state_t re0, im0, re1, im1;
+							bank.GetComponents(b, re0, im0);
+							detectors[b].GetComponents(re1, im1);
+							if (re0 != re1 || im0 != im1 || bank.GetPower(b) != detectors[b].GetPower())
+							{
+								Serial.print(F("Goertzel bank mismatch bin="));
+								Serial.print(b);
+								Serial.print(F(" n=")); Serial.println(n);
+								return false;
+							}
+						}
+
+						// Restart the blocks regularly, the state grows with the block length.
+						if ((n / BlockSize) % 16 == 15)
+						{
+							bank.Clear();
+							for (uint8_t b = 0; b < BankT::Bins; b++)
+							{
+								detectors[b].Clear();
+							}
+						}
+					}
+
+					return true;
+				}
+
+				// DTMF row and column tones, 205 samples at 8 kHz: only the two tone bins stand out.
+				template<typename ValueT, typename BankT>
+				static bool TestTones()
+				{
+					static constexpr uint32_t SampleRate = 8000;
+					static constexpr uint16_t Size = 205;
+					static const uint16_t Frequencies[8] = { 697, 770, 852, 941, 1209, 1336, 1477, 1633 };
+					const double pi = 3.14159265358979323846;
+					const double amplitude = 0.45 * (double)TypeTraits::TypeLimits::type_limits<ValueT>::Max();
+
+					BankT bank;
+					for (uint8_t i = 0; i < 8; i++)
+					{
+						bank.SetFrequency(i, Frequencies[i], SampleRate);
+					}
+
+					ValueT data[Size];
+					for (uint8_t row = 0; row < 4; row++)
+					{
+						for (uint8_t column = 4; column < 8; column++)
+						{
+							for (uint16_t n = 0; n < Size; n++)
+							{
+								data[n] = (ValueT)(amplitude * (sin(2.0 * pi * Frequencies[row] * n / SampleRate)
+									+ sin(2.0 * pi * Frequencies[column] * n / SampleRate)));
+							}
+
+							bank.Clear();
+							bank.ProcessBlock(data, Size);
+							uint64_t power[8];
+							bank.GetPower(power);
+
+							const uint64_t threshold = ((power[row] < power[column]) ? power[row] : power[column]) / 8;
+							for (uint8_t i = 0; i < 8; i++)
+							{
+								if (i != row && i != column && power[i] > threshold)
+								{
+									Serial.print(F("Goertzel tone error row="));
+									Serial.print(row);
+									Serial.print(F(" column=")); Serial.print(column);
+									Serial.print(F(" bin=")); Serial.println(i);
+									return false;
+								}
+							}
+						}
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting Goertzel tests..."));
+					bool pass = true;
+
+					// Long full-scale blocks near DC are the most sensitive to the coefficient rounding.
+					pass &= TestAgainstDft<int16_t, GoertzelI16>(64, 0.00005);
+					pass &= TestAgainstDft<int16_t, GoertzelI16>(205, 0.00005);
+					pass &= TestAgainstDft<int16_t, GoertzelI16>(4096, 0.0002);
+					pass &= TestAgainstDft<int32_t, GoertzelI32>(64, 0.00005);
+					pass &= TestAgainstDft<int32_t, GoertzelI32>(1000, 0.00005);
+					pass &= TestAgainstDft<int32_t, GoertzelI32>(4096, 0.0002);
+
+					pass &= TestBank<int16_t, GoertzelI16, GoertzelBankI16<5>>(MaxIterations);
+					pass &= TestBank<int32_t, GoertzelI32, GoertzelBankI32<3>>(MaxIterations);
+
+					pass &= TestTones<int16_t, GoertzelBankI16<8>>();
+					pass &= TestTones<int32_t, GoertzelBankI32<8>>();
+
+					if (pass) Serial.println(F("Goertzel tests PASSED."));
+					else      Serial.println(F("Goertzel tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
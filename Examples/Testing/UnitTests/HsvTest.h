@@ -0,0 +1,106 @@
+#ifndef _HSV_TEST_h
+#define _HSV_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Hsv
+	{
+		// Block conversions must be bit-exact with ColorHsvFraction(),
+		// planar and interleaved, for any row length.
+		namespace Test
+		{
+			static constexpr uint16_t RowSize = 43;
+
+			static ufraction16_t NextFraction(uint32_t& seed, const uint8_t mode)
+			{
+				seed = (seed * 1103515245u) + 12345u;
+				const uint16_t random = (uint16_t)(seed >> 13);
+
+				switch (mode % 4)
+				{
+				case 0: return random % (UFraction16::FRACTION_1X + 1);
+				case 1: return (random & 1) ? UFraction16::FRACTION_1X : 0;
+				case 2: return random & 0x7;
+				default: return random;
+				}
+			}
+
+			template<typename color_t, typename ColorFunc, typename PlanarFunc, typename InterleavedFunc>
+			static bool TestBlocks(const uint32_t rows, const char* name, ColorFunc&& colorFunc, PlanarFunc&& planarFunc, InterleavedFunc&& interleavedFunc)
+			{
+				ufraction16_t hue[RowSize];
+				ufraction16_t saturation[RowSize];
+				ufraction16_t value[RowSize];
+				ufraction16_t hsv[RowSize * 3];
+				color_t planar[RowSize];
+				color_t interleaved[RowSize];
+				uint32_t seed = 0x13579BD;
+
+				for (uint32_t r = 0; r < rows; r++)
+				{
+					const uint16_t count = r % (RowSize + 1);
+					for (uint16_t i = 0; i < count; i++)
+					{
+						hue[i] = NextFraction(seed, r);
+						saturation[i] = NextFraction(seed, r >> 2);
+						value[i] = NextFraction(seed, r >> 4);
+						hsv[i * 3] = hue[i];
+						hsv[(i * 3) + 1] = saturation[i];
+						hsv[(i * 3) + 2] = value[i];
+					}
+
+					planarFunc(hue, saturation, value, planar, count);
+					interleavedFunc(hsv, interleaved, count);
+
+					for (uint16_t i = 0; i < count; i++)
+					{
+						const color_t expected = colorFunc(hue[i], saturation[i], value[i]);
+						if (planar[i] != expected || interleaved[i] != expected)
+						{
+							Serial.print(name);
+							Serial.print(F(" HSV block mismatch h="));
+							Serial.print(hue[i]);
+							Serial.print(F(" s=")); Serial.print(saturation[i]);
+							Serial.print(F(" v=")); Serial.print(value[i]);
+							Serial.print(F(" planar=")); IntegerSignal::Testing::PrintUInt64(planar[i]);
+							Serial.print(F(" interleaved=")); IntegerSignal::Testing::PrintUInt64(interleaved[i]);
+							Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64(expected);
+							Serial.println();
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
+
+			template<uint32_t MaxIterations = 50000>
+			static bool RunTests()
+			{
+				Serial.println(F("Starting HSV block tests..."));
+				bool pass = true;
+
+				const uint32_t rows = (MaxIterations / 4) + 64;
+
+				pass &= TestBlocks<Rgb8::color_t>(rows, "Rgb8",
+					[](const ufraction16_t h, const ufraction16_t s, const ufraction16_t v) { return Rgb8::ColorHsvFraction(h, s, v); },
+					[](const ufraction16_t* h, const ufraction16_t* s, const ufraction16_t* v, Rgb8::color_t* output, const size_t count) { Rgb8::ColorHsvFractionBlock(h, s, v, output, count); },
+					[](const ufraction16_t* hsv, Rgb8::color_t* output, const size_t count) { Rgb8::ColorHsvFractionBlock(hsv, output, count); });
+
+				pass &= TestBlocks<Rgb10::color_t>(rows, "Rgb10",
+					[](const ufraction16_t h, const ufraction16_t s, const ufraction16_t v) { return Rgb10::ColorHsvFraction(h, s, v); },
+					[](const ufraction16_t* h, const ufraction16_t* s, const ufraction16_t* v, Rgb10::color_t* output, const size_t count) { Rgb10::ColorHsvFractionBlock(h, s, v, output, count); },
+					[](const ufraction16_t* hsv, Rgb10::color_t* output, const size_t count) { Rgb10::ColorHsvFractionBlock(hsv, output, count); });
+
+				if (pass) Serial.println(F("HSV block tests PASSED."));
+				else      Serial.println(F("HSV block tests FAILED."));
+
+				return pass;
+			}
+		}
+	}
+}
+#endif
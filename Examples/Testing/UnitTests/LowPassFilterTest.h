@@ -541,6 +541,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::LowPassU8<4>;
 						pass &= TestClearAndDC<F, uint8_t>(123);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint8_t>(F("LowPass"), 123, 256);
 						pass &= TestStepMonotonic<F, uint8_t>(0, 200, 1024, true);
 						pass &= TestLinearity<F, uint8_t>(85, 3, Tol);     // 0..85 scaled by 3 fits in 8-bit
 						pass &= TestSaturation<F, uint8_t>(UINT8_MAX, 1024);
@@ -605,6 +606,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::LowPassU16<8>;
 						pass &= TestClearAndDC<F, uint16_t>(43210);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint16_t>(F("LowPass"), 43210, 256);
 						pass &= TestStepMonotonic<F, uint16_t>(0, 60000, 4096, true);
 						pass &= TestSaturation<F, uint16_t>(UINT16_MAX, 4096);
 					}
@@ -625,6 +627,7 @@ namespace IntegerSignal
 					{
 						using F = IntegerSignal::Filters::LowPassU32<8>;
 						pass &= TestClearAndDC<F, uint32_t>(3000000000u);
+						pass &= IntegerSignal::Testing::TestProcessBlock<F, uint32_t>(F("LowPass"), 3000000000u, 256);
 						pass &= TestStepMonotonic<F, uint32_t>(0u, 4294967295u, 8192, true);
 						pass &= TestSaturation<F, uint32_t>(UINT32_MAX, 8192);
 					}
@@ -0,0 +1,99 @@
+#ifndef _LUT_TEST_h
+#define _LUT_TEST_h
+
+#include <IntegerSignalTesting.h>
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace Lut
+		{
+			namespace Test
+			{
+#if (__cplusplus >= 201402L)
+				static bool CompareTables(const uint16_t* generated, const uint16_t* reference, const uint16_t size)
+				{
+					for (uint16_t i = 0; i < size; i++)
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						const uint16_t value = pgm_read_word(&reference[i]);
+#else
+						const uint16_t value = reference[i];
+#endif
+						if (generated[i] != value)
+						{
+							Serial.print(F("LUT mismatch: size="));
+							Serial.print(size);
+							Serial.print(F(" i="));
+							Serial.print(i);
+							Serial.print(F(" generated="));
+							Serial.print(generated[i]);
+							Serial.print(F(" reference="));
+							Serial.println(value);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+#if !defined(ARDUINO_ARCH_AVR)
+				// Generated tables must match the runtime double Generator, for any size (requires 64-bit double).
+				template<uint16_t Size>
+				static bool TestAgainstGenerator()
+				{
+					static constexpr TableGenerator::Sine16Table<Size> sine{};
+					static constexpr TableGenerator::Tangent16Table<Size> tangent{};
+
+					uint16_t sineReference[Size];
+					uint16_t tangentReference[Size];
+					for (uint16_t i = 0; i < Size; i++)
+					{
+						sineReference[i] = Generator::GetSineUnit16((90.0 * (double)i) / (double)Size);
+						tangentReference[i] = Generator::GetTangentUnit16((45.0 * (double)i) / (double)Size);
+					}
+
+					return CompareTables(sine.Table, sineReference, Size)
+						&& CompareTables(tangent.Table, tangentReference, Size);
+				}
+#endif
+#endif
+
+				static bool RunTests()
+				{
+#if (__cplusplus >= 201402L)
+					Serial.println(F("Starting LUT generator tests..."));
+					bool pass = true;
+
+#if (INTEGER_TRIGONOMETRY_LUT == INTEGER_TRIGONOMETRY_LUT_DEFAULT)
+					// Compile-time tables must be bit-identical to the hand-pasted 256 item tables.
+					static constexpr TableGenerator::Sine16Table<Sine16::LutSize> sine{};
+					static constexpr TableGenerator::Tangent16Table<Tangent16::LutSize> tangent{};
+					pass &= CompareTables(sine.Table, Sine16::Table, Sine16::LutSize);
+					pass &= CompareTables(tangent.Table, Tangent16::Table, Tangent16::LutSize);
+#endif
+
+#if !defined(ARDUINO_ARCH_AVR)
+					pass &= TestAgainstGenerator<64>();
+					pass &= TestAgainstGenerator<256>();
+					pass &= TestAgainstGenerator<1024>();
+					pass &= TestAgainstGenerator<4096>();
+#endif
+
+					if (pass) Serial.println(F("LUT generator tests PASSED."));
+					else      Serial.println(F("LUT generator tests FAILED."));
+
+					return pass;
+#else
+					// The compile-time tables require C++14.
+					Serial.println(F("LUT generator tests SKIPPED (C++11)."));
+
+					return true;
+#endif
+				}
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,151 @@
+#ifndef _MEDIAN_FILTER_TEST_h
+#define _MEDIAN_FILTER_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Median
+		{
+			// Median filters must match a full sort of the last window inputs,
+			// per-sample and through ProcessBlock, for network and sorted-window kernels.
+			namespace Test
+			{
+				using IntegerSignal::Testing::NextRandom;
+
+				template<typename ValueT, uint8_t Window>
+				static ValueT ReferenceMedian(const ValueT* history)
+				{
+					ValueT sorted[Window];
+					for (uint8_t i = 0; i < Window; i++)
+					{
+						sorted[i] = history[i];
+					}
+
+					// Insertion sort.
+					for (uint8_t i = 1; i < Window; i++)
+					{
+						const ValueT value = sorted[i];
+						uint8_t j = i;
+						while (j > 0 && sorted[j - 1] > value)
+						{
+							sorted[j] = sorted[j - 1];
+							j--;
+						}
+						sorted[j] = value;
+					}
+
+					return sorted[Window / 2];
+				}
+
+				template<typename ValueT, uint8_t Window>
+				static bool TestAgainstReference(const ValueT init, const uint32_t steps)
+				{
+					static constexpr uint16_t BlockSize = 20;
+
+					Template::Filter<ValueT, Window> filter;
+					Template::StaticFilter<ValueT, Window> blockFilter;
+					IntegerSignal::Filter::IFilter<ValueT>* stepFilter = &filter;
+					filter.Clear(init);
+					blockFilter.Clear(init);
+
+					ValueT history[Window];
+					for (uint8_t i = 0; i < Window; i++)
+					{
+						history[i] = init;
+					}
+
+					uint32_t seed = 0x3ED1 + Window;
+					ValueT input[BlockSize];
+					ValueT output[BlockSize];
+					uint32_t n = 0;
+					while (n < steps)
+					{
+						const uint16_t length = (uint16_t)(1 + (n % BlockSize));
+						for (uint16_t i = 0; i < length; i++)
+						{
+							// Alternate full range and few distinct values, for many duplicates.
+							const uint32_t random = NextRandom(seed);
+							input[i] = (((n + i) / 200) & 1) ? (ValueT)(random % 5) : (ValueT)random;
+						}
+						blockFilter.ProcessBlock(input, output, length);
+
+						for (uint16_t i = 0; i < length; i++, n++)
+						{
+							history[n % Window] = input[i];
+							const ValueT expected = ReferenceMedian<ValueT, Window>(history);
+
+							stepFilter->Set(input[i]);
+							stepFilter->Step();
+
+							if (stepFilter->Get() != expected || output[i] != expected)
+							{
+								Serial.print(F("Median mismatch window="));
+								Serial.print(Window);
+								Serial.print(F(" n=")); Serial.print(n);
+								Serial.print(F(" step=")); IntegerSignal::Testing::PrintUInt64((uint64_t)stepFilter->Get());
+								Serial.print(F(" block=")); IntegerSignal::Testing::PrintUInt64((uint64_t)output[i]);
+								Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64((uint64_t)expected);
+								Serial.println();
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				// Isolated spikes shorter than half the window are removed entirely.
+				template<typename FilterT>
+				static bool TestSpikeRejection()
+				{
+					FilterT filter;
+					filter.Clear(-1000);
+
+					for (uint16_t i = 0; i < 500; i++)
+					{
+						const int16_t spike = (i % 11 == 0) ? INT16_MAX : ((i % 13 == 0) ? INT16_MIN : -1000);
+						filter.Set(spike);
+						filter.Step();
+						if (filter.Get() != -1000)
+						{
+							Serial.println(F("Median spike rejection error."));
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting Median filter tests..."));
+					bool pass = true;
+
+					pass &= TestAgainstReference<uint8_t, 3>(0, MaxIterations);
+					pass &= TestAgainstReference<uint8_t, 5>(UINT8_MAX, MaxIterations);
+					pass &= TestAgainstReference<int16_t, 7>(-5, MaxIterations);
+					pass &= TestAgainstReference<uint16_t, 9>(1234, MaxIterations);
+					pass &= TestAgainstReference<int32_t, 9>(INT32_MIN, MaxIterations);
+					pass &= TestAgainstReference<uint8_t, 11>(7, MaxIterations);
+					pass &= TestAgainstReference<int16_t, 31>(0, MaxIterations);
+					pass &= TestAgainstReference<uint32_t, 63>(UINT32_MAX, MaxIterations);
+					pass &= TestAgainstReference<int8_t, 63>(INT8_MIN, MaxIterations);
+
+					pass &= TestSpikeRejection<MedianI16<5>>();
+					pass &= TestSpikeRejection<Static::MedianI16<15>>();
+
+					if (pass) Serial.println(F("Median filter tests PASSED."));
+					else      Serial.println(F("Median filter tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,130 @@
+#ifndef _MOVING_AVERAGE_FILTER_TEST_h
+#define _MOVING_AVERAGE_FILTER_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace MovingAverage
+		{
+			// Moving averages must match the rounded mean of the last 2^factor inputs,
+			// per-sample and through ProcessBlock, from any Clear(value).
+			namespace Test
+			{
+				using IntegerSignal::Testing::NextRandom;
+
+				template<typename ValueT, uint8_t Factor>
+				static bool TestAgainstReference(const ValueT init, const uint32_t steps)
+				{
+					static constexpr uint16_t Window = uint16_t(1) << Factor;
+					static constexpr uint16_t BlockSize = 24;
+
+					Template::Filter<ValueT, Factor> filter;
+					Template::StaticFilter<ValueT, Factor> blockFilter;
+					IntegerSignal::Filter::IFilter<ValueT>* stepFilter = &filter;
+					filter.Clear(init);
+					blockFilter.Clear(init);
+
+					if (filter.Get() != init || blockFilter.Get() != init)
+					{
+						Serial.println(F("MovingAverage Clear error."));
+						return false;
+					}
+
+					ValueT history[Window];
+					for (uint16_t i = 0; i < Window; i++)
+					{
+						history[i] = init;
+					}
+
+					uint32_t seed = 0xB0C5 + Factor;
+					ValueT input[BlockSize];
+					ValueT output[BlockSize];
+					uint32_t n = 0;
+					while (n < steps)
+					{
+						const uint16_t length = (uint16_t)(1 + (n % BlockSize));
+						for (uint16_t i = 0; i < length; i++)
+						{
+							// Random, with runs of full scale.
+							input[i] = (((n + i) / 256) % 4 == 1) ? TypeTraits::TypeLimits::type_limits<ValueT>::Max() : (ValueT)NextRandom(seed);
+						}
+						blockFilter.ProcessBlock(input, output, length);
+
+						for (uint16_t i = 0; i < length; i++, n++)
+						{
+							history[n % Window] = input[i];
+							uint64_t sum = 0;
+							for (uint16_t k = 0; k < Window; k++)
+							{
+								sum += history[k];
+							}
+							const ValueT expected = (ValueT)((sum + (Window >> 1)) >> Factor);
+
+							stepFilter->Set(input[i]);
+							stepFilter->Step();
+
+							if (stepFilter->Get() != expected || output[i] != expected)
+							{
+								Serial.print(F("MovingAverage mismatch factor="));
+								Serial.print(Factor);
+								Serial.print(F(" n=")); Serial.print(n);
+								Serial.print(F(" step=")); IntegerSignal::Testing::PrintUInt64(stepFilter->Get());
+								Serial.print(F(" block=")); IntegerSignal::Testing::PrintUInt64(output[i]);
+								Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64(expected);
+								Serial.println();
+								return false;
+							}
+						}
+					}
+
+					return true;
+				}
+
+				// Signed wrapper settles exactly on a constant negative input after one window.
+				static bool TestSigned()
+				{
+					Static::MovingAverageI16<5> filter;
+					filter.Clear();
+					for (uint8_t i = 0; i < 32; i++)
+					{
+						filter.Set(-12345);
+						filter.Step();
+					}
+
+					if (filter.Get() != -12345)
+					{
+						Serial.println(F("MovingAverage signed error."));
+						return false;
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting MovingAverage filter tests..."));
+					bool pass = true;
+
+					pass &= TestAgainstReference<uint8_t, 1>(0, MaxIterations);
+					pass &= TestAgainstReference<uint8_t, 8>(UINT8_MAX, MaxIterations);
+					pass &= TestAgainstReference<uint16_t, 4>(1234, MaxIterations);
+					pass &= TestAgainstReference<uint16_t, 7>(UINT16_MAX, MaxIterations);
+					pass &= TestAgainstReference<uint32_t, 3>(0, MaxIterations);
+					pass &= TestAgainstReference<uint32_t, 10>(UINT32_MAX, MaxIterations);
+					pass &= TestSigned();
+
+					if (pass) Serial.println(F("MovingAverage filter tests PASSED."));
+					else      Serial.println(F("MovingAverage filter tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
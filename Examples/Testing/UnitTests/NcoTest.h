@@ -0,0 +1,126 @@
+#ifndef _NCO_TEST_h
+#define _NCO_TEST_h
+
+#include <IntegerSignalTesting.h>
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace NcoTest
+		{
+			// Nco blocks must match Sine/Cosine of the truncated phase, sample by sample and across blocks.
+			static bool TestBlocksAgainstScalar(const uint32_t tuningWord, const uint32_t startPhase, const uint32_t blocks)
+			{
+				static constexpr uint16_t BlockSize = 77; // Not a multiple of the Nco chunk size.
+
+				Nco nco16(tuningWord, startPhase);
+				Nco nco32(tuningWord, startPhase);
+				Nco quadrature16(tuningWord, startPhase);
+				Nco quadrature32(tuningWord, startPhase);
+
+				fraction16_t sine16[BlockSize];
+				fraction16_t iq16[2][BlockSize];
+				Fraction32::scalar_t sine32[BlockSize];
+				Fraction32::scalar_t iq32[2][BlockSize];
+
+				uint32_t phase = startPhase;
+				for (uint32_t b = 0; b < blocks; b++)
+				{
+					const uint16_t count = (b * 13) % (BlockSize + 1);
+
+					nco16.Sine16Block(sine16, count);
+					nco32.Sine32Block(sine32, count);
+					quadrature16.Quadrature16Block(iq16[0], iq16[1], count);
+					quadrature32.Quadrature32Block(iq32[0], iq32[1], count);
+
+					for (uint16_t i = 0; i < count; i++)
+					{
+						const angle_t angle = angle_t(phase >> 16);
+						phase += tuningWord;
+
+						if (sine16[i] != Sine16(angle)
+							|| sine32[i] != Sine32(angle)
+							|| iq16[0][i] != Sine16(angle)
+							|| iq16[1][i] != Cosine16(angle)
+							|| iq32[0][i] != Sine32(angle)
+							|| iq32[1][i] != Cosine32(angle))
+						{
+							Serial.print(F("Nco block error: tuning="));
+							Serial.print(tuningWord);
+							Serial.print(F(" block="));
+							Serial.print(b);
+							Serial.print(F(" i="));
+							Serial.println(i);
+							return false;
+						}
+					}
+
+					if (nco16.GetPhase() != phase
+						|| quadrature32.GetPhase() != phase)
+					{
+						Serial.print(F("Nco phase error: block="));
+						Serial.println(b);
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			static bool TestScalarAccess()
+			{
+				Nco nco;
+				nco.SetFrequency(1000, 48000);
+				if (nco.GetTuningWord() != Nco::GetTuningWord(1000, 48000)
+					|| nco.GetTuningWord() != (uint32_t)((uint64_t(1000) << 32) / 48000))
+				{
+					Serial.println(F("Nco tuning word error."));
+					return false;
+				}
+
+				for (uint16_t i = 0; i < 1000; i++)
+				{
+					const angle_t angle = nco.GetAngle();
+					if (nco.GetSine16() != Sine16(angle)
+						|| nco.GetCosine16() != Cosine16(angle)
+						|| nco.GetSine32() != Sine32(angle)
+						|| nco.GetCosine32() != Cosine32(angle))
+					{
+						Serial.print(F("Nco scalar error: angle="));
+						Serial.println(angle);
+						return false;
+					}
+					nco.Step();
+				}
+
+				nco.SetAngle(ANGLE_90);
+				if (nco.GetAngle() != ANGLE_90 || nco.GetSine16() != Fraction16::FRACTION_1X)
+				{
+					Serial.println(F("Nco SetAngle error."));
+					return false;
+				}
+
+				return true;
+			}
+
+			static bool RunTests()
+			{
+				Serial.println(F("Starting Nco tests..."));
+				bool pass = true;
+
+				pass &= TestScalarAccess();
+				pass &= TestBlocksAgainstScalar(Nco::GetTuningWord(1000, 48000), 0, 200);
+				pass &= TestBlocksAgainstScalar(Nco::GetTuningWord(23999, 48000), 0x12345678, 200);
+				pass &= TestBlocksAgainstScalar(0x9E3779B9, UINT32_MAX, 200);
+				pass &= TestBlocksAgainstScalar(0, 0x80000000, 10);
+
+				if (pass) Serial.println(F("Nco tests PASSED."));
+				else      Serial.println(F("Nco tests FAILED."));
+
+				return pass;
+			}
+		}
+	}
+}
+#endif
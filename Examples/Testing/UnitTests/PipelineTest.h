@@ -0,0 +1,253 @@
+#ifndef _PIPELINE_TEST_h
+#define _PIPELINE_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Pipelines
+		{
+			// Pipelines must be bit-exact with their stages run one after the other.
+			namespace Test
+			{
+				using FirstFilterU16 = Static::LowPassU16<3>;
+				using SecondFilterU16 = Static::EmaU16<4>;
+				using LimitCurveU16 = Curves::LimitU16<1000, 60000>;
+				using PowerCurveU16 = Curves::Power2U16<>;
+
+				using PipelineTypeU16 = PipelineU16<FirstFilterU16, SecondFilterU16, LimitCurveU16, PowerCurveU16>;
+
+				// Manual chain: LowPass -> Ema -> Limit curve -> Power2 curve.
+				struct ReferenceU16
+				{
+					FirstFilterU16 First;
+					SecondFilterU16 Second;
+
+					void Clear()
+					{
+						First.Clear();
+						Second.Clear();
+					}
+
+					uint16_t Apply(const uint16_t input)
+					{
+						First.Set(input);
+						First.Step();
+						Second.Set(First.Get());
+						Second.Step();
+
+						return PowerCurveU16::Get(LimitCurveU16::Get(Second.Get()));
+					}
+				};
+
+				static uint16_t NextInput(uint32_t& seed, const uint8_t shift)
+				{
+					seed = (seed * 1103515245u) + 12345u;
+					return (uint16_t)(seed >> (8 + (shift % 16)));
+				}
+
+				// Per-sample and in-place block processing, including state carried across blocks.
+				template<uint16_t BlockSize = 64>
+				static bool TestEquivalence(const uint32_t blocks)
+				{
+					PipelineTypeU16 pipeline;
+					ReferenceU16 reference;
+					pipeline.Clear();
+					reference.Clear();
+
+					uint16_t buffer[BlockSize];
+					uint16_t input[BlockSize];
+					uint32_t seed = 0x1234567;
+
+					for (uint32_t b = 0; b < blocks; b++)
+					{
+						const uint16_t count = b % (BlockSize + 1);
+						for (uint16_t i = 0; i < count; i++)
+						{
+							input[i] = NextInput(seed, b);
+							buffer[i] = input[i];
+						}
+
+						if (b & 1)
+						{
+							pipeline.ProcessBlock(buffer, buffer, count);
+						}
+						else
+						{
+							for (uint16_t i = 0; i < count; i++)
+							{
+								pipeline.Set(buffer[i]);
+								pipeline.Step();
+								buffer[i] = pipeline.Get();
+							}
+						}
+
+						for (uint16_t i = 0; i < count; i++)
+						{
+							const uint16_t expected = reference.Apply(input[i]);
+							if (buffer[i] != expected)
+							{
+								Serial.print(F("Pipeline mismatch at block "));
+								Serial.print(b);
+								Serial.print(F(" i=")); Serial.print(i);
+								Serial.print(F(" got=")); Serial.print(buffer[i]);
+								Serial.print(F(" ref=")); Serial.println(expected);
+								return false;
+							}
+						}
+
+						if (count > 0 && pipeline.Get() != buffer[count - 1])
+						{
+							Serial.print(F("Pipeline state mismatch at block "));
+							Serial.println(b);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				// Nested pipelines, signed and IFilter stages compose like any other filter.
+				template<uint32_t Steps>
+				static bool TestComposition()
+				{
+					using Inner = PipelineU16<FirstFilterU16, SecondFilterU16>;
+					using Nested = PipelineU16<Inner, LimitCurveU16, PowerCurveU16>;
+					using Mixed = PipelineU16<Filters::LowPassU16<3>, StrengthU16<SecondFilterU16, 255>, LimitCurveU16, PowerCurveU16>;
+
+					PipelineTypeU16 flat;
+					Nested nested;
+					Mixed mixed;
+					IntegerSignal::Filter::Template::Interface<PipelineTypeU16, uint16_t> adapted;
+					IntegerSignal::Filter::IFilter<uint16_t>* runtime = &adapted;
+					flat.Clear();
+					nested.Clear();
+					mixed.Clear();
+					runtime->Clear();
+
+					PipelineI16<Static::EmaI16<4>, Static::LowPassI16<2>> signedPipeline;
+					Static::EmaI16<4> signedFirst;
+					Static::LowPassI16<2> signedSecond;
+					signedPipeline.Clear();
+					signedFirst.Clear();
+					signedSecond.Clear();
+
+					uint32_t seed = 0x89ABCDE;
+					for (uint32_t i = 0; i < Steps; i++)
+					{
+						const uint16_t input = NextInput(seed, i);
+
+						flat.Set(input);
+						flat.Step();
+						nested.Set(input);
+						nested.Step();
+						mixed.Set(input);
+						mixed.Step();
+						runtime->Set(input);
+						runtime->Step();
+
+						if (nested.Get() != flat.Get()
+							|| mixed.Get() != flat.Get()
+							|| runtime->Get() != flat.Get())
+						{
+							Serial.print(F("Pipeline composition mismatch at step "));
+							Serial.println(i);
+							return false;
+						}
+
+						signedFirst.Set((int16_t)input);
+						signedFirst.Step();
+						signedSecond.Set(signedFirst.Get());
+						signedSecond.Step();
+						signedPipeline.Set((int16_t)input);
+						signedPipeline.Step();
+						if (signedPipeline.Get() != signedSecond.Get())
+						{
+							Serial.print(F("Signed pipeline mismatch at step "));
+							Serial.println(i);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				// Clear(value) starts every stage from the steady state of the stage before it.
+				template<uint32_t Steps>
+				static bool TestClearValue(const uint16_t value)
+				{
+					using Inner = PipelineU16<FirstFilterU16, SecondFilterU16>;
+					using Nested = PipelineU16<Inner, LimitCurveU16, PowerCurveU16>;
+
+					PipelineTypeU16 pipeline;
+					Nested nested;
+					IntegerSignal::Filter::Template::Interface<PipelineTypeU16, uint16_t> adapted;
+					ReferenceU16 reference;
+
+					pipeline.Clear(value);
+					nested.Clear(value);
+					adapted.Clear(value);
+					reference.First.Clear(value);
+					reference.Second.Clear(reference.First.Get());
+
+					const uint16_t steady = PowerCurveU16::Get(LimitCurveU16::Get(reference.Second.Get()));
+					if (pipeline.Get() != steady
+						|| nested.Get() != steady
+						|| adapted.Get() != steady)
+					{
+						Serial.print(F("Pipeline Clear(value) mismatch for "));
+						Serial.println(value);
+						return false;
+					}
+
+					uint32_t seed = 0x5A5A5A5;
+					for (uint32_t i = 0; i < Steps; i++)
+					{
+						const uint16_t input = NextInput(seed, i);
+
+						pipeline.Set(input);
+						pipeline.Step();
+						nested.Set(input);
+						nested.Step();
+						adapted.Set(input);
+						adapted.Step();
+
+						const uint16_t expected = reference.Apply(input);
+						if (pipeline.Get() != expected
+							|| nested.Get() != expected
+							|| adapted.Get() != expected)
+						{
+							Serial.print(F("Pipeline after Clear(value) mismatch at step "));
+							Serial.println(i);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting Pipeline tests..."));
+					bool pass = true;
+
+					pass &= TestEquivalence((MaxIterations / 256) + 65);
+					pass &= TestComposition<MaxIterations / 10>();
+					pass &= TestClearValue<MaxIterations / 10>(0);
+					pass &= TestClearValue<MaxIterations / 10>(12345);
+					pass &= TestClearValue<MaxIterations / 10>(UINT16_MAX);
+
+					if (pass) Serial.println(F("Pipeline tests PASSED."));
+					else      Serial.println(F("Pipeline tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
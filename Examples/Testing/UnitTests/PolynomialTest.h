@@ -0,0 +1,123 @@
+#ifndef _POLYNOMIAL_TEST_h
+#define _POLYNOMIAL_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerTrigonometry.h>
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace Polynomial
+		{
+			// Table-free Sine, Cosine and Tangent must match sin, cos and tan for every angle_t.
+			namespace Test
+			{
+				static double ToRadians(const angle_t angle)
+				{
+					return (double)angle * (2.0 * M_PI) / 65536.0;
+				}
+
+				static bool Report(const char* name, const double error, const double maxError)
+				{
+					if (error > maxError)
+					{
+						Serial.print(name);
+						Serial.print(F(" error="));
+						Serial.println(error);
+						return false;
+					}
+
+					return true;
+				}
+
+				// Every angle_t, sine and cosine within 1 LSB of the rounded reference.
+				static bool TestSineCosineExhaustive()
+				{
+					double sine8 = 0, sine16 = 0, sine32 = 0;
+					double cosine8 = 0, cosine16 = 0, cosine32 = 0;
+					for (uint32_t angle = 0; angle <= ANGLE_RANGE; angle++)
+					{
+						const double sine = sin(ToRadians(angle));
+						const double cosine = cos(ToRadians(angle));
+
+						sine8 = max(sine8, fabs(Sine8(angle) - (sine * Fraction8::FRACTION_1X)));
+						sine16 = max(sine16, fabs(Sine16(angle) - (sine * Fraction16::FRACTION_1X)));
+						sine32 = max(sine32, fabs(Sine32(angle) - (sine * Fraction32::FRACTION_1X)));
+						cosine8 = max(cosine8, fabs(Cosine8(angle) - (cosine * Fraction8::FRACTION_1X)));
+						cosine16 = max(cosine16, fabs(Cosine16(angle) - (cosine * Fraction16::FRACTION_1X)));
+						cosine32 = max(cosine32, fabs(Cosine32(angle) - (cosine * Fraction32::FRACTION_1X)));
+					}
+
+					bool pass = true;
+					pass &= Report("Polynomial Sine8", sine8, 1.0);
+					pass &= Report("Polynomial Sine16", sine16, 1.0);
+					pass &= Report("Polynomial Sine32", sine32, 1.0);
+					pass &= Report("Polynomial Cosine8", cosine8, 1.0);
+					pass &= Report("Polynomial Cosine16", cosine16, 1.0);
+					pass &= Report("Polynomial Cosine32", cosine32, 1.0);
+
+					return pass;
+				}
+
+				// Every angle_t below saturation, the error grows with 1 / cos^2 towards 90 degrees.
+				static bool TestTangentExhaustive()
+				{
+					double tangent8 = 0, tangent16 = 0, tangent32 = 0;
+					for (uint32_t angle = 0; angle <= ANGLE_RANGE; angle++)
+					{
+						const double tangent = tan(ToRadians(angle));
+
+						if (fabs(tangent * Fraction8::FRACTION_1X) < INT8_MAX)
+							tangent8 = max(tangent8, fabs(Tangent8(angle) - (tangent * Fraction8::FRACTION_1X)));
+						if (fabs(tangent * Fraction16::FRACTION_1X) < INT16_MAX)
+							tangent16 = max(tangent16, fabs(Tangent16(angle) - (tangent * Fraction16::FRACTION_1X)));
+						if (fabs(tangent * Fraction32::FRACTION_1X) < INT32_MAX)
+							tangent32 = max(tangent32, fabs(Tangent32(angle) - (tangent * Fraction32::FRACTION_1X)));
+					}
+
+					bool pass = true;
+					pass &= Report("Polynomial Tangent8", tangent8, 3.0);
+					pass &= Report("Polynomial Tangent16", tangent16, 2.0);
+					pass &= Report("Polynomial Tangent32", tangent32, 2.0);
+
+					return pass;
+				}
+
+				// Exact values, odd symmetry and saturation around 90 degrees.
+				static bool TestSpecial()
+				{
+					if (Sine16(0) != 0 || Sine16(ANGLE_90) != Fraction16::FRACTION_1X || Sine16(ANGLE_180) != 0
+						|| Sine16(ANGLE_270) != -Fraction16::FRACTION_1X || Cosine32(0) != Fraction32::FRACTION_1X
+						|| Sine8(ANGLE_45) != -Sine8(angle_t(0 - ANGLE_45)) || Sine32(ANGLE_45) != Cosine32(ANGLE_45)
+						|| Tangent16(0) != 0 || Tangent16(ANGLE_45) != Fraction16::FRACTION_1X || Tangent32(ANGLE_180) != 0
+						|| Tangent8(ANGLE_90) != INT8_MAX || Tangent16(ANGLE_90 - 1) != INT16_MAX || Tangent16(ANGLE_90 + 1) != -INT16_MAX
+						|| Tangent32(ANGLE_270) != INT32_MAX)
+					{
+						Serial.println(F("Polynomial special values error."));
+						return false;
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting Polynomial tests..."));
+					bool pass = true;
+
+					pass &= TestSineCosineExhaustive();
+					pass &= TestTangentExhaustive();
+					pass &= TestSpecial();
+
+					if (pass) Serial.println(F("Polynomial tests PASSED."));
+					else      Serial.println(F("Polynomial tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
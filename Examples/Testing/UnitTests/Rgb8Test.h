@@ -0,0 +1,136 @@
+#ifndef _RGB8_TEST_h
+#define _RGB8_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Rgb8
+	{
+		// Row functions must be bit-exact with the single pixel functions,
+		// for any row length and alignment.
+		namespace Test
+		{
+			static constexpr uint16_t RowSize = 67;
+
+			static color_t NextColor(uint32_t& seed)
+			{
+				seed = (seed * 1103515245u) + 12345u;
+				return seed ^ (seed >> 15);
+			}
+
+			static bool CheckRow(const color_t* output, const color_t* expected, const uint16_t count, const char* name, const ufraction16_t fraction)
+			{
+				for (uint16_t i = 0; i < count; i++)
+				{
+					if (output[i] != expected[i])
+					{
+						Serial.print(F("Rgb8 "));
+						Serial.print(name);
+						Serial.print(F(" mismatch at i="));
+						Serial.print(i);
+						Serial.print(F(" fraction="));
+						Serial.print(fraction);
+						Serial.print(F(" got=")); IntegerSignal::Testing::PrintUInt64(output[i]);
+						Serial.print(F(" expected=")); IntegerSignal::Testing::PrintUInt64(expected[i]);
+						Serial.println();
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			static bool TestAlphaBlend()
+			{
+				// Alpha end points return either color, opaque.
+				const color_t background = Color(0x20, 0x40, 0x80);
+				const color_t foreground = Color(0x11, 0x22, 0x33);
+				color_t transparent = foreground;
+				SetAlpha(transparent, 0);
+
+				if (ColorAlphaBlend(background, foreground) != foreground
+					|| ColorAlphaBlend(background, transparent) != background)
+				{
+					Serial.println(F("Rgb8 AlphaBlend end points error."));
+					return false;
+				}
+
+				return true;
+			}
+
+			template<uint32_t MaxIterations>
+			static bool TestRows()
+			{
+				color_t from[RowSize];
+				color_t to[RowSize];
+				color_t output[RowSize];
+				color_t expected[RowSize];
+				uint32_t seed = 0x2468ACE;
+
+				const uint32_t rows = (MaxIterations / 4) + 256;
+				for (uint32_t r = 0; r < rows; r++)
+				{
+					const uint16_t count = r % (RowSize + 1);
+					for (uint16_t i = 0; i < count; i++)
+					{
+						from[i] = NextColor(seed);
+						to[i] = NextColor(seed);
+					}
+
+					// Sweep the alpha values through all lanes.
+					for (uint16_t i = 0; i < count; i++)
+					{
+						SetAlpha(to[i], (component_t)(r + (i * 7)));
+					}
+
+					ufraction16_t fraction = (ufraction16_t)(NextColor(seed) % (UFraction16::FRACTION_1X + 1));
+					if (r % 8 == 0) fraction = 0;
+					else if (r % 8 == 1) fraction = UFraction16::FRACTION_1X;
+
+					for (uint16_t i = 0; i < count; i++)
+						expected[i] = ColorInterpolateLinear(from[i], to[i], fraction);
+					ColorInterpolateLinearBlock(fraction, from, to, output, count);
+					if (!CheckRow(output, expected, count, "InterpolateLinearBlock", fraction))
+						return false;
+
+					for (uint16_t i = 0; i < count; i++)
+						expected[i] = ColorInterpolate(from[i], to[i], fraction);
+					ColorInterpolateBlock(fraction, from, to, output, count);
+					if (!CheckRow(output, expected, count, "InterpolateBlock", fraction))
+						return false;
+
+					for (uint16_t i = 0; i < count; i++)
+						expected[i] = ColorAlphaBlend(from[i], to[i]);
+					ColorAlphaBlendBlock(from, to, output, count);
+					if (!CheckRow(output, expected, count, "AlphaBlendBlock", fraction))
+						return false;
+
+					// In place.
+					ColorAlphaBlendBlock(from, to, from, count);
+					if (!CheckRow(from, expected, count, "AlphaBlendBlock in place", fraction))
+						return false;
+				}
+
+				return true;
+			}
+
+			template<uint32_t MaxIterations = 50000>
+			static bool RunTests()
+			{
+				Serial.println(F("Starting Rgb8 tests..."));
+				bool pass = true;
+
+				pass &= TestAlphaBlend();
+				pass &= TestRows<MaxIterations>();
+
+				if (pass) Serial.println(F("Rgb8 tests PASSED."));
+				else      Serial.println(F("Rgb8 tests FAILED."));
+
+				return pass;
+			}
+		}
+	}
+}
+#endif
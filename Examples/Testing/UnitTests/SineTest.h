@@ -36,6 +36,48 @@ namespace IntegerSignal
 					return (double)degrees * (double)(M_PI) / 180.0;
 				}
 
+#if (__cplusplus >= 201402L)
+				// Exhaustive test for the Hermite interpolated Q0.30 LUT, and its fused sine-cosine pair.
+				static bool TestSine32HermiteExhaustive()
+				{
+					uint32_t errorCount = 0;
+					uint32_t maxError = 0;
+					for (uint32_t angle = 0; angle <= ANGLE_90; angle++)
+					{
+						const uint32_t result = Lut::Sine32::GetInterpolated(angle);
+						const uint32_t error = (uint32_t)abs((int64_t)result - (int64_t)RefSine32(angle));
+						maxError = (error > maxError) ? error : maxError;
+
+						uint32_t sine = 0, cosine = 0;
+						if (angle < ANGLE_90)
+						{
+							Lut::Sine32::GetInterpolatedPair(angle, sine, cosine);
+						}
+						if (error > 1 || (angle < ANGLE_90
+							&& (sine != result || cosine != Lut::Sine32::GetInterpolated(ANGLE_90 - angle))))
+						{
+							errorCount++;
+						}
+					}
+
+					Serial.print(F("Sine32 Hermite LUT max error: "));
+					Serial.print(maxError);
+					Serial.println(F(" (Q0.30)"));
+
+					if (errorCount == 0)
+					{
+						Serial.println(F("All Sine32 Hermite LUT tests PASSED."));
+					}
+					else
+					{
+						Serial.print(F("Sine32 Hermite LUT tests FAILED. Errors: "));
+						Serial.println(errorCount);
+					}
+
+					return errorCount == 0;
+				}
+#endif
+
 				// Exhaustive test for GetInterpolated function for Sine32
 				template<uint32_t ErrorTolerance>
 				static bool TestSine32Exhaustive()
@@ -396,6 +438,157 @@ namespace IntegerSignal
 				}
 
 
+				// Batch Sine16/Cosine16/Sine32/Cosine32 must be bit-exact with the scalar functions for all angles.
+				static bool TestSine16BatchExhaustive()
+				{
+					Serial.println(F("Starting exhaustive Sine16Batch tests..."));
+
+					static constexpr uint16_t BlockSize = 61; // Odd size exercises the vector tail.
+					angle_t angles[BlockSize];
+					fraction16_t sines[BlockSize];
+					fraction16_t cosines[BlockSize];
+					Fraction32::scalar_t sines32[BlockSize];
+					Fraction32::scalar_t cosines32[BlockSize];
+
+					uint32_t errorCount = 0;
+					uint32_t angle = 0;
+					while (angle <= ANGLE_RANGE)
+					{
+						uint16_t count = 0;
+						while (count < BlockSize && angle <= ANGLE_RANGE)
+						{
+							angles[count++] = angle++;
+						}
+
+						IntegerSignal::Trigonometry::Sine16Batch(angles, sines, count);
+						IntegerSignal::Trigonometry::Cosine16Batch(angles, cosines, count);
+						IntegerSignal::Trigonometry::Sine32Batch(angles, sines32, count);
+						IntegerSignal::Trigonometry::Cosine32Batch(angles, cosines32, count);
+
+						for (uint16_t i = 0; i < count; i++)
+						{
+							if (sines[i] != IntegerSignal::Trigonometry::Sine16(angles[i])
+								|| cosines[i] != IntegerSignal::Trigonometry::Cosine16(angles[i])
+								|| sines32[i] != IntegerSignal::Trigonometry::Sine32(angles[i])
+								|| cosines32[i] != IntegerSignal::Trigonometry::Cosine32(angles[i]))
+							{
+								Serial.print(F("Sine16Batch error: angle="));
+								Serial.print(angles[i]);
+								Serial.print(F(" sine="));
+								Serial.print(sines[i]);
+								Serial.print(F(" cosine="));
+								Serial.println(cosines[i]);
+								errorCount++;
+							}
+						}
+					}
+
+					if (errorCount == 0)
+					{
+						Serial.println(F("All Sine16Batch tests PASSED."));
+					}
+					else
+					{
+						Serial.print(F("Sine16Batch tests FAILED. Errors: "));
+						Serial.println(errorCount);
+					}
+
+					return errorCount == 0;
+				}
+
+				// SineCosine16/SineCosine32 must be bit-exact with the scalar functions for all angles.
+				static bool TestSineCosineExhaustive()
+				{
+					uint32_t errorCount = 0;
+					for (uint32_t angle = 0; angle <= ANGLE_RANGE; angle++)
+					{
+						fraction16_t sine, cosine;
+						Fraction32::scalar_t sine32, cosine32;
+						IntegerSignal::Trigonometry::SineCosine16((angle_t)angle, sine, cosine);
+						IntegerSignal::Trigonometry::SineCosine32((angle_t)angle, sine32, cosine32);
+
+						if (sine != IntegerSignal::Trigonometry::Sine16((angle_t)angle)
+							|| cosine != IntegerSignal::Trigonometry::Cosine16((angle_t)angle)
+							|| sine32 != IntegerSignal::Trigonometry::Sine32((angle_t)angle)
+							|| cosine32 != IntegerSignal::Trigonometry::Cosine32((angle_t)angle))
+						{
+							errorCount++;
+						}
+					}
+
+					if (errorCount == 0)
+					{
+						Serial.println(F("All SineCosine tests PASSED."));
+					}
+					else
+					{
+						Serial.print(F("SineCosine tests FAILED. Errors: "));
+						Serial.println(errorCount);
+					}
+
+					return errorCount == 0;
+				}
+
+				// Rotate must match a floating-point rotation by the same angle, relative to full scale, and saturate.
+				static bool TestRotate(const uint32_t steps)
+				{
+					const double pi = 3.14159265358979323846;
+
+					double error16 = 0;
+					double error32 = 0;
+					uint32_t seed = 0x2074;
+					for (uint32_t i = 0; i < steps; i++)
+					{
+						seed = (seed * 1103515245u) + 12345u;
+						const angle_t angle = (angle_t)(seed >> 16);
+						seed = (seed * 1103515245u) + 12345u;
+						const int32_t x32 = (int32_t)seed >> 1;
+						seed = (seed * 1103515245u) + 12345u;
+						const int32_t y32 = (int32_t)seed >> 1;
+
+						const double w = 2.0 * pi * angle / 65536.0;
+						const double c = cos(w);
+						const double s = sin(w);
+
+						// Half scale inputs, the rotated vector never saturates.
+						int16_t x = (int16_t)(x32 >> 16);
+						int16_t y = (int16_t)(y32 >> 16);
+						const double expectedX16 = (x * c) - (y * s);
+						const double expectedY16 = (x * s) + (y * c);
+						IntegerSignal::Trigonometry::Rotate(x, y, angle);
+						const double e16 = fmax(fabs(x - expectedX16), fabs(y - expectedY16)) / INT16_MAX;
+						error16 = fmax(error16, e16);
+
+						int32_t x2 = x32;
+						int32_t y2 = y32;
+						const double expectedX32 = (x2 * c) - (y2 * s);
+						const double expectedY32 = (x2 * s) + (y2 * c);
+						IntegerSignal::Trigonometry::Rotate(x2, y2, angle);
+						const double e32 = fmax(fabs(x2 - expectedX32), fabs(y2 - expectedY32)) / INT32_MAX;
+						error32 = fmax(error32, e32);
+					}
+
+					int16_t x = INT16_MAX, y = INT16_MAX;
+					IntegerSignal::Trigonometry::Rotate(x, y, ANGLE_45 * 7);
+					int32_t x2 = INT32_MIN, y2 = 0;
+					IntegerSignal::Trigonometry::Rotate(x2, y2, ANGLE_180);
+					const bool saturated = (x == INT16_MAX) && (y == 0) && (x2 == INT32_MAX) && (y2 == 0);
+
+					// Sine32 carries the 16-bit LUT precision.
+					if (error16 > 0.0002 || error32 > 0.0002 || !saturated)
+					{
+						Serial.print(F("Rotate tests FAILED. Error16="));
+						Serial.print(error16 * 1000000.0);
+						Serial.print(F("ppm Error32="));
+						Serial.print(error32 * 1000000.0);
+						Serial.println(F("ppm"));
+						return false;
+					}
+
+					Serial.println(F("All Rotate tests PASSED."));
+					return true;
+				}
+
 				template<uint32_t MaxIterations = 50000>
 				static bool RunTests()
 				{
@@ -412,7 +605,19 @@ namespace IntegerSignal
 #endif
 					pass &= TestSine8Exhaustive<Error8Max>();
 					pass &= TestSine16Exhaustive<Error16Max>();
+#if (INTEGER_TRIGONOMETRY_SINE32 == INTEGER_TRIGONOMETRY_SINE32_HERMITE)
+					pass &= TestSine32Exhaustive<1>();
+#else
 					pass &= TestSine32Exhaustive<Error32Max>();
+#endif
+#if (__cplusplus >= 201402L)
+					pass &= TestSine32HermiteExhaustive();
+#else
+					Serial.println(F("Sine32 Hermite LUT tests SKIPPED (C++11)."));
+#endif
+					pass &= TestSine16BatchExhaustive();
+					pass &= TestSineCosineExhaustive();
+					pass &= TestRotate(MaxIterations);
 
 					PrintErrorResults8();
 					PrintErrorResults16();
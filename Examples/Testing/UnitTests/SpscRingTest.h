@@ -0,0 +1,188 @@
+#ifndef _SPSC_RING_TEST_h
+#define _SPSC_RING_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Stream
+	{
+		namespace Test
+		{
+			static bool TestPushPop()
+			{
+				SpscRing<uint8_t, 8> ring{};
+				uint8_t next = 0;
+				uint8_t expected = 0;
+
+				for (uint16_t round = 0; round < 100; round++)
+				{
+					// Fill until full, across the wrap-around.
+					while (ring.Push(next))
+					{
+						next++;
+					}
+
+					if (ring.GetCount() != 8 || ring.GetFree() != 0)
+					{
+						Serial.println(F("SpscRing full count error."));
+						return false;
+					}
+
+					// Drain a varying amount, single and bulk.
+					const uint8_t drain = 1 + (round % 8);
+					uint8_t values[8];
+					uint8_t popped = 0;
+					if (round & 1)
+					{
+						popped = ring.Pop(values, drain);
+					}
+					else
+					{
+						while (popped < drain && ring.Pop(values[popped]))
+						{
+							popped++;
+						}
+					}
+
+					for (uint8_t i = 0; i < popped; i++)
+					{
+						if (values[i] != expected++)
+						{
+							Serial.println(F("SpscRing order error."));
+							return false;
+						}
+					}
+
+					if (popped != drain || ring.GetFree() != drain)
+					{
+						Serial.println(F("SpscRing pop count error."));
+						return false;
+					}
+				}
+
+				ring.Clear();
+				uint8_t value;
+				if (ring.GetCount() != 0 || ring.Pop(value))
+				{
+					Serial.println(F("SpscRing clear error."));
+					return false;
+				}
+
+				return true;
+			}
+
+			// Processing the ring spans must be identical to processing the stream sample by sample.
+			template<typename FilterT, typename ValueT, uint16_t Capacity>
+			static bool TestProcess(const uint32_t samples)
+			{
+				SpscRing<ValueT, Capacity> ring{};
+				FilterT filter{};
+				FilterT reference{};
+				FilterT inPlace{};
+
+				filter.Clear();
+				reference.Clear();
+				inPlace.Clear();
+
+				ValueT input[Capacity];
+				ValueT output[Capacity];
+				uint32_t seed = 0x1234567;
+				uint32_t produced = 0;
+
+				while (produced < samples)
+				{
+					// Push a pseudo-random amount, drain a different one.
+					seed = (seed * 1103515245u) + 12345u;
+					const uint16_t pushCount = (seed >> 8) % (Capacity + 1);
+					for (uint16_t i = 0; i < pushCount; i++)
+					{
+						input[i] = (ValueT)((seed >> 3) * (i + produced));
+					}
+
+					const uint16_t pushed = ring.Push(input, pushCount);
+					produced += pushed;
+
+					const uint16_t drainCount = (seed >> 16) % (Capacity + 1);
+					const uint16_t processed = ring.Process(filter, output, drainCount);
+					for (uint16_t i = 0; i < processed; i++)
+					{
+						reference.Set(input[i]);
+						reference.Step();
+						if (reference.Get() != output[i])
+						{
+							Serial.print(F("SpscRing Process mismatch at sample "));
+							Serial.println(produced);
+							return false;
+						}
+					}
+
+					// Drain the rest in place, the filter state must follow.
+					for (uint16_t i = processed; i < pushed; i++)
+					{
+						reference.Set(input[i]);
+						reference.Step();
+					}
+					ring.Process(filter);
+
+					if (ring.GetCount() != 0 || filter.Get() != reference.Get())
+					{
+						Serial.println(F("SpscRing in-place Process mismatch."));
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			static bool TestProcessCurve()
+			{
+				using CurveType = Curves::Power2U16<>;
+
+				SpscRing<uint16_t, 16> ring{};
+				Curves::Template::Block<CurveType, uint16_t> block{};
+				uint16_t output[16];
+
+				for (uint16_t round = 0; round < 50; round++)
+				{
+					for (uint8_t i = 0; i < 11; i++)
+					{
+						ring.Push(uint16_t((round * 11 + i) * 593));
+					}
+
+					const size_t count = ring.Process(block, output, 16);
+					for (uint8_t i = 0; i < count; i++)
+					{
+						if (output[i] != CurveType::Get(uint16_t((round * 11 + i) * 593)))
+						{
+							Serial.println(F("SpscRing curve Process mismatch."));
+							return false;
+						}
+					}
+				}
+
+				return true;
+			}
+
+			template<uint32_t MaxIterations = 50000>
+			static bool RunTests()
+			{
+				Serial.println(F("Starting SpscRing tests..."));
+				bool pass = true;
+
+				pass &= TestPushPop();
+				pass &= TestProcess<Filters::EmaU8<3>, uint8_t, 16>(MaxIterations);
+				pass &= TestProcess<Filters::LowPassU16<4>, uint16_t, 64>(MaxIterations);
+				pass &= TestProcess<Filters::DemaU32<5>, uint32_t, 128>(MaxIterations);
+				pass &= TestProcessCurve();
+
+				if (pass) Serial.println(F("SpscRing tests PASSED."));
+				else      Serial.println(F("SpscRing tests FAILED."));
+
+				return pass;
+			}
+		}
+	}
+}
+#endif
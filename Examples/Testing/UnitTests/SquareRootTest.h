@@ -193,6 +193,84 @@ namespace IntegerSignal
 				return errorCount == 0;
 			}
 
+			// Batch results must match the scalar functions, in blocks that exercise vector bodies and scalar tails.
+			template<typename value_t, typename root_t, uint8_t BlockSize = 61>
+			static bool TestSqrtBatchBlock(const value_t* values, const uint8_t count,
+				void (*batch)(const value_t*, root_t*, const size_t),
+				root_t(*scalar)(const value_t))
+			{
+				root_t roots[BlockSize];
+				batch(values, roots, count);
+
+				for (uint8_t i = 0; i < count; i++)
+				{
+					if (roots[i] != scalar(values[i]))
+					{
+						Serial.print(F("Batch sqrt error: value="));
+						IntegerSignal::Testing::PrintUInt64(values[i]);
+						Serial.print(F(" result="));
+						Serial.print((uint32_t)roots[i]);
+						Serial.print(F(" ref="));
+						Serial.println((uint32_t)scalar(values[i]));
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			template<uint32_t MaxIterations>
+			static bool TestSqrtBatch()
+			{
+				Serial.println(F("Starting batch sqrt tests..."));
+				static constexpr uint8_t BlockSize = 61;
+				bool pass = true;
+
+				// 16-bit exhaustive.
+				uint16_t values16[BlockSize];
+				for (uint32_t v = 0; v <= UINT16_MAX && pass; v += BlockSize)
+				{
+					uint8_t count = 0;
+					for (; count < BlockSize && (v + count) <= UINT16_MAX; count++)
+						values16[count] = uint16_t(v + count);
+					pass &= TestSqrtBatchBlock<uint16_t, uint8_t>(values16, count, SquareRoot16Batch, SquareRoot16);
+				}
+
+				// 32-bit and 64-bit around every sampled perfect square, where the float/double seed is off by one.
+				uint32_t values32[BlockSize];
+				uint64_t values64[BlockSize];
+				for (uint32_t i = 0; i < MaxIterations && pass; i += (BlockSize / 3))
+				{
+					uint8_t count = 0;
+					for (uint8_t j = 0; j < (BlockSize / 3); j++)
+					{
+						const uint32_t root16 = (uint32_t)(((uint64_t)(i + j) * UINT16_MAX) / (MaxIterations - 1));
+						const uint64_t root32 = (((uint64_t)(i + j) * UINT32_MAX) / (MaxIterations - 1));
+						const uint32_t square32 = root16 * root16;
+						const uint64_t square64 = root32 * root32;
+
+						values32[count] = square32 - 1;
+						values64[count++] = square64 - 1;
+						values32[count] = square32;
+						values64[count++] = square64;
+						values32[count] = square32 + 1;
+						values64[count++] = square64 + 1;
+					}
+					values32[0] = UINT32_MAX;
+					values64[0] = UINT64_MAX;
+
+					pass &= TestSqrtBatchBlock<uint32_t, uint16_t>(values32, count, SquareRoot32Batch, SquareRoot32);
+					pass &= TestSqrtBatchBlock<uint64_t, uint32_t>(values64, count, SquareRoot64Batch, SquareRoot64);
+				}
+
+				if (pass)
+					Serial.println(F("All batch sqrt tests PASSED."));
+				else
+					Serial.println(F("Batch sqrt tests FAILED."));
+
+				return pass;
+			}
+
 			template<uint32_t MaxIterations = 50000>
 			static bool RunTests()
 			{
@@ -201,6 +279,7 @@ namespace IntegerSignal
 				pass &= TestSqrt16Exhaustive();
 				pass &= TestSqrt32Sample<MaxIterations>();
 				pass &= TestSqrt64Sample<MaxIterations>();
+				pass &= TestSqrtBatch<MaxIterations>();
 
 				if (!pass)
 				{
@@ -0,0 +1,278 @@
+#ifndef _STATIC_FILTER_TEST_h
+#define _STATIC_FILTER_TEST_h
+
+#include <IntegerSignalTesting.h>
+#include <IntegerSignal.h>
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Static
+		{
+			// Static (CRTP) filters must be bit-exact with their IFilter counterparts,
+			// both per-sample and through ProcessBlock.
+			namespace Test
+			{
+				template<typename ValueT>
+				static ValueT NextInput(uint32_t& seed, const uint8_t shift)
+				{
+					seed = (seed * 1103515245u) + 12345u;
+					return (ValueT)(((uint64_t)seed << 32 | (seed >> 3)) >> shift);
+				}
+
+				// Lockstep against the IFilter filter, called through the interface.
+				template<typename StaticT, typename VirtualT, typename ValueT, uint16_t BlockSize = 64>
+				static bool TestEquivalence(const uint32_t blocks)
+				{
+					StaticT filter;
+					VirtualT virtualFilter;
+					IntegerSignal::Filter::IFilter<ValueT>* reference = &virtualFilter;
+					filter.Clear();
+					reference->Clear();
+
+					ValueT input[BlockSize];
+					ValueT output[BlockSize];
+					uint32_t seed = 0x1234567;
+
+					for (uint32_t b = 0; b < blocks; b++)
+					{
+						// Alternate per-sample and block processing, with variable block lengths.
+						const uint16_t count = b % (BlockSize + 1);
+						for (uint16_t i = 0; i < count; i++)
+						{
+							input[i] = NextInput<ValueT>(seed, b % 32);
+						}
+
+						if (b & 1)
+						{
+							filter.ProcessBlock(input, output, count);
+						}
+						else
+						{
+							for (uint16_t i = 0; i < count; i++)
+							{
+								filter.Set(input[i]);
+								filter.Step();
+								output[i] = filter.Get();
+							}
+						}
+
+						for (uint16_t i = 0; i < count; i++)
+						{
+							reference->Set(input[i]);
+							reference->Step();
+							if (reference->Get() != output[i])
+							{
+								Serial.print(F("Static filter mismatch at block "));
+								Serial.print(b);
+								Serial.print(F(" i=")); Serial.print(i);
+								Serial.print(F(" got=")); IntegerSignal::Testing::PrintUInt64((uint64_t)output[i]);
+								Serial.print(F(" ref=")); IntegerSignal::Testing::PrintUInt64((uint64_t)reference->Get());
+								Serial.println();
+								return false;
+							}
+						}
+
+						if (reference->Get() != filter.Get())
+						{
+							Serial.print(F("Static filter state mismatch at block "));
+							Serial.println(b);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				// The adapter must expose the static filter through IFilter, including Clear().
+				template<typename StaticT, typename VirtualT, typename ValueT>
+				static bool TestInterface(const ValueT init, const uint32_t steps)
+				{
+					IntegerSignal::Filter::Template::Interface<StaticT, ValueT> adapted;
+					VirtualT reference;
+					IntegerSignal::Filter::IFilter<ValueT>* filter = &adapted;
+
+					adapted.Clear(init);
+					reference.Clear(init);
+					filter->Clear();
+					reference.Clear();
+
+					uint32_t seed = 0x89ABCDE;
+					for (uint32_t i = 0; i < steps; i++)
+					{
+						const ValueT input = NextInput<ValueT>(seed, i % 32);
+						filter->Set(input);
+						filter->Step();
+						reference.Set(input);
+						reference.Step();
+						if (filter->Get() != reference.Get())
+						{
+							Serial.print(F("Static filter Interface mismatch at step "));
+							Serial.println(i);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				// Subclass feeding the filter through AbstractFilter's Input.
+				template<typename VirtualT, typename ValueT>
+				struct InputWriter : VirtualT
+				{
+					void Write(const ValueT value)
+					{
+						IntegerSignal::Filter::AbstractFilter<ValueT>::Input = value;
+					}
+				};
+
+				// The IFilter filters stay usable through AbstractFilter, including Clear(value) and its Input.
+				template<typename StaticT, typename VirtualT, typename ValueT>
+				static bool TestAbstractFilter(const ValueT init, const uint32_t steps)
+				{
+					InputWriter<VirtualT, ValueT> adapted;
+					StaticT reference;
+					IntegerSignal::Filter::AbstractFilter<ValueT>* filter = &adapted;
+
+					filter->Clear(init);
+					reference.Clear(init);
+					if (filter->Get() != reference.Get())
+					{
+						Serial.println(F("Static filter AbstractFilter Clear(value) mismatch"));
+						return false;
+					}
+
+					uint32_t seed = 0x13579BD;
+					for (uint32_t i = 0; i < steps; i++)
+					{
+						const ValueT input = NextInput<ValueT>(seed, i % 32);
+						filter->Set(input);
+						filter->Step();
+						reference.Set(input);
+						reference.Step();
+						if (filter->Get() != reference.Get())
+						{
+							Serial.print(F("Static filter AbstractFilter mismatch at step "));
+							Serial.println(i);
+							return false;
+						}
+					}
+
+					for (uint32_t i = 0; i < steps; i++)
+					{
+						const ValueT input = NextInput<ValueT>(seed, i % 32);
+						adapted.Write(input);
+						adapted.Step();
+						reference.Set(input);
+						reference.Step();
+						if (adapted.Get() != reference.Get())
+						{
+							Serial.print(F("Static filter AbstractFilter Input mismatch at step "));
+							Serial.println(i);
+							return false;
+						}
+					}
+
+					return true;
+				}
+
+				// Layouts of the AbstractFilter subclasses before the static filters: AbstractFilter, then the filter state.
+				template<typename unsigned_t, typename intermediate_t>
+				struct LowPassLayout : IntegerSignal::Filter::AbstractFilter<unsigned_t>
+				{
+					intermediate_t HighValue;
+				};
+
+				template<typename unsigned_t, typename intermediate_t>
+				struct EmaLayout : IntegerSignal::Filter::AbstractFilter<unsigned_t>
+				{
+					intermediate_t HighValue;
+					unsigned_t Output;
+				};
+
+				template<typename unsigned_t, typename intermediate_t>
+				struct DemaLayout : IntegerSignal::Filter::AbstractFilter<unsigned_t>
+				{
+					intermediate_t HighValue1;
+					intermediate_t HighValue2;
+					unsigned_t Output;
+				};
+
+				// The AbstractFilter implementers keep a single Input, and their size.
+				static_assert(sizeof(Filters::LowPassU8<4>) == sizeof(LowPassLayout<uint8_t, uint_fast16_t>), "LowPassU8 layout changed");
+				static_assert(sizeof(Filters::LowPassU32<4>) == sizeof(LowPassLayout<uint32_t, uint_fast64_t>), "LowPassU32 layout changed");
+				static_assert(sizeof(Filters::EmaU8<4>) == sizeof(EmaLayout<uint8_t, uint_fast16_t>), "EmaU8 layout changed");
+				static_assert(sizeof(Filters::EmaU16<4>) == sizeof(EmaLayout<uint16_t, uint_fast32_t>), "EmaU16 layout changed");
+				static_assert(sizeof(Filters::DemaU8<4>) == sizeof(DemaLayout<uint8_t, uint_fast16_t>), "DemaU8 layout changed");
+				static_assert(sizeof(Filters::DemaU32<4>) == sizeof(DemaLayout<uint32_t, uint_fast64_t>), "DemaU32 layout changed");
+
+				// Without a vtable pointer, static filters are always smaller.
+				template<typename StaticT, typename VirtualT>
+				static bool TestSize()
+				{
+					if (sizeof(StaticT) >= sizeof(VirtualT))
+					{
+						Serial.print(F("Static filter size not reduced: "));
+						Serial.print((uint32_t)sizeof(StaticT));
+						Serial.print(F(" >= "));
+						Serial.println((uint32_t)sizeof(VirtualT));
+						return false;
+					}
+
+					return true;
+				}
+
+				template<uint32_t MaxIterations = 50000>
+				static bool RunTests()
+				{
+					Serial.println(F("Starting Static filter tests..."));
+					bool pass = true;
+
+					const uint32_t blocks = (MaxIterations / 256) + 65;
+
+					pass &= TestEquivalence<LowPassU8<4>, Filters::LowPassU8<4>, uint8_t>(blocks);
+					pass &= TestEquivalence<LowPassU16<8>, Filters::LowPassU16<8>, uint16_t>(blocks);
+					pass &= TestEquivalence<LowPassU32<8>, Filters::LowPassU32<8>, uint32_t>(blocks);
+					pass &= TestEquivalence<EmaU8<4>, Filters::EmaU8<4>, uint8_t>(blocks);
+					pass &= TestEquivalence<EmaU16<8>, Filters::EmaU16<8>, uint16_t>(blocks);
+					pass &= TestEquivalence<EmaU32<8>, Filters::EmaU32<8>, uint32_t>(blocks);
+					pass &= TestEquivalence<DemaU8<2>, Filters::DemaU8<2>, uint8_t>(blocks);
+					pass &= TestEquivalence<DemaU16<8>, Filters::DemaU16<8>, uint16_t>(blocks);
+					pass &= TestEquivalence<DemaU32<8>, Filters::DemaU32<8>, uint32_t>(blocks);
+
+					pass &= TestEquivalence<LowPassI8<4>, Filters::LowPassI8<4>, int8_t>(blocks);
+					pass &= TestEquivalence<EmaI16<8>, Filters::EmaI16<8>, int16_t>(blocks);
+					pass &= TestEquivalence<DemaI32<8>, Filters::DemaI32<8>, int32_t>(blocks);
+
+					pass &= TestEquivalence<StrengthU8<LowPassU8<4>, 128>, StrengthU8<Filters::LowPassU8<4>, 128>, uint8_t>(blocks);
+					pass &= TestEquivalence<StrengthU16<EmaU16<8>, 200>, StrengthU16<Filters::EmaU16<8>, 200>, uint16_t>(blocks);
+					pass &= TestEquivalence<StrengthU32<DemaU32<8>, 64>, StrengthU32<Filters::DemaU32<8>, 64>, uint32_t>(blocks);
+
+					pass &= TestInterface<EmaU16<4>, Filters::EmaU16<4>, uint16_t>(12345, MaxIterations / 10);
+					pass &= TestInterface<DemaU8<2>, Filters::DemaU8<2>, uint8_t>(200, MaxIterations / 10);
+
+					pass &= TestAbstractFilter<LowPassU16<4>, Filters::LowPassU16<4>, uint16_t>(43210, MaxIterations / 10);
+					pass &= TestAbstractFilter<EmaU8<4>, Filters::EmaU8<4>, uint8_t>(200, MaxIterations / 10);
+					pass &= TestAbstractFilter<DemaU32<8>, Filters::DemaU32<8>, uint32_t>(3000000000u, MaxIterations / 10);
+					pass &= TestAbstractFilter<MedianU8<5>, Filters::MedianU8<5>, uint8_t>(100, MaxIterations / 10);
+					pass &= TestAbstractFilter<MedianI16<15>, Filters::MedianI16<15>, int16_t>(-1234, MaxIterations / 10);
+					pass &= TestAbstractFilter<MovingAverageU8<3>, Filters::MovingAverageU8<3>, uint8_t>(77, MaxIterations / 10);
+					pass &= TestAbstractFilter<MovingAverageU32<6>, Filters::MovingAverageU32<6>, uint32_t>(4000000000u, MaxIterations / 10);
+
+					pass &= TestSize<LowPassU8<4>, Filters::LowPassU8<4>>();
+					pass &= TestSize<EmaU8<4>, Filters::EmaU8<4>>();
+					pass &= TestSize<DemaU16<4>, Filters::DemaU16<4>>();
+					pass &= TestSize<EmaI8<4>, Filters::EmaI8<4>>();
+					pass &= TestSize<StrengthU8<EmaU8<4>>, StrengthU8<Filters::EmaU8<4>>>();
+
+					if (pass) Serial.println(F("Static filter tests PASSED."));
+					else      Serial.println(F("Static filter tests FAILED."));
+
+					return pass;
+				}
+			}
+		}
+	}
+}
+#endif
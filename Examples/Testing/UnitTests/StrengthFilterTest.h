@@ -154,6 +154,22 @@ namespace IntegerSignal
 					return errorCount == 0;
 				}
 
+				// ------------------------------------------------------------
+				// Block processing must keep the strength mix, not the base filter's
+				// ------------------------------------------------------------
+				template<typename BaseFilterT, template<typename, uint8_t> class StrengthAlias, uint8_t StrengthScale, typename T>
+				static bool TestBlockAgainstStep(const uint32_t blocks)
+				{
+					using SFilter = StrengthAlias<BaseFilterT, StrengthScale>;
+
+					SFilter blockFilter;
+					SFilter stepFilter;
+					blockFilter.Clear();
+					stepFilter.Clear();
+
+					return IntegerSignal::Testing::TestProcessBlock<T>(blockFilter, stepFilter, F("Strength"), blocks);
+				}
+
 				// ------------------------------------------------------------
 				// Edge strengths on real bases: 0 -> pass-through input; 255 -> pure base output
 				// ------------------------------------------------------------
@@ -222,6 +238,11 @@ namespace IntegerSignal
 					// Edge strengths on a real base
 					pass &= TestEdgeStrengths<IntegerSignal::Filters::LowPassU8<4>, uint8_t, MaxIterations>();
 
+					// Block processing on real bases
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::LowPassU8<4>, IntegerSignal::Filters::StrengthU8, 128, uint8_t>(64);
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::EmaU8<4>, IntegerSignal::Filters::StrengthU8, 200, uint8_t>(64);
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::DemaU8<2>, IntegerSignal::Filters::StrengthU8, 64, uint8_t>(64);
+
 					return pass;
 				}
 
@@ -235,6 +256,11 @@ namespace IntegerSignal
 					pass &= TestSampledAgainstBase<IntegerSignal::Filters::EmaU16<8>, IntegerSignal::Filters::StrengthU16, 200, uint16_t, uint32_t, MaxIterations / 5>();
 					pass &= TestSampledAgainstBase<IntegerSignal::Filters::DemaU16<8>, IntegerSignal::Filters::StrengthU16, 64, uint16_t, uint32_t, MaxIterations / 5>();
 
+					// Block processing on real bases
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::LowPassU16<8>, IntegerSignal::Filters::StrengthU16, 128, uint16_t>(64);
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::EmaU16<8>, IntegerSignal::Filters::StrengthU16, 200, uint16_t>(64);
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::DemaU16<8>, IntegerSignal::Filters::StrengthU16, 64, uint16_t>(64);
+
 					return pass;
 				}
 
@@ -248,6 +274,11 @@ namespace IntegerSignal
 					pass &= TestSampledAgainstBase<IntegerSignal::Filters::EmaU32<8>, IntegerSignal::Filters::StrengthU32, 200, uint32_t, uint64_t, MaxIterations / 10>();
 					pass &= TestSampledAgainstBase<IntegerSignal::Filters::DemaU32<8>, IntegerSignal::Filters::StrengthU32, 64, uint32_t, uint64_t, MaxIterations / 10>();
 
+					// Block processing on real bases
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::LowPassU32<8>, IntegerSignal::Filters::StrengthU32, 128, uint32_t>(64);
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::EmaU32<8>, IntegerSignal::Filters::StrengthU32, 200, uint32_t>(64);
+					pass &= TestBlockAgainstStep<IntegerSignal::Filters::DemaU32<8>, IntegerSignal::Filters::StrengthU32, 64, uint32_t>(64);
+
 					return pass;
 				}
 
@@ -373,6 +373,12 @@ namespace IntegerSignal
 					static constexpr uint8_t Error32Max = 30370 * 2;
 					static constexpr double DegreesRange = 43.0;
 
+#elif (INTEGER_TRIGONOMETRY_LUT == INTEGER_TRIGONOMETRY_LUT_GENERATED)
+					// Tangent32 error is bounded by the truncated 16-bit LUT (2 LUT units), not by the LUT size.
+					static constexpr uint8_t Error8Max = 1;
+					static constexpr uint8_t Error16Max = 1;
+					static constexpr uint32_t Error32Max = uint32_t(2) << 14;
+					static constexpr double DegreesRange = (45.0 * 7) / 8;
 #else
 					static constexpr uint8_t Error8Max = 1;
 					static constexpr uint8_t Error16Max = 1;
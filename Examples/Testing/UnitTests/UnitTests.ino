@@ -18,17 +18,36 @@
 
 #include "SquareRootTest.h"
 
+#include "LutTest.h"
 #include "SineTest.h"
 #include "TangentTest.h"
+#include "ArcTangentTest.h"
+#include "ArcSineTest.h"
+#include "PolynomialTest.h"
+#include "NcoTest.h"
+#include "FftTest.h"
+#include "GoertzelTest.h"
 
 #include "FixedPointScaleTest.h"
 #include "FixedPointFractionTest.h"
 
+#include "Rgb8Test.h"
+#include "HsvTest.h"
+
 #include "LowPassFilterTest.h"
 #include "EmaFilterTest.h"
 #include "DemaFilterTest.h"
+#include "MovingAverageFilterTest.h"
+#include "MedianFilterTest.h"
 #include "SignedFilterTest.h"
 #include "StrengthFilterTest.h"
+#include "StaticFilterTest.h"
+#include "PipelineTest.h"
+#include "FirFilterTest.h"
+#include "BiquadFilterTest.h"
+#include "CicFilterTest.h"
+#include "FilterBankTest.h"
+#include "SpscRingTest.h"
 
 inline void PrintPlaform();
 
@@ -62,17 +81,36 @@ void setup()
 
 	pass &= IntegerSignal::SquareRoot::Test::RunTests<MaxIterations>();
 
+	pass &= IntegerSignal::Trigonometry::Lut::Test::RunTests();
 	pass &= IntegerSignal::Trigonometry::Tangent::Test::RunTests<MaxIterations>();
 	pass &= IntegerSignal::Trigonometry::Sine::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Trigonometry::ArcTangent::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Trigonometry::ArcSine::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Trigonometry::Polynomial::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Trigonometry::NcoTest::RunTests();
+	pass &= IntegerSignal::Spectrum::Fft::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Spectrum::Goertzel::Test::RunTests<MaxIterations>();
 
 	pass &= IntegerSignal::FixedPoint::ScalarFraction::Test::RunTests<MaxIterations>();
 	pass &= IntegerSignal::FixedPoint::FactorScale::Test::RunTests<MaxIterations>();
 
+	pass &= IntegerSignal::Rgb8::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Hsv::Test::RunTests<MaxIterations>();
+
 	pass &= IntegerSignal::Filters::LowPass::Test::RunTests<MaxIterations>();
 	pass &= IntegerSignal::Filters::Ema::Test::RunTests<MaxIterations>();
 	pass &= IntegerSignal::Filters::Dema::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::MovingAverage::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Median::Test::RunTests<MaxIterations>();
 	pass &= IntegerSignal::Filters::Template::SignedTest::RunTests<MaxIterations>();
 	pass &= IntegerSignal::Filters::Template::StrengthTest::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Static::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Pipelines::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Fir::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Biquad::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Cic::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Filters::Bank::Test::RunTests<MaxIterations>();
+	pass &= IntegerSignal::Stream::Test::RunTests<MaxIterations>();
 
 	if (pass)
 	{
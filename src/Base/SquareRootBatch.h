@@ -0,0 +1,176 @@
+#ifndef _INTEGER_SIGNAL_SQUARE_ROOT_BATCH_h
+#define _INTEGER_SIGNAL_SQUARE_ROOT_BATCH_h
+
+#include <stddef.h>
+#include "SquareRoot.h"
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <immintrin.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace SquareRootBatches
+	{
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		/// <summary>
+		/// Corrects a floor(sqrt) estimate that is off by at most 1, for 32-bit lanes.
+		/// </summary>
+		/// <param name="root">Estimate in [0 ; maxRoot].</param>
+		/// <param name="value">Radicands.</param>
+		/// <param name="maxRoot">Largest root that fits the output type, (maxRoot + 1)^2 must not be tested.</param>
+		static __m256i Correct32(__m256i root, const __m256i value, const __m256i maxRoot)
+		{
+			const __m256i one = _mm256_set1_epi32(1);
+
+			// Downward: root^2 > value.
+			const __m256i square = _mm256_mullo_epi32(root, root);
+			root = _mm256_add_epi32(root, _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(square, value), value), _mm256_set1_epi32(-1)));
+
+			// Upward: (root + 1)^2 <= value, only below the largest root.
+			const __m256i next = _mm256_add_epi32(root, one);
+			const __m256i nextSquare = _mm256_mullo_epi32(next, next);
+			const __m256i up = _mm256_andnot_si256(_mm256_cmpeq_epi32(root, maxRoot), _mm256_cmpeq_epi32(_mm256_max_epu32(nextSquare, value), value));
+
+			return _mm256_sub_epi32(root, up);
+		}
+
+		/// <summary>
+		/// Correctly rounded uint64_t to double conversion, for 4 lanes.
+		/// </summary>
+		static __m256d U64ToDouble(const __m256i value)
+		{
+			// 2^84 + high * 2^32 and 2^52 + low, recombined with a single rounding.
+			const __m256i high = _mm256_or_si256(_mm256_srli_epi64(value, 32), _mm256_castpd_si256(_mm256_set1_pd(19342813113834066795298816.))); // 2^84
+			const __m256i low = _mm256_blend_epi32(value, _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.)), 0xAA); // 2^52
+
+			const __m256d highDouble = _mm256_sub_pd(_mm256_castsi256_pd(high), _mm256_set1_pd(19342813118337666422669312.)); // 2^84 + 2^52
+
+			return _mm256_add_pd(highDouble, _mm256_castsi256_pd(low));
+		}
+#endif
+	}
+
+	/// <summary>
+	/// Batch square root of uint16_t values.
+	/// Same floor(sqrt) results as SquareRoot16() for every value.
+	/// On AVX2 targets, roots are seeded with a vectorized float square root and corrected in integer.
+	/// </summary>
+	/// <param name="values">[0 ; UINT16_MAX]</param>
+	/// <param name="roots">[0 ; UINT8_MAX].</param>
+	/// <param name="count">Number of values.</param>
+	static void SquareRoot16Batch(const uint16_t* values, uint8_t* roots, const size_t count)
+	{
+		size_t i = 0;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		const __m256i maxRoot = _mm256_set1_epi32(UINT8_MAX);
+		const size_t vectorEnd = count - (count % 8);
+		for (; i < vectorEnd; i += 8)
+		{
+			const __m256i value = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&values[i])));
+
+			// Exact in float, estimate is within 1 of the root.
+			__m256i root = _mm256_cvttps_epi32(_mm256_sqrt_ps(_mm256_cvtepi32_ps(value)));
+			root = SquareRootBatches::Correct32(_mm256_min_epi32(root, maxRoot), value, maxRoot);
+
+			const __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(root), _mm256_extracti128_si256(root, 1));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&roots[i]), _mm_packus_epi16(packed, packed));
+		}
+#endif
+		for (; i < count; i++)
+		{
+			roots[i] = SquareRoot16(values[i]);
+		}
+	}
+
+	/// <summary>
+	/// Batch square root of uint32_t values.
+	/// Same floor(sqrt) results as SquareRoot32() for every value.
+	/// On AVX2 targets, roots are seeded with a vectorized float square root and corrected in integer.
+	/// </summary>
+	/// <param name="values">[0 ; UINT32_MAX]</param>
+	/// <param name="roots">[0 ; UINT16_MAX].</param>
+	/// <param name="count">Number of values.</param>
+	static void SquareRoot32Batch(const uint32_t* values, uint16_t* roots, const size_t count)
+	{
+		size_t i = 0;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		const __m256i maxRoot = _mm256_set1_epi32(UINT16_MAX);
+		const __m256i lowMask = _mm256_set1_epi32(UINT16_MAX);
+		const __m256 highScale = _mm256_set1_ps(65536.f);
+		const size_t vectorEnd = count - (count % 8);
+		for (; i < vectorEnd; i += 8)
+		{
+			const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&values[i]));
+
+			// Unsigned to float, from exact 16-bit halves with a single rounding.
+			const __m256 radicand = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(value, 16)), highScale),
+				_mm256_cvtepi32_ps(_mm256_and_si256(value, lowMask)));
+
+			// Float rounding keeps the estimate within 1 of the root.
+			__m256i root = _mm256_cvttps_epi32(_mm256_sqrt_ps(radicand));
+			root = SquareRootBatches::Correct32(_mm256_min_epi32(root, maxRoot), value, maxRoot);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&roots[i]),
+				_mm_packus_epi32(_mm256_castsi256_si128(root), _mm256_extracti128_si256(root, 1)));
+		}
+#endif
+		for (; i < count; i++)
+		{
+			roots[i] = SquareRoot32(values[i]);
+		}
+	}
+
+	/// <summary>
+	/// Batch square root of uint64_t values.
+	/// Same floor(sqrt) results as SquareRoot64() for every value.
+	/// On AVX2 targets, roots are seeded with a vectorized double square root and corrected in integer.
+	/// </summary>
+	/// <param name="values">[0 ; UINT64_MAX]</param>
+	/// <param name="roots">[0 ; UINT32_MAX].</param>
+	/// <param name="count">Number of values.</param>
+	static void SquareRoot64Batch(const uint64_t* values, uint32_t* roots, const size_t count)
+	{
+		size_t i = 0;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		const __m256d magic = _mm256_set1_pd(4503599627370496.); // 2^52
+		const __m256i maxRoot = _mm256_set1_epi64x(UINT32_MAX);
+		const __m256i one = _mm256_set1_epi64x(1);
+		const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+		const __m256i pack = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+		const size_t vectorEnd = count - (count % 4);
+		for (; i < vectorEnd; i += 4)
+		{
+			const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&values[i]));
+			const __m256i signedValue = _mm256_xor_si256(value, sign);
+
+			// Double rounding keeps the estimate within 1 of the root; floor to integer through the 2^52 magic.
+			const __m256d estimate = _mm256_floor_pd(_mm256_sqrt_pd(SquareRootBatches::U64ToDouble(value)));
+			__m256i root = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(estimate, magic)), _mm256_castpd_si256(magic));
+			root = _mm256_blendv_epi8(root, maxRoot, _mm256_cmpgt_epi64(root, maxRoot));
+
+			// Downward: root^2 > value.
+			const __m256i square = _mm256_mul_epu32(root, root);
+			root = _mm256_add_epi64(root, _mm256_cmpgt_epi64(_mm256_xor_si256(square, sign), signedValue));
+
+			// Upward: (root + 1)^2 <= value, only below the largest root.
+			const __m256i next = _mm256_add_epi64(root, one);
+			const __m256i nextSquare = _mm256_mul_epu32(next, next);
+			const __m256i up = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi64(root, maxRoot),
+				_mm256_cmpgt_epi64(_mm256_xor_si256(nextSquare, sign), signedValue)), _mm256_set1_epi64x(-1));
+			root = _mm256_sub_epi64(root, up);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&roots[i]),
+				_mm256_castsi256_si128(_mm256_permutevar8x32_epi32(root, pack)));
+		}
+#endif
+		for (; i < count; i++)
+		{
+			roots[i] = SquareRoot64(values[i]);
+		}
+	}
+}
+#endif
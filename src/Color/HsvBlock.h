@@ -0,0 +1,315 @@
+#ifndef _INTEGER_SIGNAL_COLOR_HSV_BLOCK_h
+#define _INTEGER_SIGNAL_COLOR_HSV_BLOCK_h
+
+#include <stddef.h>
+#include "Hsv.h"
+#include "Rgb8.h"
+#include "Rgb10.h"
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <immintrin.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace HsvBlocks
+	{
+		using namespace FixedPoint::ScalarFraction;
+
+		/// <summary>
+		/// Hue segments, plus the achromatic (saturation == 0) entry.
+		/// </summary>
+		static constexpr uint8_t Segments = 6;
+		static constexpr uint8_t GraySegment = Segments;
+
+		/// <summary>
+		/// Source of the red, green and blue components for each hue segment, as in TemplateHsvFraction().
+		/// 0: value, 1: value minus saturation, 2: value minus saturation portion, 3: value minus inverse saturation portion.
+		/// </summary>
+		static constexpr uint8_t SegmentSources[Segments + 1][3] =
+		{
+			{ 0, 3, 1 },
+			{ 2, 0, 1 },
+			{ 1, 0, 3 },
+			{ 1, 2, 0 },
+			{ 3, 1, 0 },
+			{ 0, 1, 2 },
+			{ 0, 0, 0 }
+		};
+
+		/// <summary>
+		/// Rgb8 output, opaque.
+		/// </summary>
+		struct Rgb8Format
+		{
+			using color_t = Rgb8::color_t;
+			using component_t = Rgb8::component_t;
+			static constexpr component_t COMPONENT_MAX = Rgb8::COMPONENT_MAX;
+
+			static color_t Color(const component_t red, const component_t green, const component_t blue)
+			{
+				return Rgb8::Color(red, green, blue);
+			}
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			static __m256i Color(const __m256i red, const __m256i green, const __m256i blue)
+			{
+				return _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32((int32_t)0xFF000000), _mm256_slli_epi32(red, 16)),
+					_mm256_or_si256(_mm256_slli_epi32(green, 8), blue));
+			}
+#endif
+		};
+
+		/// <summary>
+		/// Rgb10 output, opaque.
+		/// </summary>
+		struct Rgb10Format
+		{
+			using color_t = Rgb10::color_t;
+			using component_t = Rgb10::component_t;
+			static constexpr component_t COMPONENT_MAX = Rgb10::COMPONENT_MAX;
+
+			static color_t Color(const component_t red, const component_t green, const component_t blue)
+			{
+				return Rgb10::Color(red, green, blue);
+			}
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			static __m256i Color(const __m256i red, const __m256i green, const __m256i blue)
+			{
+				const __m256i mask = _mm256_set1_epi32(COMPONENT_MAX);
+
+				return _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32((int32_t)(uint32_t(Rgb10::ALPHA_MAX) << 30)), _mm256_slli_epi32(_mm256_and_si256(blue, mask), 20)),
+					_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(green, mask), 10), _mm256_and_si256(red, mask)));
+			}
+#endif
+		};
+
+		/// <summary>
+		/// Branch-free HSV conversion, same results as TemplateHsvFraction() for every input.
+		/// All 4 component candidates are computed, then selected through the segment table.
+		/// </summary>
+		template<typename Format>
+		static typename Format::color_t HsvFraction(const ufraction16_t hue, const ufraction16_t saturation, const ufraction16_t value)
+		{
+			using component_t = typename Format::component_t;
+
+			const uint32_t hueScaled = uint32_t(hue) * Segments;
+			const uint8_t hueSegment = hueScaled >> 15;
+			const ufraction16_t segmentHue = hueScaled & (UFraction16::FRACTION_1X - 1);
+			const uint8_t segment = (saturation == 0) ? GraySegment : (hueSegment % Segments);
+
+			const component_t valueComp = Fraction(value, Format::COMPONENT_MAX);
+			const ufraction16_t saturationPortion = Fraction(segmentHue, saturation);
+
+			const component_t sources[4] =
+			{
+				valueComp,
+				component_t(valueComp - Fraction(saturation, valueComp)),
+				component_t(valueComp - Fraction(saturationPortion, valueComp)),
+				component_t(valueComp - Fraction(static_cast<ufraction16_t>(UFraction16::FRACTION_1X - saturationPortion), valueComp))
+			};
+
+			return Format::Color(sources[SegmentSources[segment][0]], sources[SegmentSources[segment][1]], sources[SegmentSources[segment][2]]);
+		}
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		/// <summary>
+		/// (a * b) >> 15 for 32-bit lanes, products must fit in 32 bits.
+		/// </summary>
+		static __m256i Fraction32(const __m256i a, const __m256i b)
+		{
+			return _mm256_srli_epi32(_mm256_mullo_epi32(a, b), 15);
+		}
+
+		/// <summary>
+		/// Component selection for a channel, from the per-lane segment.
+		/// </summary>
+		static __m256i Select(const uint8_t channel, const __m256i segment, const __m256i* sources)
+		{
+			const __m256i table = _mm256_setr_epi32(SegmentSources[0][channel], SegmentSources[1][channel], SegmentSources[2][channel],
+				SegmentSources[3][channel], SegmentSources[4][channel], SegmentSources[5][channel], SegmentSources[6][channel], 0);
+			const __m256i index = _mm256_permutevar8x32_epi32(table, segment);
+
+			__m256i component = sources[0];
+			component = _mm256_blendv_epi8(component, sources[1], _mm256_cmpeq_epi32(index, _mm256_set1_epi32(1)));
+			component = _mm256_blendv_epi8(component, sources[2], _mm256_cmpeq_epi32(index, _mm256_set1_epi32(2)));
+			component = _mm256_blendv_epi8(component, sources[3], _mm256_cmpeq_epi32(index, _mm256_set1_epi32(3)));
+
+			return component;
+		}
+
+		/// <summary>
+		/// 8 pixels of HsvFraction(), from zero-extended ufraction16_t in 32-bit lanes.
+		/// </summary>
+		template<typename Format>
+		static __m256i HsvFraction(const __m256i hue, const __m256i saturation, const __m256i value)
+		{
+			const __m256i componentMask = _mm256_set1_epi32((typename Format::component_t)~0);
+			const __m256i fractionMask = _mm256_set1_epi32(UINT16_MAX);
+
+			const __m256i hueScaled = _mm256_mullo_epi32(hue, _mm256_set1_epi32(Segments));
+			const __m256i segmentHue = _mm256_and_si256(hueScaled, _mm256_set1_epi32(UFraction16::FRACTION_1X - 1));
+
+			// Segment modulo 6 (hue up to UINT16_MAX spans 12 segments), gray when saturation is zero.
+			__m256i segment = _mm256_srli_epi32(hueScaled, 15);
+			segment = _mm256_sub_epi32(segment, _mm256_and_si256(_mm256_cmpgt_epi32(segment, _mm256_set1_epi32(Segments - 1)), _mm256_set1_epi32(Segments)));
+			segment = _mm256_blendv_epi8(segment, _mm256_set1_epi32(GraySegment), _mm256_cmpeq_epi32(saturation, _mm256_setzero_si256()));
+
+			const __m256i valueComp = _mm256_and_si256(Fraction32(value, _mm256_set1_epi32(Format::COMPONENT_MAX)), componentMask);
+			const __m256i saturationPortion = _mm256_and_si256(Fraction32(segmentHue, saturation), fractionMask);
+			const __m256i inversePortion = _mm256_and_si256(_mm256_sub_epi32(_mm256_set1_epi32(UFraction16::FRACTION_1X), saturationPortion), fractionMask);
+
+			const __m256i sources[4] =
+			{
+				valueComp,
+				_mm256_and_si256(_mm256_sub_epi32(valueComp, Fraction32(saturation, valueComp)), componentMask),
+				_mm256_and_si256(_mm256_sub_epi32(valueComp, Fraction32(saturationPortion, valueComp)), componentMask),
+				_mm256_and_si256(_mm256_sub_epi32(valueComp, Fraction32(inversePortion, valueComp)), componentMask)
+			};
+
+			return Format::Color(Select(0, segment, sources), Select(1, segment, sources), Select(2, segment, sources));
+		}
+
+		static __m256i Load16(const ufraction16_t* values)
+		{
+			return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+		}
+
+		/// <summary>
+		/// 8 interleaved HSV triplets to 3 planes of zero-extended 32-bit lanes.
+		/// </summary>
+		static void Deinterleave(const ufraction16_t* hsv, __m256i& hue, __m256i& saturation, __m256i& value)
+		{
+			const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&hsv[0]));
+			const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&hsv[8]));
+			const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&hsv[16]));
+
+			// Triplet elements 0, 3, 6 ... of each 8 element load, gathered in order.
+			const __m128i h = _mm_or_si128(_mm_or_si128(
+				_mm_shuffle_epi8(a, _mm_setr_epi8(0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+				_mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1))),
+				_mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11)));
+			const __m128i s = _mm_or_si128(_mm_or_si128(
+				_mm_shuffle_epi8(a, _mm_setr_epi8(2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+				_mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1))),
+				_mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13)));
+			const __m128i v = _mm_or_si128(_mm_or_si128(
+				_mm_shuffle_epi8(a, _mm_setr_epi8(4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+				_mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1))),
+				_mm_shuffle_epi8(c, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15)));
+
+			hue = _mm256_cvtepu16_epi32(h);
+			saturation = _mm256_cvtepu16_epi32(s);
+			value = _mm256_cvtepu16_epi32(v);
+		}
+#endif
+
+		/// <summary>
+		/// Planar hue, saturation and value arrays.
+		/// </summary>
+		template<typename Format>
+		static void HsvFractionBlock(const ufraction16_t* hue, const ufraction16_t* saturation, const ufraction16_t* value,
+			typename Format::color_t* output, const size_t count)
+		{
+			size_t i = 0;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			const size_t vectorEnd = count - (count % 8);
+			for (; i < vectorEnd; i += 8)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+					HsvFraction<Format>(Load16(&hue[i]), Load16(&saturation[i]), Load16(&value[i])));
+			}
+#endif
+			for (; i < count; i++)
+			{
+				output[i] = HsvFraction<Format>(hue[i], saturation[i], value[i]);
+			}
+		}
+
+		/// <summary>
+		/// Interleaved hue, saturation and value triplets.
+		/// </summary>
+		template<typename Format>
+		static void HsvFractionBlock(const ufraction16_t* hsv, typename Format::color_t* output, const size_t count)
+		{
+			size_t i = 0;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			const size_t vectorEnd = count - (count % 8);
+			for (; i < vectorEnd; i += 8)
+			{
+				__m256i hue, saturation, value;
+				Deinterleave(&hsv[i * 3], hue, saturation, value);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]), HsvFraction<Format>(hue, saturation, value));
+			}
+#endif
+			for (; i < count; i++)
+			{
+				output[i] = HsvFraction<Format>(hsv[i * 3], hsv[(i * 3) + 1], hsv[(i * 3) + 2]);
+			}
+		}
+	}
+
+	namespace Rgb8
+	{
+		/// <summary>
+		/// Convert planar HSV (UQ0.15) arrays to RGB8.
+		/// Same results as ColorHsvFraction() for every pixel.
+		/// Branch-free, with a per hue segment component table. On AVX2 targets, 8 pixels are converted at once.
+		/// </summary>
+		/// <param name="hue">Hues in [0, UFraction16::FRACTION_1X], wrap at unit.</param>
+		/// <param name="saturation">Saturations in [0, UFraction16::FRACTION_1X].</param>
+		/// <param name="value">Values (brightness) in [0, UFraction16::FRACTION_1X].</param>
+		/// <param name="output">Packed RGB8 colors (alpha = 255).</param>
+		/// <param name="count">Number of pixels.</param>
+		static void ColorHsvFractionBlock(const ufraction16_t* hue, const ufraction16_t* saturation, const ufraction16_t* value, color_t* output, const size_t count)
+		{
+			HsvBlocks::HsvFractionBlock<HsvBlocks::Rgb8Format>(hue, saturation, value, output, count);
+		}
+
+		/// <summary>
+		/// Convert interleaved HSV (UQ0.15) triplets to RGB8.
+		/// Same results as ColorHsvFraction() for every pixel.
+		/// </summary>
+		/// <param name="hsv">Hue, saturation and value triplets, count * 3 elements.</param>
+		/// <param name="output">Packed RGB8 colors (alpha = 255).</param>
+		/// <param name="count">Number of pixels.</param>
+		static void ColorHsvFractionBlock(const ufraction16_t* hsv, color_t* output, const size_t count)
+		{
+			HsvBlocks::HsvFractionBlock<HsvBlocks::Rgb8Format>(hsv, output, count);
+		}
+	}
+
+	namespace Rgb10
+	{
+		/// <summary>
+		/// Convert planar HSV (UQ0.15) arrays to ARGB10.
+		/// Same results as ColorHsvFraction() for every pixel.
+		/// Branch-free, with a per hue segment component table. On AVX2 targets, 8 pixels are converted at once.
+		/// </summary>
+		/// <param name="hue">Hues in [0, UFraction16::FRACTION_1X], wrap at unit.</param>
+		/// <param name="saturation">Saturations in [0, UFraction16::FRACTION_1X].</param>
+		/// <param name="value">Values (brightness) in [0, UFraction16::FRACTION_1X].</param>
+		/// <param name="output">Packed ARGB10 colors (alpha = ALPHA_MAX).</param>
+		/// <param name="count">Number of pixels.</param>
+		static void ColorHsvFractionBlock(const ufraction16_t* hue, const ufraction16_t* saturation, const ufraction16_t* value, color_t* output, const size_t count)
+		{
+			HsvBlocks::HsvFractionBlock<HsvBlocks::Rgb10Format>(hue, saturation, value, output, count);
+		}
+
+		/// <summary>
+		/// Convert interleaved HSV (UQ0.15) triplets to ARGB10.
+		/// Same results as ColorHsvFraction() for every pixel.
+		/// </summary>
+		/// <param name="hsv">Hue, saturation and value triplets, count * 3 elements.</param>
+		/// <param name="output">Packed ARGB10 colors (alpha = ALPHA_MAX).</param>
+		/// <param name="count">Number of pixels.</param>
+		static void ColorHsvFractionBlock(const ufraction16_t* hsv, color_t* output, const size_t count)
+		{
+			HsvBlocks::HsvFractionBlock<HsvBlocks::Rgb10Format>(hsv, output, count);
+		}
+	}
+}
+#endif
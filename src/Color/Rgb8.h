@@ -163,6 +163,18 @@ namespace IntegerSignal
 			);
 		}
 
+		/// <summary>
+		/// Alpha blend of a foreground color over a background color.
+		/// The foreground alpha [0..255] is mapped to a UQ0.15 fraction, then linearly interpolated from the background.
+		/// </summary>
+		/// <param name="background">Background color (packed 0xAARRGGBB), alpha is ignored.</param>
+		/// <param name="foreground">Foreground color (packed 0xAARRGGBB), alpha is the blend weight.</param>
+		/// <returns>Blended opaque color (alpha = 255).</returns>
+		static color_t ColorAlphaBlend(const color_t& background, const color_t& foreground)
+		{
+			return ColorInterpolateLinear(background, foreground, UFraction16::GetScalar(Alpha(foreground), COMPONENT_MAX));
+		}
+
 		/// <summary>
 		/// Weighted RMS interpolation between two colors using a Q-format unsigned fraction (UQ0.15).
 		/// For each component c: result = sqrt((w1*c1)^2 + (w2*c2)^2), where w1 = (1 - fraction), w2 = fraction.
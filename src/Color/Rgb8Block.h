@@ -0,0 +1,443 @@
+#ifndef _INTEGER_SIGNAL_COLOR_RGB8_BLOCK_h
+#define _INTEGER_SIGNAL_COLOR_RGB8_BLOCK_h
+
+#include <stddef.h>
+#include "Rgb8.h"
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <arm_neon.h>
+#elif defined(__SSE2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <emmintrin.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace Rgb8Blocks
+	{
+		using namespace Rgb8;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		/// <summary>
+		/// Components [0..255] in 16-bit lanes by ufraction16_t scalars: (component * scalar) >> 15, as Fraction().
+		/// Doubling the component keeps the whole result in the high product half.
+		/// </summary>
+		static __m256i Weight(const __m256i components, const __m256i scalars)
+		{
+			return _mm256_mulhi_epu16(_mm256_slli_epi16(components, 1), scalars);
+		}
+
+		/// <summary>
+		/// Alpha [0..255] in 16-bit lanes to ufraction16_t, as UFraction16::GetScalar(alpha, 255).
+		/// alpha * 2^15 / 255 = 128 * alpha + (128 * alpha) / 255, with an exact division by 255 for 16-bit numerators.
+		/// </summary>
+		static __m256i AlphaFraction(const __m256i alpha)
+		{
+			const __m256i scaled = _mm256_slli_epi16(alpha, 7);
+			const __m256i remainder = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(scaled, _mm256_set1_epi16(1)), _mm256_srli_epi16(scaled, 8)), 8);
+
+			return _mm256_add_epi16(scaled, remainder);
+		}
+
+		/// <summary>
+		/// Per component, as ColorInterpolateLinear().
+		/// </summary>
+		struct Linear
+		{
+			static __m256i Apply(const __m256i from, const __m256i to, const __m256i fraction, const __m256i inverse)
+			{
+				return _mm256_add_epi16(Weight(from, inverse), Weight(to, fraction));
+			}
+		};
+
+		/// <summary>
+		/// Per component, as ColorInterpolate().
+		/// Sums of squares are at most 255^2, float square roots of integers below 2^16 truncate to the exact floor(sqrt).
+		/// </summary>
+		struct Rms
+		{
+			static __m256i Apply(const __m256i from, const __m256i to, const __m256i fraction, const __m256i inverse)
+			{
+				const __m256i x = Weight(from, inverse);
+				const __m256i y = Weight(to, fraction);
+				const __m256i sum = _mm256_add_epi16(_mm256_mullo_epi16(x, x), _mm256_mullo_epi16(y, y));
+
+				const __m256i zero = _mm256_setzero_si256();
+
+				return _mm256_packus_epi32(SquareRoot(_mm256_unpacklo_epi16(sum, zero)), SquareRoot(_mm256_unpackhi_epi16(sum, zero)));
+			}
+
+		private:
+			static __m256i SquareRoot(const __m256i squares)
+			{
+				return _mm256_cvttps_epi32(_mm256_sqrt_ps(_mm256_cvtepi32_ps(squares)));
+			}
+		};
+
+		/// <summary>
+		/// 8 pixels from the component kernel, on the low and high 16-bit halves of each 128-bit lane.
+		/// Unpack and pack both work per 128-bit lane, so the pixel order is kept. Alpha is forced to 255.
+		/// </summary>
+		template<typename Kernel>
+		static __m256i Pixels(const __m256i from, const __m256i to,
+			const __m256i lowFraction, const __m256i highFraction)
+		{
+			const __m256i zero = _mm256_setzero_si256();
+			const __m256i unit = _mm256_set1_epi16((int16_t)UFraction16::FRACTION_1X);
+
+			const __m256i low = Kernel::Apply(_mm256_unpacklo_epi8(from, zero), _mm256_unpacklo_epi8(to, zero),
+				lowFraction, _mm256_sub_epi16(unit, lowFraction));
+			const __m256i high = Kernel::Apply(_mm256_unpackhi_epi8(from, zero), _mm256_unpackhi_epi8(to, zero),
+				highFraction, _mm256_sub_epi16(unit, highFraction));
+
+			return _mm256_or_si256(_mm256_packus_epi16(low, high), _mm256_set1_epi32((int32_t)0xFF000000));
+		}
+
+		template<typename Kernel>
+		static size_t Interpolate(const ufraction16_t fraction, const color_t* from, const color_t* to, color_t* output, const size_t count)
+		{
+			const __m256i fractions = _mm256_set1_epi16((int16_t)fraction);
+
+			size_t i = 0;
+			const size_t vectorEnd = count - (count % 8);
+			for (; i < vectorEnd; i += 8)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+					Pixels<Kernel>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&from[i])),
+						_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&to[i])),
+						fractions, fractions));
+			}
+
+			return i;
+		}
+
+		static size_t AlphaBlend(const color_t* background, const color_t* foreground, color_t* output, const size_t count)
+		{
+			// Foreground alpha byte to all 4 components of its pixel.
+			const __m256i broadcast = _mm256_setr_epi8(
+				3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+				3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+			const __m256i zero = _mm256_setzero_si256();
+
+			size_t i = 0;
+			const size_t vectorEnd = count - (count % 8);
+			for (; i < vectorEnd; i += 8)
+			{
+				const __m256i back = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&background[i]));
+				const __m256i front = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&foreground[i]));
+				const __m256i alpha = _mm256_shuffle_epi8(front, broadcast);
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+					Pixels<Linear>(back, front,
+						AlphaFraction(_mm256_unpacklo_epi8(alpha, zero)),
+						AlphaFraction(_mm256_unpackhi_epi8(alpha, zero))));
+			}
+
+			return i;
+		}
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		/// <summary>
+		/// Components [0..255] in 16-bit lanes by ufraction16_t scalars: (component * scalar) >> 15, as Fraction().
+		/// </summary>
+		static uint16x8_t Weight(const uint16x8_t components, const uint16x8_t scalars)
+		{
+			return vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(components), vget_low_u16(scalars)), 15),
+				vshrn_n_u32(vmull_u16(vget_high_u16(components), vget_high_u16(scalars)), 15));
+		}
+
+		/// <summary>
+		/// Alpha [0..255] in 16-bit lanes to ufraction16_t, as UFraction16::GetScalar(alpha, 255).
+		/// alpha * 2^15 / 255 = 128 * alpha + (128 * alpha) / 255, with an exact division by 255 for 16-bit numerators.
+		/// </summary>
+		static uint16x8_t AlphaFraction(const uint16x8_t alpha)
+		{
+			const uint16x8_t scaled = vshlq_n_u16(alpha, 7);
+			const uint16x8_t remainder = vshrq_n_u16(vaddq_u16(vaddq_u16(scaled, vdupq_n_u16(1)), vshrq_n_u16(scaled, 8)), 8);
+
+			return vaddq_u16(scaled, remainder);
+		}
+
+		/// <summary>
+		/// Per component, as ColorInterpolateLinear().
+		/// </summary>
+		struct Linear
+		{
+			static uint16x8_t Apply(const uint16x8_t from, const uint16x8_t to, const uint16x8_t fraction, const uint16x8_t inverse)
+			{
+				return vaddq_u16(Weight(from, inverse), Weight(to, fraction));
+			}
+		};
+
+		/// <summary>
+		/// Per component, as ColorInterpolate().
+		/// Sums of squares are at most 255^2, so a bitwise integer square root over 8 bits gives the exact floor(sqrt).
+		/// </summary>
+		struct Rms
+		{
+			static uint16x8_t Apply(const uint16x8_t from, const uint16x8_t to, const uint16x8_t fraction, const uint16x8_t inverse)
+			{
+				const uint16x8_t x = Weight(from, inverse);
+				const uint16x8_t y = Weight(to, fraction);
+
+				return SquareRoot(vaddq_u16(vmulq_u16(x, x), vmulq_u16(y, y)));
+			}
+
+		private:
+			static uint16x8_t SquareRoot(const uint16x8_t squares)
+			{
+				uint16x8_t root = vdupq_n_u16(0);
+				for (uint16_t bit = 1 << 7; bit != 0; bit >>= 1)
+				{
+					const uint16x8_t candidate = vorrq_u16(root, vdupq_n_u16(bit));
+
+					root = vbslq_u16(vcleq_u16(vmulq_u16(candidate, candidate), squares), candidate, root);
+				}
+
+				return root;
+			}
+		};
+
+		/// <summary>
+		/// 8 pixels from the component kernel, de-interleaved to one 16-bit vector per component. Alpha is forced to 255.
+		/// </summary>
+		template<typename Kernel>
+		static uint8x8x4_t Pixels(const uint8x8x4_t from, const uint8x8x4_t to, const uint16x8_t fraction)
+		{
+			const uint16x8_t inverse = vsubq_u16(vdupq_n_u16(UFraction16::FRACTION_1X), fraction);
+
+			uint8x8x4_t pixels;
+			for (uint8_t c = 0; c < 3; c++)
+			{
+				pixels.val[c] = vqmovn_u16(Kernel::Apply(vmovl_u8(from.val[c]), vmovl_u8(to.val[c]), fraction, inverse));
+			}
+			pixels.val[3] = vdup_n_u8(UINT8_MAX);
+
+			return pixels;
+		}
+
+		template<typename Kernel>
+		static size_t Interpolate(const ufraction16_t fraction, const color_t* from, const color_t* to, color_t* output, const size_t count)
+		{
+			const uint16x8_t fractions = vdupq_n_u16(fraction);
+
+			size_t i = 0;
+			const size_t vectorEnd = count - (count % 8);
+			for (; i < vectorEnd; i += 8)
+			{
+				vst4_u8(reinterpret_cast<uint8_t*>(&output[i]),
+					Pixels<Kernel>(vld4_u8(reinterpret_cast<const uint8_t*>(&from[i])),
+						vld4_u8(reinterpret_cast<const uint8_t*>(&to[i])),
+						fractions));
+			}
+
+			return i;
+		}
+
+		static size_t AlphaBlend(const color_t* background, const color_t* foreground, color_t* output, const size_t count)
+		{
+			size_t i = 0;
+			const size_t vectorEnd = count - (count % 8);
+			for (; i < vectorEnd; i += 8)
+			{
+				const uint8x8x4_t front = vld4_u8(reinterpret_cast<const uint8_t*>(&foreground[i]));
+
+				vst4_u8(reinterpret_cast<uint8_t*>(&output[i]),
+					Pixels<Linear>(vld4_u8(reinterpret_cast<const uint8_t*>(&background[i])), front,
+						AlphaFraction(vmovl_u8(front.val[3]))));
+			}
+
+			return i;
+		}
+#elif defined(__SSE2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+		/// <summary>
+		/// Components [0..255] in 16-bit lanes by ufraction16_t scalars: (component * scalar) >> 15, as Fraction().
+		/// Doubling the component keeps the whole result in the high product half.
+		/// </summary>
+		static __m128i Weight(const __m128i components, const __m128i scalars)
+		{
+			return _mm_mulhi_epu16(_mm_slli_epi16(components, 1), scalars);
+		}
+
+		/// <summary>
+		/// Alpha [0..255] in 16-bit lanes to ufraction16_t, as UFraction16::GetScalar(alpha, 255).
+		/// alpha * 2^15 / 255 = 128 * alpha + (128 * alpha) / 255, with an exact division by 255 for 16-bit numerators.
+		/// </summary>
+		static __m128i AlphaFraction(const __m128i alpha)
+		{
+			const __m128i scaled = _mm_slli_epi16(alpha, 7);
+			const __m128i remainder = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(scaled, _mm_set1_epi16(1)), _mm_srli_epi16(scaled, 8)), 8);
+
+			return _mm_add_epi16(scaled, remainder);
+		}
+
+		/// <summary>
+		/// Per component, as ColorInterpolateLinear().
+		/// </summary>
+		struct Linear
+		{
+			static __m128i Apply(const __m128i from, const __m128i to, const __m128i fraction, const __m128i inverse)
+			{
+				return _mm_add_epi16(Weight(from, inverse), Weight(to, fraction));
+			}
+		};
+
+		/// <summary>
+		/// Per component, as ColorInterpolate().
+		/// Sums of squares are at most 255^2, float square roots of integers below 2^16 truncate to the exact floor(sqrt).
+		/// Roots fit in 16 bits, so the signed pack is enough without SSE4.1.
+		/// </summary>
+		struct Rms
+		{
+			static __m128i Apply(const __m128i from, const __m128i to, const __m128i fraction, const __m128i inverse)
+			{
+				const __m128i x = Weight(from, inverse);
+				const __m128i y = Weight(to, fraction);
+				const __m128i sum = _mm_add_epi16(_mm_mullo_epi16(x, x), _mm_mullo_epi16(y, y));
+
+				const __m128i zero = _mm_setzero_si128();
+
+				return _mm_packs_epi32(SquareRoot(_mm_unpacklo_epi16(sum, zero)), SquareRoot(_mm_unpackhi_epi16(sum, zero)));
+			}
+
+		private:
+			static __m128i SquareRoot(const __m128i squares)
+			{
+				return _mm_cvttps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(squares)));
+			}
+		};
+
+		/// <summary>
+		/// 4 pixels from the component kernel, 2 pixels on each of the low and high 16-bit halves. Alpha is forced to 255.
+		/// </summary>
+		template<typename Kernel>
+		static __m128i Pixels(const __m128i from, const __m128i to,
+			const __m128i lowFraction, const __m128i highFraction)
+		{
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i unit = _mm_set1_epi16((int16_t)UFraction16::FRACTION_1X);
+
+			const __m128i low = Kernel::Apply(_mm_unpacklo_epi8(from, zero), _mm_unpacklo_epi8(to, zero),
+				lowFraction, _mm_sub_epi16(unit, lowFraction));
+			const __m128i high = Kernel::Apply(_mm_unpackhi_epi8(from, zero), _mm_unpackhi_epi8(to, zero),
+				highFraction, _mm_sub_epi16(unit, highFraction));
+
+			return _mm_or_si128(_mm_packus_epi16(low, high), _mm_set1_epi32((int32_t)0xFF000000));
+		}
+
+		template<typename Kernel>
+		static size_t Interpolate(const ufraction16_t fraction, const color_t* from, const color_t* to, color_t* output, const size_t count)
+		{
+			const __m128i fractions = _mm_set1_epi16((int16_t)fraction);
+
+			size_t i = 0;
+			const size_t vectorEnd = count - (count % 4);
+			for (; i < vectorEnd; i += 4)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]),
+					Pixels<Kernel>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&from[i])),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(&to[i])),
+						fractions, fractions));
+			}
+
+			return i;
+		}
+
+		static size_t AlphaBlend(const color_t* background, const color_t* foreground, color_t* output, const size_t count)
+		{
+			size_t i = 0;
+			const size_t vectorEnd = count - (count % 4);
+			for (; i < vectorEnd; i += 4)
+			{
+				const __m128i back = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&background[i]));
+				const __m128i front = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&foreground[i]));
+
+				// Foreground alpha to both 16-bit halves of its pixel, then to the 4 component lanes.
+				const __m128i alpha = _mm_srli_epi32(front, 24);
+				const __m128i pairs = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]),
+					Pixels<Linear>(back, front,
+						AlphaFraction(_mm_unpacklo_epi32(pairs, pairs)),
+						AlphaFraction(_mm_unpackhi_epi32(pairs, pairs))));
+			}
+
+			return i;
+		}
+#endif
+	}
+
+	namespace Rgb8
+	{
+		/// <summary>
+		/// Linear interpolation of a row of colors, with a single fraction for the whole row.
+		/// Same results as ColorInterpolateLinear() for every pixel.
+		/// On AVX2 and NEON targets, 8 pixels are processed at once in 16-bit component lanes, 4 pixels on SSE2 targets.
+		/// </summary>
+		/// <param name="fraction">ufraction16_t in [0, UFraction16::FRACTION_1X]. 0 returns 'from', unit returns 'to'.</param>
+		/// <param name="from">Start colors.</param>
+		/// <param name="to">End colors.</param>
+		/// <param name="output">Interpolated colors, may alias from or to.</param>
+		/// <param name="count">Number of pixels.</param>
+		static void ColorInterpolateLinearBlock(const ufraction16_t fraction, const color_t* from, const color_t* to, color_t* output, const size_t count)
+		{
+			size_t i = 0;
+
+#if (defined(__AVX2__) || defined(__ARM_NEON) || defined(__SSE2__)) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			i = Rgb8Blocks::Interpolate<Rgb8Blocks::Linear>(fraction, from, to, output, count);
+#endif
+			for (; i < count; i++)
+			{
+				output[i] = ColorInterpolateLinear(from[i], to[i], fraction);
+			}
+		}
+
+		/// <summary>
+		/// Weighted RMS interpolation of a row of colors, with a single fraction for the whole row.
+		/// Same results as ColorInterpolate() for every pixel.
+		/// On AVX2 and SSE2 targets, 8 and 4 pixels are processed at once, with a vectorized float square root.
+		/// On NEON targets, 8 pixels are processed at once, with a bitwise integer square root.
+		/// </summary>
+		/// <param name="fraction">ufraction16_t in [0, UFraction16::FRACTION_1X]. 0 returns 'from', unit returns 'to'.</param>
+		/// <param name="from">Start colors.</param>
+		/// <param name="to">End colors.</param>
+		/// <param name="output">Interpolated colors, may alias from or to.</param>
+		/// <param name="count">Number of pixels.</param>
+		static void ColorInterpolateBlock(const ufraction16_t fraction, const color_t* from, const color_t* to, color_t* output, const size_t count)
+		{
+			size_t i = 0;
+
+#if (defined(__AVX2__) || defined(__ARM_NEON) || defined(__SSE2__)) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			i = Rgb8Blocks::Interpolate<Rgb8Blocks::Rms>(fraction, from, to, output, count);
+#endif
+			for (; i < count; i++)
+			{
+				output[i] = ColorInterpolate(from[i], to[i], fraction);
+			}
+		}
+
+		/// <summary>
+		/// Alpha blend of a row of foreground colors over a row of background colors.
+		/// Same results as ColorAlphaBlend() for every pixel.
+		/// On AVX2 and NEON targets, 8 pixels are processed at once, with per-pixel fractions from the foreground alpha.
+		/// On SSE2 targets, 4 pixels are processed at once.
+		/// </summary>
+		/// <param name="background">Background colors.</param>
+		/// <param name="foreground">Foreground colors, alpha is the blend weight.</param>
+		/// <param name="output">Blended opaque colors, may alias background or foreground.</param>
+		/// <param name="count">Number of pixels.</param>
+		static void ColorAlphaBlendBlock(const color_t* background, const color_t* foreground, color_t* output, const size_t count)
+		{
+			size_t i = 0;
+
+#if (defined(__AVX2__) || defined(__ARM_NEON) || defined(__SSE2__)) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			i = Rgb8Blocks::AlphaBlend(background, foreground, output, count);
+#endif
+			for (; i < count; i++)
+			{
+				output[i] = ColorAlphaBlend(background[i], foreground[i]);
+			}
+		}
+	}
+}
+#endif
@@ -4,6 +4,7 @@
 #define _I_CURVE_h
 
 #include <stdint.h>
+#include <stddef.h>
 
 namespace IntegerSignal
 {
@@ -48,6 +49,31 @@ namespace IntegerSignal
 					return CurveType::Get(input);
 				}
 			};
+
+			/// <summary>
+			/// Applies a Curve to contiguous blocks of samples.
+			/// Matches the filters' ProcessBlock, so curves can be used by block processors (e.g. Stream::SpscRing).
+			/// </summary>
+			/// <typeparam name="CurveType"></typeparam>
+			/// <typeparam name="value_t"></typeparam>
+			template<typename CurveType,
+				typename value_t>
+			struct Block
+			{
+				/// <summary>
+				/// Curves a block of samples.
+				/// </summary>
+				/// <param name="input">Input samples.</param>
+				/// <param name="output">Curved samples, may alias input.</param>
+				/// <param name="count">Number of samples.</param>
+				static void ProcessBlock(const value_t* input, value_t* output, const size_t count)
+				{
+					for (size_t i = 0; i < count; i++)
+					{
+						output[i] = CurveType::Get(input[i]);
+					}
+				}
+			};
 		}
 	}
 }
@@ -0,0 +1,694 @@
+// Biquad.h
+
+#ifndef _INTEGER_SIGNAL_BIQUAD_FILTER_h
+#define _INTEGER_SIGNAL_BIQUAD_FILTER_h
+
+#include "IFilter.h"
+#include "FilterBank.h"
+#include "../FixedPoint/ScalarFraction.h"
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Biquad
+		{
+			/// <summary>
+			/// Normalized (a0 = 1) biquad section coefficients, in the signed Q-format of Format.
+			/// y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] - a1 * y[n-1] - a2 * y[n-2]
+			/// Each coefficient must be in [-2 ; 2[, as the full range of the Q-format scalar.
+			/// </summary>
+			/// <typeparam name="Format">Signed Q-format (Fraction16, Fraction32).</typeparam>
+			template<typename Format>
+			struct Coefficients
+			{
+				using scalar_t = typename Format::scalar_t;
+
+				scalar_t B0;
+				scalar_t B1;
+				scalar_t B2;
+				scalar_t A1;
+				scalar_t A2;
+			};
+
+			/// <summary>
+			/// Compile-time (C++11 constexpr) coefficient designers, from the RBJ Audio EQ Cookbook.
+			/// Frequencies are normalized to the sample rate, in ]0 ; 0.5[.
+			/// Coefficients are rounded to the nearest and saturated to [-2 ; 2[.
+			/// Low-pass and high-pass zeros are kept exact, for exact unit or null DC gain.
+			/// </summary>
+			namespace Design
+			{
+				static constexpr double Pi = 3.14159265358979323846;
+
+				/// <summary>
+				/// Next Taylor series term, -term * x^2 / (n * (n + 1)).
+				/// </summary>
+				static constexpr double GetTerm(const double x, const double term, const uint8_t n)
+				{
+					return -term * x * x / ((double)n * (n + 1));
+				}
+
+				/// <summary>
+				/// Accumulates the Taylor series terms from n, up to the 40th order.
+				/// </summary>
+				static constexpr double Series(const double x, const double sum, const double term, const uint8_t n)
+				{
+					return (n < 40) ? Series(x, sum + GetTerm(x, term, n), GetTerm(x, term, n), n + 2) : sum;
+				}
+
+				/// <summary>
+				/// Taylor series sine, for x in [0 ; Pi].
+				/// </summary>
+				static constexpr double Sine(const double x)
+				{
+					return Series(x, x, x, 2);
+				}
+
+				/// <summary>
+				/// Taylor series cosine, for x in [0 ; Pi].
+				/// </summary>
+				static constexpr double Cosine(const double x)
+				{
+					return Series(x, 1, 1, 1);
+				}
+
+				/// <summary>
+				/// Rounds to the nearest and saturates a scaled coefficient.
+				/// </summary>
+				template<typename scalar_t>
+				static constexpr scalar_t RoundSaturate(const double scaled)
+				{
+					return (scaled >= (double)TypeTraits::TypeLimits::type_limits<scalar_t>::Max()) ? TypeTraits::TypeLimits::type_limits<scalar_t>::Max()
+						: (scaled <= (double)TypeTraits::TypeLimits::type_limits<scalar_t>::Min()) ? TypeTraits::TypeLimits::type_limits<scalar_t>::Min()
+						: (scaled >= 0) ? scalar_t(scaled + 0.5)
+						: scalar_t(-scalar_t(-scaled + 0.5));
+				}
+
+				template<typename Format>
+				static constexpr typename Format::scalar_t GetScalar(const double value)
+				{
+					return RoundSaturate<typename Format::scalar_t>(value * (double)Format::FRACTION_1X);
+				}
+
+				/// <summary>
+				/// Normalizes the cookbook coefficients by a0.
+				/// </summary>
+				template<typename Format>
+				static constexpr Coefficients<Format> Normalize(const double b0, const double b1, const double b2,
+					const double a0, const double a1, const double a2)
+				{
+					return Coefficients<Format>{ GetScalar<Format>(b0 / a0), GetScalar<Format>(b1 / a0), GetScalar<Format>(b2 / a0),
+						GetScalar<Format>(a1 / a0), GetScalar<Format>(a2 / a0) };
+				}
+
+				/// <summary>
+				/// Sets b1 to exactly +-2 * b0 and b2 to b0, so the rounded zeros stay on z = -1 or z = 1.
+				/// </summary>
+				template<typename Format>
+				static constexpr Coefficients<Format> DoubleZero(const Coefficients<Format> coefficients, const int8_t sign)
+				{
+					return Coefficients<Format>{ coefficients.B0, typename Format::scalar_t(sign * 2 * coefficients.B0), coefficients.B0,
+						coefficients.A1, coefficients.A2 };
+				}
+
+				/// <summary>
+				/// Second-order low-pass.
+				/// </summary>
+				/// <param name="frequency">Cutoff frequency / sample rate, ]0 ; 0.5[.</param>
+				/// <param name="q">Quality factor, 0.7071 for Butterworth.</param>
+				template<typename Format>
+				static constexpr Coefficients<Format> LowPass(const double frequency, const double q = 0.7071067811865476)
+				{
+					return DoubleZero<Format>(Normalize<Format>((1 - Cosine(2 * Pi * frequency)) / 2,
+						1 - Cosine(2 * Pi * frequency),
+						(1 - Cosine(2 * Pi * frequency)) / 2,
+						1 + Sine(2 * Pi * frequency) / (2 * q),
+						-2 * Cosine(2 * Pi * frequency),
+						1 - Sine(2 * Pi * frequency) / (2 * q)), 1);
+				}
+
+				/// <summary>
+				/// Second-order high-pass.
+				/// </summary>
+				/// <param name="frequency">Cutoff frequency / sample rate, ]0 ; 0.5[.</param>
+				/// <param name="q">Quality factor, 0.7071 for Butterworth.</param>
+				template<typename Format>
+				static constexpr Coefficients<Format> HighPass(const double frequency, const double q = 0.7071067811865476)
+				{
+					return DoubleZero<Format>(Normalize<Format>((1 + Cosine(2 * Pi * frequency)) / 2,
+						-(1 + Cosine(2 * Pi * frequency)),
+						(1 + Cosine(2 * Pi * frequency)) / 2,
+						1 + Sine(2 * Pi * frequency) / (2 * q),
+						-2 * Cosine(2 * Pi * frequency),
+						1 - Sine(2 * Pi * frequency) / (2 * q)), -1);
+				}
+
+				/// <summary>
+				/// Second-order band-pass, 0 dB peak gain.
+				/// </summary>
+				/// <param name="frequency">Center frequency / sample rate, ]0 ; 0.5[.</param>
+				/// <param name="q">Quality factor, center frequency / bandwidth.</param>
+				template<typename Format>
+				static constexpr Coefficients<Format> BandPass(const double frequency, const double q)
+				{
+					return Normalize<Format>(Sine(2 * Pi * frequency) / (2 * q),
+						0,
+						-Sine(2 * Pi * frequency) / (2 * q),
+						1 + Sine(2 * Pi * frequency) / (2 * q),
+						-2 * Cosine(2 * Pi * frequency),
+						1 - Sine(2 * Pi * frequency) / (2 * q));
+				}
+
+				/// <summary>
+				/// Second-order notch (band-stop).
+				/// </summary>
+				/// <param name="frequency">Center frequency / sample rate, ]0 ; 0.5[.</param>
+				/// <param name="q">Quality factor, center frequency / bandwidth.</param>
+				template<typename Format>
+				static constexpr Coefficients<Format> Notch(const double frequency, const double q)
+				{
+					return Normalize<Format>(1,
+						-2 * Cosine(2 * Pi * frequency),
+						1,
+						1 + Sine(2 * Pi * frequency) / (2 * q),
+						-2 * Cosine(2 * Pi * frequency),
+						1 - Sine(2 * Pi * frequency) / (2 * q));
+				}
+			}
+
+			namespace Template
+			{
+				/// <summary>
+				/// Section sum, when the accumulator holds 5 full-scale products.
+				/// Returns the sum shifted down, rounded towards zero, and leaves the truncated fraction in error.
+				/// </summary>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t>
+				static accumulator_t AccumulateSection(const Coefficients<Format>& coefficients,
+					const value_t x0, const value_t x1, const value_t x2,
+					const value_t y1, const value_t y2,
+					accumulator_t& error,
+					TypeTraits::TypeDispatch::TrueType)
+				{
+					static constexpr uint8_t Shifts = GetBitShifts(Format::FRACTION_1X);
+
+					const accumulator_t sum = error
+						+ (accumulator_t)coefficients.B0 * x0
+						+ (accumulator_t)coefficients.B1 * x1
+						+ (accumulator_t)coefficients.B2 * x2
+						- (accumulator_t)coefficients.A1 * y1
+						- (accumulator_t)coefficients.A2 * y2;
+
+					const accumulator_t result = SignedRightShift<accumulator_t, Shifts>(sum);
+					error = sum - (result * (accumulator_t)Format::FRACTION_1X);
+
+					return result;
+				}
+
+				/// <summary>
+				/// Section sum, when 5 full-scale products can overflow the accumulator (e.g. Q0.30 by int32_t in int64_t).
+				/// Each product is split in its shifted high part and its fraction, which are summed apart.
+				/// Bit-exact with the direct sum, whenever the direct sum fits.
+				/// </summary>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t>
+				static accumulator_t AccumulateSection(const Coefficients<Format>& coefficients,
+					const value_t x0, const value_t x1, const value_t x2,
+					const value_t y1, const value_t y2,
+					accumulator_t& error,
+					TypeTraits::TypeDispatch::FalseType)
+				{
+					static constexpr uint8_t Shifts = GetBitShifts(Format::FRACTION_1X);
+					static constexpr accumulator_t One = Format::FRACTION_1X;
+
+					const accumulator_t products[5] = {
+						(accumulator_t)coefficients.B0 * x0,
+						(accumulator_t)coefficients.B1 * x1,
+						(accumulator_t)coefficients.B2 * x2,
+						-(accumulator_t)coefficients.A1 * y1,
+						-(accumulator_t)coefficients.A2 * y2 };
+
+					accumulator_t high = 0;
+					accumulator_t low = error;
+					for (uint8_t i = 0; i < 5; i++)
+					{
+						const accumulator_t part = SignedRightShift<accumulator_t, Shifts>(products[i]);
+						high += part;
+						low += products[i] - (part * One);
+					}
+
+					// Carry the summed fractions, then round the whole sum towards zero.
+					const accumulator_t carry = SignedRightShift<accumulator_t, Shifts>(low);
+					high += carry;
+					low -= carry * One;
+					if (high > 0 && low < 0)
+					{
+						high--;
+						low += One;
+					}
+					else if (high < 0 && low > 0)
+					{
+						high++;
+						low -= One;
+					}
+
+					error = low;
+
+					return high;
+				}
+
+				/// <summary>
+				/// Direct Form I section step with first-order error feedback.
+				/// The fraction truncated from the previous output is added back to the accumulator (fraction saving),
+				/// so the quantization error is not lost and zero-input limit cycles are suppressed.
+				/// Saturated outputs drop the error, to recover from overflow without wind-up.
+				/// </summary>
+				/// <param name="x0">x[n].</param>
+				/// <param name="x1">x[n-1].</param>
+				/// <param name="x2">x[n-2].</param>
+				/// <param name="y1">y[n-1].</param>
+				/// <param name="y2">y[n-2].</param>
+				/// <param name="error">Error feedback state.</param>
+				/// <returns>y[n]</returns>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t>
+				static value_t StepSection(const Coefficients<Format>& coefficients,
+					const value_t x0, const value_t x1, const value_t x2,
+					const value_t y1, const value_t y2,
+					accumulator_t& error)
+				{
+					using limits = TypeTraits::TypeLimits::type_limits<value_t>;
+
+					// 5 products of |coefficient| <= 2 by a full-scale sample, plus the error, stay under 2^(bits(scalar_t) + bits(value_t) + 1).
+					static constexpr bool Headroom = ((sizeof(typename Format::scalar_t) + sizeof(value_t)) * 8) + 2 <= sizeof(accumulator_t) * 8;
+
+					const accumulator_t result = AccumulateSection<value_t, Format, accumulator_t>(coefficients, x0, x1, x2, y1, y2, error,
+						typename TypeTraits::TypeConditional::conditional_type<TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::FalseType, Headroom>::type{});
+					if (result > limits::Max())
+					{
+						error = 0;
+						return limits::Max();
+					}
+					else if (result < limits::Min())
+					{
+						error = 0;
+						return limits::Min();
+					}
+
+					return (value_t)result;
+				}
+
+				/// <summary>
+				/// Steady-state output of a section for a constant input, DC gain (b0 + b1 + b2) / (1 + a1 + a2).
+				/// Unstable or DC-blocking sections settle at 0.
+				/// </summary>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t>
+				static value_t GetSteadyState(const Coefficients<Format>& coefficients, const value_t value)
+				{
+					using limits = TypeTraits::TypeLimits::type_limits<value_t>;
+
+					const accumulator_t numerator = (accumulator_t)coefficients.B0 + coefficients.B1 + coefficients.B2;
+					const accumulator_t denominator = (accumulator_t)Format::FRACTION_1X + coefficients.A1 + coefficients.A2;
+					if (denominator <= 0)
+					{
+						return 0;
+					}
+
+					const accumulator_t result = (numerator * value) / denominator;
+					if (result > limits::Max())
+					{
+						return limits::Max();
+					}
+					else if (result < limits::Min())
+					{
+						return limits::Min();
+					}
+
+					return (value_t)result;
+				}
+
+				/// <summary>
+				/// Cascade of Direct Form I biquad sections, without virtual dispatch.
+				/// Adjacent sections share their history: the output history of a section is the input history of the next.
+				/// Any coefficients in [-2 ; 2[ and full-scale samples are safe, the section sums are split when the accumulator is short of headroom.
+				/// Clear(value) requires |b0 + b1 + b2| * |value| to fit the accumulator.
+				/// </summary>
+				/// <typeparam name="value_t">Signed sample type.</typeparam>
+				/// <typeparam name="Format">Signed Q-format of the coefficients (Fraction16, Fraction32).</typeparam>
+				/// <typeparam name="accumulator_t">Signed accumulator type, wider than value_t.</typeparam>
+				/// <typeparam name="stages">Number of biquad sections [1 ; 16].</typeparam>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t,
+					uint8_t stages>
+				class StaticFilter : public IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<value_t, Format, accumulator_t, stages>, value_t>
+				{
+				private:
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<value_t, Format, accumulator_t, stages>, value_t>;
+
+				public:
+					static_assert(stages >= 1 && stages <= 16, "Biquad::Filter requires stages in [1 ; 16]");
+					static_assert(sizeof(accumulator_t) > sizeof(value_t), "Biquad::Filter requires a widened accumulator");
+
+					static constexpr uint8_t Stages = stages;
+
+				protected:
+					using Base::Input;
+
+				private:
+					Coefficients<Format> Sections[stages]{};
+
+					/// <summary>
+					/// History[k] is the input history of section k, History[stages] the filter output history.
+					/// </summary>
+					value_t History[stages + 1][2]{};
+					accumulator_t Error[stages]{};
+
+				public:
+					StaticFilter() : Base() {}
+
+					/// <summary>
+					/// Set the coefficients of a section, the filter state is kept.
+					/// </summary>
+					/// <param name="stage">[0 ; Stages-1]</param>
+					void SetCoefficients(const uint8_t stage, const Coefficients<Format>& coefficients)
+					{
+						Sections[stage] = coefficients;
+					}
+
+					/// <summary>
+					/// Set the same coefficients for all sections.
+					/// </summary>
+					void SetCoefficients(const Coefficients<Format>& coefficients)
+					{
+						for (uint8_t i = 0; i < stages; i++)
+						{
+							Sections[i] = coefficients;
+						}
+					}
+
+					const Coefficients<Format>& GetCoefficients(const uint8_t stage) const
+					{
+						return Sections[stage];
+					}
+
+					/// <summary>
+					/// Clear to the steady state of a constant input.
+					/// </summary>
+					void Clear(const value_t value = 0)
+					{
+						Base::Clear(value);
+
+						value_t stageValue = value;
+						for (uint8_t i = 0; i < stages; i++)
+						{
+							History[i][0] = stageValue;
+							History[i][1] = stageValue;
+							Error[i] = 0;
+							stageValue = GetSteadyState<value_t, Format, accumulator_t>(Sections[i], stageValue);
+						}
+						History[stages][0] = stageValue;
+						History[stages][1] = stageValue;
+					}
+
+					void Step()
+					{
+						value_t x = Input;
+						for (uint8_t i = 0; i < stages; i++)
+						{
+							const value_t y = StepSection<value_t, Format, accumulator_t>(Sections[i],
+								x, History[i][0], History[i][1],
+								History[i + 1][0], History[i + 1][1], Error[i]);
+
+							History[i][1] = History[i][0];
+							History[i][0] = x;
+							x = y;
+						}
+						History[stages][1] = History[stages][0];
+						History[stages][0] = x;
+					}
+
+					const value_t Get() const
+					{
+						return History[stages][0];
+					}
+
+					/// <summary>
+					/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+					/// Each section runs over the whole block with its state in locals, before the next section.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Filtered samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const value_t* input, value_t* output, const size_t count)
+					{
+						if (count == 0)
+						{
+							return;
+						}
+
+						Input = input[count - 1];
+
+						// Shared history is overwritten by each section, the next one starts from the previous values.
+						value_t startX1 = History[0][0];
+						value_t startX2 = History[0][1];
+
+						const value_t* source = input;
+						for (uint8_t i = 0; i < stages; i++)
+						{
+							const Coefficients<Format> coefficients = Sections[i];
+							value_t x1 = startX1;
+							value_t x2 = startX2;
+							value_t y1 = History[i + 1][0];
+							value_t y2 = History[i + 1][1];
+							accumulator_t error = Error[i];
+							startX1 = y1;
+							startX2 = y2;
+
+							for (size_t n = 0; n < count; n++)
+							{
+								const value_t x = source[n];
+								const value_t y = StepSection<value_t, Format, accumulator_t>(coefficients, x, x1, x2, y1, y2, error);
+								x2 = x1;
+								x1 = x;
+								y2 = y1;
+								y1 = y;
+								output[n] = y;
+							}
+
+							History[i][0] = x1;
+							History[i][1] = x2;
+							History[i + 1][0] = y1;
+							History[i + 1][1] = y2;
+							Error[i] = error;
+							source = output;
+						}
+					}
+				};
+
+				/// <summary>
+				/// IFilter implementer of StaticFilter.
+				/// </summary>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t,
+					uint8_t stages>
+				class Filter : public IntegerSignal::Filter::Template::Interface<StaticFilter<value_t, Format, accumulator_t, stages>, value_t>
+				{
+				public:
+					Filter() : IntegerSignal::Filter::Template::Interface<StaticFilter<value_t, Format, accumulator_t, stages>, value_t>() {}
+				};
+			}
+		}
+
+		namespace Bank
+		{
+			namespace Template
+			{
+				/// <summary>
+				/// Bank of biquad cascades with shared coefficients, bit-exact with separate Biquad::Template::Filter instances.
+				/// Histories are stored channel-minor, so a frame of interleaved samples updates contiguous state.
+				/// </summary>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t,
+					uint8_t stages,
+					uint16_t channels>
+				class FilterBank<Biquad::Template::Filter<value_t, Format, accumulator_t, stages>, channels>
+					: public AbstractFilterBank<value_t, channels>
+				{
+				private:
+					using Base = AbstractFilterBank<value_t, channels>;
+
+				protected:
+					using Base::Input;
+					using Base::Output;
+
+				private:
+					Biquad::Coefficients<Format> Sections[stages]{};
+
+					value_t History1[stages + 1][channels]{};
+					value_t History2[stages + 1][channels]{};
+					accumulator_t Error[stages][channels]{};
+
+				public:
+					FilterBank() : Base() {}
+
+					void SetCoefficients(const uint8_t stage, const Biquad::Coefficients<Format>& coefficients)
+					{
+						Sections[stage] = coefficients;
+					}
+
+					void SetCoefficients(const Biquad::Coefficients<Format>& coefficients)
+					{
+						for (uint8_t i = 0; i < stages; i++)
+						{
+							Sections[i] = coefficients;
+						}
+					}
+
+					void Clear(const value_t value = 0)
+					{
+						for (uint16_t c = 0; c < channels; c++)
+						{
+							Clear(c, value);
+						}
+					}
+
+					void Clear(const uint16_t channel, const value_t value)
+					{
+						Input[channel] = value;
+
+						value_t stageValue = value;
+						for (uint8_t i = 0; i < stages; i++)
+						{
+							History1[i][channel] = stageValue;
+							History2[i][channel] = stageValue;
+							Error[i][channel] = 0;
+							stageValue = Biquad::Template::GetSteadyState<value_t, Format, accumulator_t>(Sections[i], stageValue);
+						}
+						History1[stages][channel] = stageValue;
+						History2[stages][channel] = stageValue;
+						Output[channel] = stageValue;
+					}
+
+					void Step()
+					{
+						StepFrame(Input, Output);
+					}
+
+					/// <summary>
+					/// Filters interleaved frames, one sample per channel per frame.
+					/// Inputs and outputs of the last frame are kept, as with Set(), Step() and Get().
+					/// </summary>
+					/// <param name="input">Interleaved input samples, frames * Channels.</param>
+					/// <param name="output">Interleaved filtered samples, may alias input.</param>
+					/// <param name="frames">Number of frames.</param>
+					void ProcessInterleaved(const value_t* input, value_t* output, const size_t frames)
+					{
+						if (frames == 0)
+						{
+							return;
+						}
+
+						for (size_t f = 0; f < frames; f++)
+						{
+							StepFrame(&input[f * channels], &output[f * channels]);
+						}
+
+						for (uint16_t c = 0; c < channels; c++)
+						{
+							Input[c] = input[((frames - 1) * channels) + c];
+							Output[c] = History1[stages][c];
+						}
+					}
+
+				private:
+					void StepFrame(const value_t* input, value_t* output)
+					{
+						value_t x[channels];
+						for (uint16_t c = 0; c < channels; c++)
+						{
+							x[c] = input[c];
+						}
+
+						for (uint8_t i = 0; i < stages; i++)
+						{
+							const Biquad::Coefficients<Format> coefficients = Sections[i];
+							for (uint16_t c = 0; c < channels; c++)
+							{
+								const value_t y = Biquad::Template::StepSection<value_t, Format, accumulator_t>(coefficients,
+									x[c], History1[i][c], History2[i][c],
+									History1[i + 1][c], History2[i + 1][c], Error[i][c]);
+
+								History2[i][c] = History1[i][c];
+								History1[i][c] = x[c];
+								x[c] = y;
+							}
+						}
+
+						for (uint16_t c = 0; c < channels; c++)
+						{
+							History2[stages][c] = History1[stages][c];
+							History1[stages][c] = x[c];
+							output[c] = x[c];
+						}
+					}
+				};
+
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t,
+					uint8_t stages,
+					uint16_t channels>
+				class FilterBank<Biquad::Template::StaticFilter<value_t, Format, accumulator_t, stages>, channels>
+					: public FilterBank<Biquad::Template::Filter<value_t, Format, accumulator_t, stages>, channels>
+				{
+				};
+			}
+		}
+
+		/// <summary>
+		/// Biquad filter (signed 16 bit), Q0.14 coefficients.
+		/// </summary>
+		using BiquadI16 = Biquad::Template::Filter<int16_t, FixedPoint::ScalarFraction::Fraction16, int64_t, 1>;
+
+		/// <summary>
+		/// Biquad filter (signed 32 bit), Q0.30 coefficients.
+		/// </summary>
+		using BiquadI32 = Biquad::Template::Filter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, 1>;
+
+		/// <summary>
+		/// Cascade of biquad sections (signed 16 bit), Q0.14 coefficients.
+		/// </summary>
+		/// <typeparam name="Stages">[1 ; 16]</typeparam>
+		template<uint8_t Stages>
+		using BiquadCascadeI16 = Biquad::Template::Filter<int16_t, FixedPoint::ScalarFraction::Fraction16, int64_t, Stages>;
+
+		/// <summary>
+		/// Cascade of biquad sections (signed 32 bit), Q0.30 coefficients.
+		/// </summary>
+		/// <typeparam name="Stages">[1 ; 16]</typeparam>
+		template<uint8_t Stages>
+		using BiquadCascadeI32 = Biquad::Template::Filter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, Stages>;
+
+		namespace Static
+		{
+			using BiquadI16 = Biquad::Template::StaticFilter<int16_t, FixedPoint::ScalarFraction::Fraction16, int64_t, 1>;
+			using BiquadI32 = Biquad::Template::StaticFilter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, 1>;
+
+			template<uint8_t Stages>
+			using BiquadCascadeI16 = Biquad::Template::StaticFilter<int16_t, FixedPoint::ScalarFraction::Fraction16, int64_t, Stages>;
+
+			template<uint8_t Stages>
+			using BiquadCascadeI32 = Biquad::Template::StaticFilter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, Stages>;
+		}
+	}
+}
+#endif
@@ -0,0 +1,367 @@
+// Cic.h
+
+#ifndef _INTEGER_SIGNAL_CIC_FILTER_h
+#define _INTEGER_SIGNAL_CIC_FILTER_h
+
+#include "../Base/TypeTraits.h"
+#include "../Base/Operation.h"
+#include "../Base/ByteSize.h"
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Cic
+		{
+			/// <summary>
+			/// Register selection for a CIC filter, without multiplications.
+			/// The registers wrap around in modular unsigned arithmetic,
+			/// the output is exact as long as the register holds the full gain range.
+			/// </summary>
+			/// <typeparam name="unsigned_t">Unsigned sample type.</typeparam>
+			/// <typeparam name="order">Number of integrator and comb sections [1 ; 8].</typeparam>
+			/// <typeparam name="rate">Power-of-two rate change [2 ; 4096].</typeparam>
+			template<typename unsigned_t,
+				uint8_t order,
+				uint16_t rate>
+			struct Traits
+			{
+				static_assert(TypeTraits::TypeSign::is_unsigned<unsigned_t>::value, "Cic requires an unsigned sample type");
+				static_assert(order >= 1 && order <= 8, "Cic requires order in [1 ; 8]");
+				static_assert(rate >= 2 && rate <= 4096 && (rate & (rate - 1)) == 0, "Cic requires a power-of-two rate in [2 ; 4096]");
+
+				static constexpr uint8_t RateShifts = GetBitShifts(rate);
+
+				/// <summary>
+				/// Bit growth of the full CIC, order * log2(rate).
+				/// </summary>
+				static constexpr uint8_t GainShifts = order * RateShifts;
+
+				static constexpr uint8_t RegisterBits = (sizeof(unsigned_t) * 8) + GainShifts;
+
+				static_assert(RegisterBits <= 64, "Cic register exceeds 64 bits, reduce order or rate");
+
+				using register_t = typename ByteSize::ByteType::byte_type<((RegisterBits + 7) >> 3)>::type;
+			};
+
+			namespace Template
+			{
+				/// <summary>
+				/// Cascaded Integrator-Comb decimator, differential delay 1.
+				/// Integrators run at the input rate, combs only once per output sample.
+				/// Output is the input averaged by a boxcar^order kernel, normalized by a shift of the gain.
+				/// </summary>
+				/// <typeparam name="unsigned_t">Unsigned sample type.</typeparam>
+				/// <typeparam name="order">Number of integrator and comb sections [1 ; 8].</typeparam>
+				/// <typeparam name="rate">Power-of-two decimation factor [2 ; 4096].</typeparam>
+				template<typename unsigned_t,
+					uint8_t order,
+					uint16_t rate>
+				class Decimator
+				{
+				private:
+					using TraitsType = Traits<unsigned_t, order, rate>;
+					using register_t = typename TraitsType::register_t;
+
+				public:
+					static constexpr uint8_t Order = order;
+					static constexpr uint16_t Rate = rate;
+
+				private:
+					register_t Integrators[order]{};
+					register_t Combs[order]{};
+					uint16_t Phase = 0;
+					unsigned_t Output = 0;
+
+				public:
+					Decimator() {}
+
+					/// <summary>
+					/// Clear to the steady state of a constant input, at the start of a decimation period.
+					/// </summary>
+					void Clear(const unsigned_t value = 0)
+					{
+						for (uint8_t i = 0; i < order; i++)
+						{
+							Integrators[i] = 0;
+							Combs[i] = 0;
+						}
+						Phase = 0;
+						Output = 0;
+
+						// The kernel spans order * (rate - 1) + 1 input samples, flush order full periods.
+						for (uint16_t i = 0; i < (uint16_t)order * rate; i++)
+						{
+							Push(value);
+						}
+					}
+
+					/// <summary>
+					/// Integrates one input sample.
+					/// </summary>
+					/// <returns>True when a new output sample is ready, once every Rate inputs.</returns>
+					bool Push(const unsigned_t value)
+					{
+						Integrate(value);
+
+						if (++Phase < rate)
+						{
+							return false;
+						}
+
+						Phase = 0;
+						Output = Comb();
+
+						return true;
+					}
+
+					/// <summary>
+					/// Latest output sample.
+					/// </summary>
+					const unsigned_t Get() const
+					{
+						return Output;
+					}
+
+					/// <summary>
+					/// Decimates a block of samples, bit-exact with Push() per sample.
+					/// The decimation phase carries over between blocks.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Decimated samples, at most count / Rate + 1. May alias input.</param>
+					/// <param name="count">Number of input samples.</param>
+					/// <returns>Number of output samples written.</returns>
+					size_t ProcessBlock(const unsigned_t* input, unsigned_t* output, const size_t count)
+					{
+						size_t outputs = 0;
+						size_t i = 0;
+						while (i < count)
+						{
+							// Integrate up to the end of the current period, with the integrators in locals.
+							const size_t remaining = count - i;
+							const size_t span = ((size_t)(rate - Phase) < remaining) ? (size_t)(rate - Phase) : remaining;
+
+							register_t integrators[order];
+							for (uint8_t k = 0; k < order; k++)
+							{
+								integrators[k] = Integrators[k];
+							}
+
+							for (size_t n = 0; n < span; n++)
+							{
+								integrators[0] += input[i + n];
+								for (uint8_t k = 1; k < order; k++)
+								{
+									integrators[k] += integrators[k - 1];
+								}
+							}
+
+							for (uint8_t k = 0; k < order; k++)
+							{
+								Integrators[k] = integrators[k];
+							}
+
+							i += span;
+							Phase += (uint16_t)span;
+							if (Phase >= rate)
+							{
+								Phase = 0;
+								Output = Comb();
+								output[outputs++] = Output;
+							}
+						}
+
+						return outputs;
+					}
+
+				private:
+					void Integrate(const unsigned_t value)
+					{
+						Integrators[0] += value;
+						for (uint8_t k = 1; k < order; k++)
+						{
+							Integrators[k] += Integrators[k - 1];
+						}
+					}
+
+					unsigned_t Comb()
+					{
+						register_t value = Integrators[order - 1];
+						for (uint8_t k = 0; k < order; k++)
+						{
+							const register_t delayed = Combs[k];
+							Combs[k] = value;
+							value -= delayed;
+						}
+
+						return (unsigned_t)(value >> TraitsType::GainShifts);
+					}
+				};
+
+				/// <summary>
+				/// Cascaded Integrator-Comb interpolator, differential delay 1.
+				/// Combs run at the input rate, integrators at the output rate over the zero-stuffed combs.
+				/// Each output phase has a gain of Rate^(order - 1), normalized by a shift.
+				/// </summary>
+				/// <typeparam name="unsigned_t">Unsigned sample type.</typeparam>
+				/// <typeparam name="order">Number of integrator and comb sections [1 ; 8].</typeparam>
+				/// <typeparam name="rate">Power-of-two interpolation factor [2 ; 4096].</typeparam>
+				template<typename unsigned_t,
+					uint8_t order,
+					uint16_t rate>
+				class Interpolator
+				{
+				private:
+					using TraitsType = Traits<unsigned_t, order, rate>;
+					using register_t = typename TraitsType::register_t;
+
+					static constexpr uint8_t OutputShifts = TraitsType::GainShifts - TraitsType::RateShifts;
+
+				public:
+					static constexpr uint8_t Order = order;
+					static constexpr uint16_t Rate = rate;
+
+				private:
+					register_t Integrators[order]{};
+					register_t Combs[order]{};
+
+				public:
+					Interpolator() {}
+
+					/// <summary>
+					/// Clear to the steady state of a constant input.
+					/// </summary>
+					void Clear(const unsigned_t value = 0)
+					{
+						for (uint8_t i = 0; i < order; i++)
+						{
+							Integrators[i] = 0;
+							Combs[i] = 0;
+						}
+
+						// Flush order input samples, without an output buffer.
+						for (uint8_t i = 0; i < order; i++)
+						{
+							Run<false>(value, nullptr);
+						}
+					}
+
+					/// <summary>
+					/// Interpolates one input sample into Rate output samples.
+					/// </summary>
+					/// <param name="value">Input sample.</param>
+					/// <param name="output">Rate output samples.</param>
+					void Interpolate(const unsigned_t value, unsigned_t* output)
+					{
+						Run<true>(value, output);
+					}
+
+					/// <summary>
+					/// Interpolates a block of samples, bit-exact with Interpolate() per sample.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">count * Rate interpolated samples, must not overlap input.</param>
+					/// <param name="count">Number of input samples.</param>
+					void ProcessBlock(const unsigned_t* input, unsigned_t* output, const size_t count)
+					{
+						for (size_t i = 0; i < count; i++)
+						{
+							Interpolate(input[i], &output[i * rate]);
+						}
+					}
+
+				private:
+					/// <summary>
+					/// Runs the combs on one input sample and the integrators over the Rate output phases.
+					/// </summary>
+					/// <typeparam name="writeOutput">False to only update the state, output is not used.</typeparam>
+					template<bool writeOutput>
+					void Run(const unsigned_t value, unsigned_t* output)
+					{
+						register_t comb = value;
+						for (uint8_t k = 0; k < order; k++)
+						{
+							const register_t delayed = Combs[k];
+							Combs[k] = comb;
+							comb -= delayed;
+						}
+
+						register_t integrators[order];
+						for (uint8_t k = 0; k < order; k++)
+						{
+							integrators[k] = Integrators[k];
+						}
+
+						// Zero-stuffed: only the first output phase sees the comb output.
+						integrators[0] += comb;
+						for (uint16_t n = 0; n < rate; n++)
+						{
+							for (uint8_t k = 1; k < order; k++)
+							{
+								integrators[k] += integrators[k - 1];
+							}
+							if (writeOutput)
+							{
+								output[n] = (unsigned_t)(integrators[order - 1] >> OutputShifts);
+							}
+						}
+
+						for (uint8_t k = 0; k < order; k++)
+						{
+							Integrators[k] = integrators[k];
+						}
+					}
+				};
+			}
+		}
+
+		/// <summary>
+		/// CIC decimator (unsigned 8 bit).
+		/// </summary>
+		/// <typeparam name="Order">[1 ; 8]</typeparam>
+		/// <typeparam name="Rate">Power of two [2 ; 4096]</typeparam>
+		template<uint8_t Order, uint16_t Rate>
+		using CicDecimatorU8 = Cic::Template::Decimator<uint8_t, Order, Rate>;
+
+		/// <summary>
+		/// CIC decimator (unsigned 16 bit).
+		/// </summary>
+		/// <typeparam name="Order">[1 ; 8]</typeparam>
+		/// <typeparam name="Rate">Power of two [2 ; 4096]</typeparam>
+		template<uint8_t Order, uint16_t Rate>
+		using CicDecimatorU16 = Cic::Template::Decimator<uint16_t, Order, Rate>;
+
+		/// <summary>
+		/// CIC decimator (unsigned 32 bit).
+		/// </summary>
+		/// <typeparam name="Order">[1 ; 8], order * log2(Rate) up to 32.</typeparam>
+		/// <typeparam name="Rate">Power of two [2 ; 4096]</typeparam>
+		template<uint8_t Order, uint16_t Rate>
+		using CicDecimatorU32 = Cic::Template::Decimator<uint32_t, Order, Rate>;
+
+		/// <summary>
+		/// CIC interpolator (unsigned 8 bit).
+		/// </summary>
+		/// <typeparam name="Order">[1 ; 8]</typeparam>
+		/// <typeparam name="Rate">Power of two [2 ; 4096]</typeparam>
+		template<uint8_t Order, uint16_t Rate>
+		using CicInterpolatorU8 = Cic::Template::Interpolator<uint8_t, Order, Rate>;
+
+		/// <summary>
+		/// CIC interpolator (unsigned 16 bit).
+		/// </summary>
+		/// <typeparam name="Order">[1 ; 8]</typeparam>
+		/// <typeparam name="Rate">Power of two [2 ; 4096]</typeparam>
+		template<uint8_t Order, uint16_t Rate>
+		using CicInterpolatorU16 = Cic::Template::Interpolator<uint16_t, Order, Rate>;
+
+		/// <summary>
+		/// CIC interpolator (unsigned 32 bit).
+		/// </summary>
+		/// <typeparam name="Order">[1 ; 8], order * log2(Rate) up to 32.</typeparam>
+		/// <typeparam name="Rate">Power of two [2 ; 4096]</typeparam>
+		template<uint8_t Order, uint16_t Rate>
+		using CicInterpolatorU32 = Cic::Template::Interpolator<uint32_t, Order, Rate>;
+	}
+}
+#endif
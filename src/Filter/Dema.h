@@ -12,18 +12,20 @@ namespace IntegerSignal
 			namespace Template
 			{
 				/// <summary>
-				/// Double Exponential Moving Average filter.
+				/// Double Exponential Moving Average filter, without virtual dispatch.
 				/// </summary>
 				/// <typeparam name="unsigned_t"></typeparam>
 				/// <typeparam name="intermediate_t"></typeparam>
 				/// <typeparam name="factor"></typeparam>
+				/// <typeparam name="InputType">Input storage, AbstractFilter for the AbstractFilter implementer.</typeparam>
 				template<typename unsigned_t,
 					typename intermediate_t,
-					uint8_t factor>
-				class Filter : public IntegerSignal::Filter::AbstractFilter<unsigned_t>
+					uint8_t factor,
+					typename InputType = IntegerSignal::Filter::Template::StaticInput<unsigned_t>>
+				class StaticFilter : public IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, intermediate_t, factor, InputType>, unsigned_t, InputType>
 				{
 				private:
-					using Base = IntegerSignal::Filter::AbstractFilter<unsigned_t>;
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, intermediate_t, factor, InputType>, unsigned_t, InputType>;
 
 				public:
 					static_assert(factor >= 1, "Dema::Filter requires factor >= 1");
@@ -42,10 +44,10 @@ namespace IntegerSignal
 					unsigned_t Output = 0;
 
 				public:
-					Filter() : Base() {}
+					StaticFilter() : Base() {}
 
 					// Clear to a steady-state output equal to 'value'
-					virtual void Clear(const unsigned_t value = 0)
+					void Clear(const unsigned_t value = 0)
 					{
 						Base::Clear(value);
 
@@ -57,7 +59,7 @@ namespace IntegerSignal
 						Output = value;
 					}
 
-					virtual void Step()
+					void Step()
 					{
 						HighValue1 += Input;
 						const unsigned_t intermediate = (HighValue1 + Half) >> factor;
@@ -68,10 +70,55 @@ namespace IntegerSignal
 						HighValue2 -= Output;
 					}
 
-					virtual const unsigned_t Get() const
+					const unsigned_t Get() const
 					{
 						return Output;
 					}
+
+					/// <summary>
+					/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+					/// Both stage accumulators are kept local for the whole block, without virtual dispatch.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Filtered samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const unsigned_t* input, unsigned_t* output, const size_t count)
+					{
+						intermediate_t high1 = HighValue1;
+						intermediate_t high2 = HighValue2;
+						unsigned_t last = Input;
+						unsigned_t out = Output;
+
+						for (size_t i = 0; i < count; i++)
+						{
+							last = input[i];
+							high1 += last;
+							const unsigned_t intermediate = (high1 + Half) >> factor;
+							high1 -= intermediate;
+
+							high2 += intermediate;
+							out = (high2 + Half) >> factor;
+							high2 -= out;
+							output[i] = out;
+						}
+
+						HighValue1 = high1;
+						HighValue2 = high2;
+						Input = last;
+						Output = out;
+					}
+				};
+
+				/// <summary>
+				/// AbstractFilter implementer of StaticFilter.
+				/// </summary>
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor>
+				class Filter : public IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, intermediate_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>
+				{
+				public:
+					Filter() : IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, intermediate_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>() {}
 				};
 			}
 		}
@@ -93,6 +140,27 @@ namespace IntegerSignal
 
 		template<uint8_t factor = 2>
 		using DemaI32 = Filter::SignedI32<DemaU32<factor>>;
+
+		namespace Static
+		{
+			template<uint8_t factor = 2>
+			using DemaU8 = Dema::Template::StaticFilter<uint8_t, uint_fast16_t, factor>;
+
+			template<uint8_t factor = 2>
+			using DemaU16 = Dema::Template::StaticFilter<uint16_t, uint_fast32_t, factor>;
+
+			template<uint8_t factor = 2>
+			using DemaU32 = Dema::Template::StaticFilter<uint32_t, uint_fast64_t, factor>;
+
+			template<uint8_t factor = 2>
+			using DemaI8 = Filter::StaticSignedI8<DemaU8<factor>>;
+
+			template<uint8_t factor = 2>
+			using DemaI16 = Filter::StaticSignedI16<DemaU16<factor>>;
+
+			template<uint8_t factor = 2>
+			using DemaI32 = Filter::StaticSignedI32<DemaU32<factor>>;
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -12,18 +12,20 @@ namespace IntegerSignal
 			namespace Template
 			{
 				/// <summary>
-				/// Exponential Moving Average filter.
+				/// Exponential Moving Average filter, without virtual dispatch.
 				/// </summary>
 				/// <typeparam name="unsigned_t"></typeparam>
 				/// <typeparam name="intermediate_t"></typeparam>
 				/// <typeparam name="factor"></typeparam>
+				/// <typeparam name="InputType">Input storage, AbstractFilter for the AbstractFilter implementer.</typeparam>
 				template<typename unsigned_t,
 					typename intermediate_t,
-					uint8_t factor>
-				class Filter : public IntegerSignal::Filter::AbstractFilter<unsigned_t>
+					uint8_t factor,
+					typename InputType = IntegerSignal::Filter::Template::StaticInput<unsigned_t>>
+				class StaticFilter : public IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, intermediate_t, factor, InputType>, unsigned_t, InputType>
 				{
 				private:
-					using Base = IntegerSignal::Filter::AbstractFilter<unsigned_t>;
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, intermediate_t, factor, InputType>, unsigned_t, InputType>;
 
 				public:
 					static_assert(factor >= 1, "Ema::Filter requires factor >= 1");
@@ -40,10 +42,10 @@ namespace IntegerSignal
 					unsigned_t Output = 0;
 
 				public:
-					Filter() : Base() {}
+					StaticFilter() : Base() {}
 
 					// Clear to a steady-state output equal to 'value'
-					virtual void Clear(const unsigned_t value = 0)
+					void Clear(const unsigned_t value = 0)
 					{
 						Base::Clear(value);
 						// Residual for steady-state output Y is Y * (2^factor - 1)
@@ -52,17 +54,56 @@ namespace IntegerSignal
 						Output = value;
 					}
 
-					virtual void Step()
+					void Step()
 					{
 						HighValue += Input;
 						Output = (HighValue + Half) >> factor;
 						HighValue -= Output;
 					}
 
-					virtual const unsigned_t Get() const
+					const unsigned_t Get() const
 					{
 						return Output;
 					}
+
+					/// <summary>
+					/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+					/// The accumulator is kept local for the whole block, without virtual dispatch.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Filtered samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const unsigned_t* input, unsigned_t* output, const size_t count)
+					{
+						intermediate_t high = HighValue;
+						unsigned_t last = Input;
+						unsigned_t out = Output;
+
+						for (size_t i = 0; i < count; i++)
+						{
+							last = input[i];
+							high += last;
+							out = (high + Half) >> factor;
+							high -= out;
+							output[i] = out;
+						}
+
+						HighValue = high;
+						Input = last;
+						Output = out;
+					}
+				};
+
+				/// <summary>
+				/// AbstractFilter implementer of StaticFilter.
+				/// </summary>
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor>
+				class Filter : public IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, intermediate_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>
+				{
+				public:
+					Filter() : IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, intermediate_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>() {}
 				};
 			}
 		}
@@ -84,6 +125,27 @@ namespace IntegerSignal
 
 		template<uint8_t factor = 4>
 		using EmaI32 = Filter::SignedI32<EmaU32<factor>>;
+
+		namespace Static
+		{
+			template<uint8_t factor = 4>
+			using EmaU8 = Ema::Template::StaticFilter<uint8_t, uint_fast16_t, factor>;
+
+			template<uint8_t factor = 4>
+			using EmaU16 = Ema::Template::StaticFilter<uint16_t, uint_fast32_t, factor>;
+
+			template<uint8_t factor = 4>
+			using EmaU32 = Ema::Template::StaticFilter<uint32_t, uint_fast64_t, factor>;
+
+			template<uint8_t factor = 4>
+			using EmaI8 = Filter::StaticSignedI8<EmaU8<factor>>;
+
+			template<uint8_t factor = 4>
+			using EmaI16 = Filter::StaticSignedI16<EmaU16<factor>>;
+
+			template<uint8_t factor = 4>
+			using EmaI32 = Filter::StaticSignedI32<EmaU32<factor>>;
+		}
 	}
 }
 #endif
\ No newline at end of file
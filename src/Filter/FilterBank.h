@@ -0,0 +1,295 @@
+// FilterBank.h
+
+#ifndef _INTEGER_SIGNAL_FILTER_BANK_h
+#define _INTEGER_SIGNAL_FILTER_BANK_h
+
+#include "LowPass.h"
+#include "Ema.h"
+#include "Dema.h"
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Bank
+		{
+			/// <summary>
+			/// Shared storage for multi-channel filter banks.
+			/// Inputs and outputs are stored as contiguous structure-of-arrays,
+			/// so every channel can be stepped in a single vectorizable pass.
+			/// </summary>
+			/// <typeparam name="unsigned_t">Filter value type.</typeparam>
+			/// <typeparam name="channels">Number of independent channels.</typeparam>
+			template<typename unsigned_t,
+				uint16_t channels>
+			class AbstractFilterBank
+			{
+			public:
+				static_assert(channels >= 1, "FilterBank requires at least 1 channel");
+
+				static constexpr uint16_t Channels = channels;
+
+			protected:
+				unsigned_t Input[channels]{};
+				unsigned_t Output[channels]{};
+
+			public:
+				AbstractFilterBank() {}
+
+				/// <summary>
+				/// Set the input value of a single channel.
+				/// </summary>
+				/// <param name="channel">[0 ; Channels-1]</param>
+				/// <param name="value"></param>
+				void Set(const uint16_t channel, const unsigned_t value)
+				{
+					Input[channel] = value;
+				}
+
+				/// <summary>
+				/// Set the input values of all channels.
+				/// </summary>
+				/// <param name="values">Input values, one per channel.</param>
+				void Set(const unsigned_t* values)
+				{
+					for (uint16_t i = 0; i < channels; i++)
+					{
+						Input[i] = values[i];
+					}
+				}
+
+				/// <summary>
+				/// Get the latest output value of a single channel.
+				/// </summary>
+				/// <param name="channel">[0 ; Channels-1]</param>
+				/// <returns></returns>
+				const unsigned_t Get(const uint16_t channel) const
+				{
+					return Output[channel];
+				}
+
+				/// <summary>
+				/// Contiguous latest output values, one per channel.
+				/// </summary>
+				/// <returns></returns>
+				const unsigned_t* GetOutputs() const
+				{
+					return Output;
+				}
+			};
+
+			namespace Template
+			{
+				/// <summary>
+				/// Multi-channel bank of identical filters.
+				/// Specialized for each supported filter type.
+				/// </summary>
+				/// <typeparam name="FilterType">Single channel filter type (e.g. EmaU16<4>).</typeparam>
+				/// <typeparam name="channels">Number of independent channels.</typeparam>
+				template<typename FilterType,
+					uint16_t channels>
+				class FilterBank;
+
+				/// <summary>
+				/// Bank of LowPass filters, bit-exact with separate LowPass::Template::Filter instances.
+				/// </summary>
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor,
+					uint16_t channels>
+				class FilterBank<LowPass::Template::Filter<unsigned_t, intermediate_t, factor>, channels>
+					: public AbstractFilterBank<unsigned_t, channels>
+				{
+				private:
+					using Base = AbstractFilterBank<unsigned_t, channels>;
+
+				protected:
+					using Base::Input;
+					using Base::Output;
+
+				private:
+					intermediate_t HighValue[channels]{};
+
+				public:
+					FilterBank() : Base() {}
+
+					void Clear(const unsigned_t value = 0)
+					{
+						for (uint16_t i = 0; i < channels; i++)
+						{
+							Clear(i, value);
+						}
+					}
+
+					void Clear(const uint16_t channel, const unsigned_t value)
+					{
+						Input[channel] = value;
+						HighValue[channel] = intermediate_t(value) << factor;
+						Output[channel] = value;
+					}
+
+					void Step()
+					{
+						for (uint16_t i = 0; i < channels; i++)
+						{
+							const intermediate_t high = HighValue[i] - (HighValue[i] >> factor) + Input[i];
+							HighValue[i] = high;
+							Output[i] = (unsigned_t)(high >> factor);
+						}
+					}
+				};
+
+				/// <summary>
+				/// Bank of EMA filters, bit-exact with separate Ema::Template::Filter instances.
+				/// </summary>
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor,
+					uint16_t channels>
+				class FilterBank<Ema::Template::Filter<unsigned_t, intermediate_t, factor>, channels>
+					: public AbstractFilterBank<unsigned_t, channels>
+				{
+				private:
+					using Base = AbstractFilterBank<unsigned_t, channels>;
+					using FilterType = Ema::Template::Filter<unsigned_t, intermediate_t, factor>;
+
+				protected:
+					using Base::Input;
+					using Base::Output;
+
+				private:
+					intermediate_t HighValue[channels]{};
+
+				public:
+					FilterBank() : Base() {}
+
+					void Clear(const unsigned_t value = 0)
+					{
+						for (uint16_t i = 0; i < channels; i++)
+						{
+							Clear(i, value);
+						}
+					}
+
+					void Clear(const uint16_t channel, const unsigned_t value)
+					{
+						const intermediate_t Qminus1 = (intermediate_t(1) << factor) - 1;
+						Input[channel] = value;
+						HighValue[channel] = (intermediate_t)value * Qminus1;
+						Output[channel] = value;
+					}
+
+					void Step()
+					{
+						for (uint16_t i = 0; i < channels; i++)
+						{
+							const intermediate_t high = HighValue[i] + Input[i];
+							const unsigned_t output = (high + FilterType::Half) >> factor;
+							HighValue[i] = high - output;
+							Output[i] = output;
+						}
+					}
+				};
+
+				/// <summary>
+				/// Bank of DEMA filters, bit-exact with separate Dema::Template::Filter instances.
+				/// </summary>
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor,
+					uint16_t channels>
+				class FilterBank<Dema::Template::Filter<unsigned_t, intermediate_t, factor>, channels>
+					: public AbstractFilterBank<unsigned_t, channels>
+				{
+				private:
+					using Base = AbstractFilterBank<unsigned_t, channels>;
+					using FilterType = Dema::Template::Filter<unsigned_t, intermediate_t, factor>;
+
+				protected:
+					using Base::Input;
+					using Base::Output;
+
+				private:
+					intermediate_t HighValue1[channels]{};
+					intermediate_t HighValue2[channels]{};
+
+				public:
+					FilterBank() : Base() {}
+
+					void Clear(const unsigned_t value = 0)
+					{
+						for (uint16_t i = 0; i < channels; i++)
+						{
+							Clear(i, value);
+						}
+					}
+
+					void Clear(const uint16_t channel, const unsigned_t value)
+					{
+						const intermediate_t Qminus1 = (intermediate_t(1) << factor) - 1;
+						Input[channel] = value;
+						HighValue1[channel] = (intermediate_t)value * Qminus1;
+						HighValue2[channel] = (intermediate_t)value * Qminus1;
+						Output[channel] = value;
+					}
+
+					void Step()
+					{
+						for (uint16_t i = 0; i < channels; i++)
+						{
+							const intermediate_t high1 = HighValue1[i] + Input[i];
+							const unsigned_t intermediate = (high1 + FilterType::Half) >> factor;
+							HighValue1[i] = high1 - intermediate;
+
+							const intermediate_t high2 = HighValue2[i] + intermediate;
+							const unsigned_t output = (high2 + FilterType::Half) >> factor;
+							HighValue2[i] = high2 - output;
+							Output[i] = output;
+						}
+					}
+				};
+
+				/// <summary>
+				/// Banks of static (non-virtual) filters, same implementation as their IFilter counterparts.
+				/// </summary>
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor,
+					uint16_t channels>
+				class FilterBank<LowPass::Template::StaticFilter<unsigned_t, intermediate_t, factor>, channels>
+					: public FilterBank<LowPass::Template::Filter<unsigned_t, intermediate_t, factor>, channels>
+				{
+				};
+
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor,
+					uint16_t channels>
+				class FilterBank<Ema::Template::StaticFilter<unsigned_t, intermediate_t, factor>, channels>
+					: public FilterBank<Ema::Template::Filter<unsigned_t, intermediate_t, factor>, channels>
+				{
+				};
+
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor,
+					uint16_t channels>
+				class FilterBank<Dema::Template::StaticFilter<unsigned_t, intermediate_t, factor>, channels>
+					: public FilterBank<Dema::Template::Filter<unsigned_t, intermediate_t, factor>, channels>
+				{
+				};
+			}
+		}
+
+		/// <summary>
+		/// Multi-channel structure-of-arrays bank of identical filters.
+		/// Outputs are identical to Channels separate filter instances.
+		/// Supports LowPass, EMA and DEMA filters.
+		/// </summary>
+		/// <typeparam name="FilterType">Single channel filter type (e.g. EmaU16<4>).</typeparam>
+		/// <typeparam name="Channels">Number of independent channels.</typeparam>
+		template<typename FilterType, uint16_t Channels>
+		using FilterBank = Bank::Template::FilterBank<FilterType, Channels>;
+	}
+}
+#endif
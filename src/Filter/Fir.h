@@ -0,0 +1,430 @@
+// Fir.h
+
+#ifndef _INTEGER_SIGNAL_FIR_FILTER_h
+#define _INTEGER_SIGNAL_FIR_FILTER_h
+
+#include "IFilter.h"
+#include "../FixedPoint/ScalarFraction.h"
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <arm_neon.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Fir
+		{
+			namespace Kernels
+			{
+				/// <summary>
+				/// Accelerated prefix of a dot product, returns the number of taps processed and adds their products to sum.
+				/// Falls back to none, for the portable loop.
+				/// </summary>
+				template<typename value_t,
+					typename tap_t,
+					typename accumulator_t>
+				static uint16_t DotPrefix(const value_t*, const tap_t*, const uint16_t, accumulator_t&)
+				{
+					return 0;
+				}
+
+				/// <summary>
+				/// Accelerated prefix of a folded (symmetric) dot product, returns the number of tap pairs processed.
+				/// </summary>
+				template<typename value_t,
+					typename tap_t,
+					typename accumulator_t>
+				static uint16_t FoldedDotPrefix(const value_t*, const tap_t*, const uint16_t, const uint16_t, accumulator_t&)
+				{
+					return 0;
+				}
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+				static int32_t Sum32(const __m256i lanes)
+				{
+					const __m128i half = _mm_add_epi32(_mm256_castsi256_si128(lanes), _mm256_extracti128_si256(lanes, 1));
+					const __m128i quarter = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+
+					return _mm_cvtsi128_si32(_mm_add_epi32(quarter, _mm_shuffle_epi32(quarter, 0xB1)));
+				}
+
+				/// <summary>
+				/// int16_t samples by Q0.14 taps, 16 taps per pmaddwd into 32-bit lanes.
+				/// </summary>
+				static uint16_t DotPrefix(const int16_t* samples, const int16_t* taps, const uint16_t count, int32_t& sum)
+				{
+					__m256i accumulator = _mm256_setzero_si256();
+
+					uint16_t i = 0;
+					const uint16_t vectorEnd = count - (count % 16);
+					for (; i < vectorEnd; i += 16)
+					{
+						accumulator = _mm256_add_epi32(accumulator,
+							_mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&samples[i])),
+								_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&taps[i]))));
+					}
+
+					sum += Sum32(accumulator);
+
+					return i;
+				}
+
+				/// <summary>
+				/// int16_t sample pairs by Q0.14 taps, pairs summed in 32-bit lanes, 8 taps per iteration.
+				/// </summary>
+				static uint16_t FoldedDotPrefix(const int16_t* samples, const int16_t* taps, const uint16_t pairs, const uint16_t count, int32_t& sum)
+				{
+					const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+					__m256i accumulator = _mm256_setzero_si256();
+
+					uint16_t i = 0;
+					const uint16_t vectorEnd = pairs - (pairs % 8);
+					for (; i < vectorEnd; i += 8)
+					{
+						const __m256i front = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&samples[i])));
+						const __m256i back = _mm256_permutevar8x32_epi32(
+							_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&samples[count - i - 8]))), reverse);
+						const __m256i tap = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&taps[i])));
+
+						accumulator = _mm256_add_epi32(accumulator, _mm256_mullo_epi32(_mm256_add_epi32(front, back), tap));
+					}
+
+					sum += Sum32(accumulator);
+
+					return i;
+				}
+
+				/// <summary>
+				/// int32_t samples by Q0.30 taps, even and odd lanes in 64-bit products.
+				/// </summary>
+				static uint16_t DotPrefix(const int32_t* samples, const int32_t* taps, const uint16_t count, int64_t& sum)
+				{
+					__m256i accumulator = _mm256_setzero_si256();
+
+					uint16_t i = 0;
+					const uint16_t vectorEnd = count - (count % 8);
+					for (; i < vectorEnd; i += 8)
+					{
+						const __m256i sample = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&samples[i]));
+						const __m256i tap = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&taps[i]));
+
+						accumulator = _mm256_add_epi64(accumulator, _mm256_mul_epi32(sample, tap));
+						accumulator = _mm256_add_epi64(accumulator, _mm256_mul_epi32(_mm256_srli_epi64(sample, 32), _mm256_srli_epi64(tap, 32)));
+					}
+
+					const __m128i half = _mm_add_epi64(_mm256_castsi256_si128(accumulator), _mm256_extracti128_si256(accumulator, 1));
+					sum += _mm_cvtsi128_si64(_mm_add_epi64(half, _mm_unpackhi_epi64(half, half)));
+
+					return i;
+				}
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+				static int32_t Sum32(const int32x4_t lanes)
+				{
+					const int32x2_t half = vadd_s32(vget_low_s32(lanes), vget_high_s32(lanes));
+
+					return vget_lane_s32(vpadd_s32(half, half), 0);
+				}
+
+				/// <summary>
+				/// int16_t samples by Q0.14 taps, 8 taps per pair of vmlal into 32-bit lanes.
+				/// </summary>
+				static uint16_t DotPrefix(const int16_t* samples, const int16_t* taps, const uint16_t count, int32_t& sum)
+				{
+					int32x4_t accumulator = vdupq_n_s32(0);
+
+					uint16_t i = 0;
+					const uint16_t vectorEnd = count - (count % 8);
+					for (; i < vectorEnd; i += 8)
+					{
+						const int16x8_t sample = vld1q_s16(&samples[i]);
+						const int16x8_t tap = vld1q_s16(&taps[i]);
+
+						accumulator = vmlal_s16(accumulator, vget_low_s16(sample), vget_low_s16(tap));
+						accumulator = vmlal_s16(accumulator, vget_high_s16(sample), vget_high_s16(tap));
+					}
+
+					sum += Sum32(accumulator);
+
+					return i;
+				}
+
+				/// <summary>
+				/// int16_t sample pairs by Q0.14 taps, pairs summed in 32-bit lanes, 4 taps per iteration.
+				/// </summary>
+				static uint16_t FoldedDotPrefix(const int16_t* samples, const int16_t* taps, const uint16_t pairs, const uint16_t count, int32_t& sum)
+				{
+					int32x4_t accumulator = vdupq_n_s32(0);
+
+					uint16_t i = 0;
+					const uint16_t vectorEnd = pairs - (pairs % 4);
+					for (; i < vectorEnd; i += 4)
+					{
+						const int32x4_t pair = vaddl_s16(vld1_s16(&samples[i]), vrev64_s16(vld1_s16(&samples[count - i - 4])));
+
+						accumulator = vmlaq_s32(accumulator, pair, vmovl_s16(vld1_s16(&taps[i])));
+					}
+
+					sum += Sum32(accumulator);
+
+					return i;
+				}
+
+				/// <summary>
+				/// int32_t samples by Q0.30 taps, vmlal into 64-bit lanes.
+				/// </summary>
+				static uint16_t DotPrefix(const int32_t* samples, const int32_t* taps, const uint16_t count, int64_t& sum)
+				{
+					int64x2_t accumulator = vdupq_n_s64(0);
+
+					uint16_t i = 0;
+					const uint16_t vectorEnd = count - (count % 4);
+					for (; i < vectorEnd; i += 4)
+					{
+						const int32x4_t sample = vld1q_s32(&samples[i]);
+						const int32x4_t tap = vld1q_s32(&taps[i]);
+
+						accumulator = vmlal_s32(accumulator, vget_low_s32(sample), vget_low_s32(tap));
+						accumulator = vmlal_s32(accumulator, vget_high_s32(sample), vget_high_s32(tap));
+					}
+
+					sum += vgetq_lane_s64(accumulator, 0) + vgetq_lane_s64(accumulator, 1);
+
+					return i;
+				}
+#endif
+			}
+
+			namespace Template
+			{
+				/// <summary>
+				/// Fixed-point FIR filter, without virtual dispatch.
+				/// y[n] = sum(taps[k] * x[n - k]) in a widened accumulator, rounded towards zero as Fraction() and saturated.
+				/// The tap window is kept contiguous in a mirrored history, so every output is a single dot product.
+				/// The sum of absolute taps must stay below 4 (2 bits of headroom), for the accumulator not to overflow.
+				/// </summary>
+				/// <typeparam name="value_t">Signed sample type.</typeparam>
+				/// <typeparam name="Format">Signed Q-format of the taps (Fraction16, Fraction32).</typeparam>
+				/// <typeparam name="accumulator_t">Signed accumulator type, twice the width of value_t.</typeparam>
+				/// <typeparam name="tapCount">Number of taps [1 ; 4096].</typeparam>
+				/// <typeparam name="symmetric">Taps are symmetric (linear phase), only the first half is stored and each tap is applied to a pair of samples.</typeparam>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t,
+					uint16_t tapCount,
+					bool symmetric>
+				class StaticFilter : public IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<value_t, Format, accumulator_t, tapCount, symmetric>, value_t>
+				{
+				private:
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<value_t, Format, accumulator_t, tapCount, symmetric>, value_t>;
+
+				public:
+					using tap_t = typename Format::scalar_t;
+
+					static_assert(tapCount >= 1 && tapCount <= 4096, "Fir::Filter requires tapCount in [1 ; 4096]");
+					static_assert(sizeof(accumulator_t) >= 2 * sizeof(value_t), "Fir::Filter requires a widened accumulator");
+
+					static constexpr uint16_t TapCount = tapCount;
+
+					/// <summary>
+					/// Number of stored taps, half (rounded up) for symmetric taps.
+					/// </summary>
+					static constexpr uint16_t StoredTaps = symmetric ? ((tapCount + 1) / 2) : tapCount;
+
+				private:
+					static constexpr uint8_t Shifts = GetBitShifts(Format::FRACTION_1X);
+
+				protected:
+					using Base::Input;
+
+				private:
+					/// <summary>
+					/// Taps in window order: oldest sample first, taps[0] last.
+					/// </summary>
+					tap_t Taps[StoredTaps]{};
+
+					/// <summary>
+					/// Mirrored history, the last tapCount samples are always at [Start ; Start + tapCount).
+					/// </summary>
+					value_t History[2 * tapCount]{};
+					uint16_t Start = 0;
+
+					value_t Output = 0;
+
+				public:
+					StaticFilter() : Base() {}
+
+					/// <summary>
+					/// Set the filter taps, the filter state is kept.
+					/// </summary>
+					/// <param name="taps">taps[0] applies to the newest sample.
+					/// tapCount taps, or the first (tapCount + 1) / 2 taps when symmetric.</param>
+					void SetTaps(const tap_t* taps)
+					{
+						for (uint16_t i = 0; i < StoredTaps; i++)
+						{
+							Taps[i] = symmetric ? taps[i] : taps[tapCount - 1 - i];
+						}
+					}
+
+					/// <summary>
+					/// Clear the history to a constant input.
+					/// </summary>
+					void Clear(const value_t value = 0)
+					{
+						Base::Clear(value);
+						for (uint16_t i = 0; i < 2 * tapCount; i++)
+						{
+							History[i] = value;
+						}
+						Start = 0;
+						Output = Convolve(&History[Start]);
+					}
+
+					void Step()
+					{
+						Output = Push(Input);
+					}
+
+					const value_t Get() const
+					{
+						return Output;
+					}
+
+					/// <summary>
+					/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Filtered samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const value_t* input, value_t* output, const size_t count)
+					{
+						if (count == 0)
+						{
+							return;
+						}
+
+						const value_t last = input[count - 1];
+						for (size_t i = 0; i < count; i++)
+						{
+							output[i] = Push(input[i]);
+						}
+
+						Input = last;
+						Output = output[count - 1];
+					}
+
+				private:
+					value_t Push(const value_t value)
+					{
+						History[Start] = value;
+						History[Start + tapCount] = value;
+						Start = (Start + 1 < tapCount) ? (Start + 1) : 0;
+
+						return Convolve(&History[Start]);
+					}
+
+					value_t Convolve(const value_t* window) const
+					{
+						return Saturate(Dot(window, typename TypeTraits::TypeConditional::conditional_type<
+							TypeTraits::TypeDispatch::TrueType, TypeTraits::TypeDispatch::FalseType, symmetric>::type()));
+					}
+
+					accumulator_t Dot(const value_t* window, TypeTraits::TypeDispatch::FalseType) const
+					{
+						accumulator_t sum = 0;
+						for (uint16_t i = Kernels::DotPrefix(window, Taps, tapCount, sum); i < tapCount; i++)
+						{
+							sum += (accumulator_t)window[i] * Taps[i];
+						}
+
+						return sum;
+					}
+
+					/// <summary>
+					/// Symmetric taps, each one applied to the sum of its sample pair.
+					/// </summary>
+					accumulator_t Dot(const value_t* window, TypeTraits::TypeDispatch::TrueType) const
+					{
+						static constexpr uint16_t Pairs = tapCount / 2;
+
+						accumulator_t sum = 0;
+						for (uint16_t i = Kernels::FoldedDotPrefix(window, Taps, Pairs, tapCount, sum); i < Pairs; i++)
+						{
+							sum += ((accumulator_t)window[i] + window[tapCount - 1 - i]) * Taps[i];
+						}
+
+						if (tapCount & 1)
+						{
+							sum += (accumulator_t)window[Pairs] * Taps[Pairs];
+						}
+
+						return sum;
+					}
+
+					static value_t Saturate(const accumulator_t sum)
+					{
+						using limits = TypeTraits::TypeLimits::type_limits<value_t>;
+
+						const accumulator_t result = SignedRightShift<accumulator_t, Shifts>(sum);
+						if (result > limits::Max())
+						{
+							return limits::Max();
+						}
+						else if (result < limits::Min())
+						{
+							return limits::Min();
+						}
+
+						return (value_t)result;
+					}
+				};
+
+				/// <summary>
+				/// IFilter implementer of StaticFilter.
+				/// </summary>
+				template<typename value_t,
+					typename Format,
+					typename accumulator_t,
+					uint16_t tapCount,
+					bool symmetric>
+				class Filter : public IntegerSignal::Filter::Template::Interface<StaticFilter<value_t, Format, accumulator_t, tapCount, symmetric>, value_t>
+				{
+				public:
+					Filter() : IntegerSignal::Filter::Template::Interface<StaticFilter<value_t, Format, accumulator_t, tapCount, symmetric>, value_t>() {}
+				};
+			}
+		}
+
+		template<uint16_t tapCount>
+		using FirI16 = Fir::Template::Filter<int16_t, FixedPoint::ScalarFraction::Fraction16, int32_t, tapCount, false>;
+
+		template<uint16_t tapCount>
+		using FirI32 = Fir::Template::Filter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, tapCount, false>;
+
+		template<uint16_t tapCount>
+		using SymmetricFirI16 = Fir::Template::Filter<int16_t, FixedPoint::ScalarFraction::Fraction16, int32_t, tapCount, true>;
+
+		template<uint16_t tapCount>
+		using SymmetricFirI32 = Fir::Template::Filter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, tapCount, true>;
+
+		namespace Static
+		{
+			template<uint16_t tapCount>
+			using FirI16 = Fir::Template::StaticFilter<int16_t, FixedPoint::ScalarFraction::Fraction16, int32_t, tapCount, false>;
+
+			template<uint16_t tapCount>
+			using FirI32 = Fir::Template::StaticFilter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, tapCount, false>;
+
+			template<uint16_t tapCount>
+			using SymmetricFirI16 = Fir::Template::StaticFilter<int16_t, FixedPoint::ScalarFraction::Fraction16, int32_t, tapCount, true>;
+
+			template<uint16_t tapCount>
+			using SymmetricFirI32 = Fir::Template::StaticFilter<int32_t, FixedPoint::ScalarFraction::Fraction32, int64_t, tapCount, true>;
+		}
+	}
+}
+#endif
@@ -4,6 +4,7 @@
 #define _I_FILTER_h
 
 #include <stdint.h>
+#include <stddef.h>
 
 namespace IntegerSignal
 {
@@ -60,6 +61,155 @@ namespace IntegerSignal
 				Input = value;
 			}
 		};
+
+		namespace Template
+		{
+			/// <summary>
+			/// Non-virtual (CRTP) base for filters.
+			/// Same Clear/Set/Step/Get contract as IFilter, resolved at compile time,
+			/// so nested filters inline fully and carry no vtable pointer.
+			/// </summary>
+			/// <typeparam name="Derived">Implementing filter type.</typeparam>
+			/// <typeparam name="value_t"></typeparam>
+			template<typename Derived,
+				typename value_t>
+			class StaticFilter
+			{
+			public:
+				StaticFilter() {}
+
+				/// <summary>
+				/// Filters a block of samples, one Set(), Step() and Get() per sample.
+				/// Derived filters may hide it with a specialized implementation.
+				/// </summary>
+				/// <param name="input">Input samples.</param>
+				/// <param name="output">Filtered samples, may alias input.</param>
+				/// <param name="count">Number of samples.</param>
+				void ProcessBlock(const value_t* input, value_t* output, const size_t count)
+				{
+					Derived& filter = static_cast<Derived&>(*this);
+					for (size_t i = 0; i < count; i++)
+					{
+						filter.Set(input[i]);
+						filter.Step();
+						output[i] = filter.Get();
+					}
+				}
+			};
+
+			/// <summary>
+			/// Input storage of a static filter used on its own.
+			/// </summary>
+			/// <typeparam name="value_t"></typeparam>
+			template<typename value_t>
+			class StaticInput
+			{
+			protected:
+				value_t Input = 0;
+
+			public:
+				StaticInput() {}
+			};
+
+			/// <summary>
+			/// Non-virtual counterpart of AbstractFilter.
+			/// </summary>
+			/// <typeparam name="Derived">Implementing filter type.</typeparam>
+			/// <typeparam name="value_t"></typeparam>
+			/// <typeparam name="InputType">Input storage, AbstractFilter to build the AbstractFilter implementer over the same Input.</typeparam>
+			template<typename Derived,
+				typename value_t,
+				typename InputType = StaticInput<value_t>>
+			class AbstractStaticFilter : public InputType, public StaticFilter<Derived, value_t>
+			{
+			protected:
+				using InputType::Input;
+
+			public:
+				AbstractStaticFilter() : InputType(), StaticFilter<Derived, value_t>() {}
+
+				void Set(const value_t value)
+				{
+					Input = value;
+				}
+
+				void Clear(const value_t value = 0)
+				{
+					Input = value;
+				}
+			};
+
+			/// <summary>
+			/// Turns a static filter into a IFilter interface implementer,
+			/// for runtime polymorphism only where it is needed.
+			/// </summary>
+			/// <typeparam name="FilterType">Static filter type.</typeparam>
+			/// <typeparam name="value_t"></typeparam>
+			template<typename FilterType,
+				typename value_t>
+			class Interface : public IFilter<value_t>, public FilterType
+			{
+			public:
+				Interface() : IFilter<value_t>(), FilterType() {}
+
+				virtual void Clear()
+				{
+					FilterType::Clear();
+				}
+
+				/// <summary>
+				/// Clear to a steady-state, for filters that support it.
+				/// </summary>
+				void Clear(const value_t value)
+				{
+					FilterType::Clear(value);
+				}
+
+				virtual void Set(const value_t value)
+				{
+					FilterType::Set(value);
+				}
+
+				virtual void Step()
+				{
+					FilterType::Step();
+				}
+
+				virtual const value_t Get() const
+				{
+					return FilterType::Get();
+				}
+			};
+
+			/// <summary>
+			/// Turns a static filter into a AbstractFilter implementer,
+			/// for filters that clear to a steady state and are used through AbstractFilter.
+			/// The static filter is built over AbstractFilter's Input, so it keeps a single input and the layout of an AbstractFilter subclass.
+			/// Its Set(), Clear(value), Step() and Get() override the virtual ones.
+			/// </summary>
+			/// <typeparam name="FilterType">Static filter type, with Clear(value) and AbstractFilter as InputType.</typeparam>
+			/// <typeparam name="value_t"></typeparam>
+			template<typename FilterType,
+				typename value_t>
+			class AbstractInterface : public FilterType
+			{
+			public:
+				AbstractInterface() : FilterType() {}
+
+				virtual void Clear()
+				{
+					FilterType::Clear();
+				}
+
+				/// <summary>
+				/// Clear to a steady-state, also when called through AbstractFilter.
+				/// </summary>
+				virtual void Clear(const value_t value)
+				{
+					FilterType::Clear(value);
+				}
+			};
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -12,18 +12,21 @@ namespace IntegerSignal
 			namespace Template
 			{
 				/// <summary>
+				/// Low Pass Filter, without virtual dispatch.
 				/// Inspired by https://hackaday.io/project/158959-integer-low-pass-filter/log/147712-filtering-without-multiplication .
 				/// </summary>
 				/// <typeparam name="unsigned_t"></typeparam>
 				/// <typeparam name="intermediate_t"></typeparam>
 				/// <typeparam name="factor">[0 ; MaxFactor]</typeparam>
+				/// <typeparam name="InputType">Input storage, AbstractFilter for the AbstractFilter implementer.</typeparam>
 				template<typename unsigned_t,
 					typename intermediate_t,
-					uint8_t factor>
-				class Filter : public IntegerSignal::Filter::AbstractFilter<unsigned_t>
+					uint8_t factor,
+					typename InputType = IntegerSignal::Filter::Template::StaticInput<unsigned_t>>
+				class StaticFilter : public IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, intermediate_t, factor, InputType>, unsigned_t, InputType>
 				{
 				private:
-					using Base = IntegerSignal::Filter::AbstractFilter<unsigned_t>;
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, intermediate_t, factor, InputType>, unsigned_t, InputType>;
 
 				public:
 					static constexpr uint8_t MaxFactor = sizeof(unsigned_t) * 8;
@@ -35,24 +38,59 @@ namespace IntegerSignal
 					intermediate_t HighValue = 0;
 
 				public:
-					Filter() : Base() {}
+					StaticFilter() : Base() {}
 
-					virtual void Clear(const unsigned_t value = 0)
+					void Clear(const unsigned_t value = 0)
 					{
 						Base::Clear(value);
 						HighValue = intermediate_t(value) << factor;
 					}
 
-					virtual void Step()
+					void Step()
 					{
 						HighValue = HighValue - (HighValue >> factor) + Input;
 					}
 
-					virtual const unsigned_t Get() const
+					const unsigned_t Get() const
 					{
 						// Fast operation, no need to store the raw output.
 						return (unsigned_t)(HighValue >> factor);
 					}
+
+					/// <summary>
+					/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+					/// The accumulator is kept local for the whole block, without virtual dispatch.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Filtered samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const unsigned_t* input, unsigned_t* output, const size_t count)
+					{
+						intermediate_t high = HighValue;
+						unsigned_t last = Input;
+
+						for (size_t i = 0; i < count; i++)
+						{
+							last = input[i];
+							high = high - (high >> factor) + last;
+							output[i] = (unsigned_t)(high >> factor);
+						}
+
+						HighValue = high;
+						Input = last;
+					}
+				};
+
+				/// <summary>
+				/// AbstractFilter implementer of StaticFilter.
+				/// </summary>
+				template<typename unsigned_t,
+					typename intermediate_t,
+					uint8_t factor>
+				class Filter : public IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, intermediate_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>
+				{
+				public:
+					Filter() : IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, intermediate_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>() {}
 				};
 			}
 		}
@@ -98,6 +136,51 @@ namespace IntegerSignal
 		/// <typeparam name="Factor">[0 ; 32]</typeparam>
 		template<uint8_t factor = 4>
 		using LowPassI32 = Filter::SignedI32<LowPassU32<factor>>;
+
+		namespace Static
+		{
+			/// <summary>
+			/// Non-virtual Low Pass Filter (unsigned 8 bit).
+			/// </summary>
+			/// <typeparam name="Factor">[0 ; 8]</typeparam>
+			template<const uint8_t Factor = 4>
+			using LowPassU8 = LowPass::Template::StaticFilter<uint8_t, uint_fast16_t, Factor>;
+
+			/// <summary>
+			/// Non-virtual Low Pass Filter (unsigned 16 bit).
+			/// </summary>
+			/// <typeparam name="Factor">[0 ; 16]</typeparam>
+			template<const uint8_t Factor = 4>
+			using LowPassU16 = LowPass::Template::StaticFilter<uint16_t, uint_fast32_t, Factor>;
+
+			/// <summary>
+			/// Non-virtual Low Pass Filter (unsigned 32 bit).
+			/// </summary>
+			/// <typeparam name="Factor">[0 ; 32]</typeparam>
+			template<const uint8_t Factor = 4>
+			using LowPassU32 = LowPass::Template::StaticFilter<uint32_t, uint_fast64_t, Factor>;
+
+			/// <summary>
+			/// Non-virtual Low Pass Filter (signed 8 bit).
+			/// </summary>
+			/// <typeparam name="Factor">[0 ; 8]</typeparam>
+			template<uint8_t factor = 4>
+			using LowPassI8 = Filter::StaticSignedI8<LowPassU8<factor>>;
+
+			/// <summary>
+			/// Non-virtual Low Pass Filter (signed 16 bit).
+			/// </summary>
+			/// <typeparam name="Factor">[0 ; 16]</typeparam>
+			template<uint8_t factor = 4>
+			using LowPassI16 = Filter::StaticSignedI16<LowPassU16<factor>>;
+
+			/// <summary>
+			/// Non-virtual Low Pass Filter (signed 32 bit).
+			/// </summary>
+			/// <typeparam name="Factor">[0 ; 32]</typeparam>
+			template<uint8_t factor = 4>
+			using LowPassI32 = Filter::StaticSignedI32<LowPassU32<factor>>;
+		}
 	}
 }
 #endif
\ No newline at end of file
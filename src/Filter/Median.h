@@ -0,0 +1,323 @@
+#ifndef _INTEGER_SIGNAL_MEDIAN_FILTER_h
+#define _INTEGER_SIGNAL_MEDIAN_FILTER_h
+
+#include "IFilter.h"
+#include "../Base/TypeTraits.h"
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Median
+		{
+			namespace Network
+			{
+				/// <summary>
+				/// Branch-free compare-exchange, a ends with the minimum and b with the maximum.
+				/// </summary>
+				template<typename value_t>
+				static void Sort(value_t& a, value_t& b)
+				{
+					const value_t low = (a < b) ? a : b;
+					b = (a < b) ? b : a;
+					a = low;
+				}
+
+				/// <summary>
+				/// Median selection networks, after N. Devillard, "Fast median search: an ANSI C implementation".
+				/// The values are shuffled in place.
+				/// </summary>
+				template<typename value_t, uint8_t window>
+				struct Selector;
+
+				template<typename value_t>
+				struct Selector<value_t, 3>
+				{
+					static value_t Get(value_t* p)
+					{
+						Sort(p[0], p[1]); Sort(p[1], p[2]); Sort(p[0], p[1]);
+
+						return p[1];
+					}
+				};
+
+				template<typename value_t>
+				struct Selector<value_t, 5>
+				{
+					static value_t Get(value_t* p)
+					{
+						Sort(p[0], p[1]); Sort(p[3], p[4]); Sort(p[0], p[3]);
+						Sort(p[1], p[4]); Sort(p[1], p[2]); Sort(p[2], p[3]);
+						Sort(p[1], p[2]);
+
+						return p[2];
+					}
+				};
+
+				template<typename value_t>
+				struct Selector<value_t, 7>
+				{
+					static value_t Get(value_t* p)
+					{
+						Sort(p[0], p[5]); Sort(p[0], p[3]); Sort(p[1], p[6]);
+						Sort(p[2], p[4]); Sort(p[0], p[1]); Sort(p[3], p[5]);
+						Sort(p[2], p[6]); Sort(p[2], p[3]); Sort(p[3], p[6]);
+						Sort(p[4], p[5]); Sort(p[1], p[4]); Sort(p[1], p[3]);
+						Sort(p[3], p[4]);
+
+						return p[3];
+					}
+				};
+
+				template<typename value_t>
+				struct Selector<value_t, 9>
+				{
+					static value_t Get(value_t* p)
+					{
+						Sort(p[1], p[2]); Sort(p[4], p[5]); Sort(p[7], p[8]);
+						Sort(p[0], p[1]); Sort(p[3], p[4]); Sort(p[6], p[7]);
+						Sort(p[1], p[2]); Sort(p[4], p[5]); Sort(p[7], p[8]);
+						Sort(p[0], p[3]); Sort(p[5], p[8]); Sort(p[4], p[7]);
+						Sort(p[3], p[6]); Sort(p[1], p[4]); Sort(p[2], p[5]);
+						Sort(p[4], p[7]); Sort(p[4], p[2]); Sort(p[6], p[4]);
+						Sort(p[4], p[2]);
+
+						return p[4];
+					}
+				};
+			}
+
+			namespace Template
+			{
+				/// <summary>
+				/// Median of a sliding window, in a sorted copy of the window.
+				/// The outgoing sample is found by binary search, O(log N),
+				/// then the incoming sample slides to its sorted position, moving only the samples in between.
+				/// </summary>
+				template<typename value_t,
+					uint8_t window,
+					bool network>
+				class Kernel
+				{
+				private:
+					value_t History[window]{};
+					value_t Sorted[window]{};
+					uint8_t Index = 0;
+
+				public:
+					void Clear(const value_t value)
+					{
+						for (uint8_t i = 0; i < window; i++)
+						{
+							History[i] = value;
+							Sorted[i] = value;
+						}
+						Index = 0;
+					}
+
+					value_t Push(const value_t value)
+					{
+						const value_t outgoing = History[Index];
+						History[Index] = value;
+						Index = (Index + 1 < window) ? (Index + 1) : 0;
+
+						// Lower bound of the outgoing sample.
+						uint8_t low = 0;
+						uint8_t high = window - 1;
+						while (low < high)
+						{
+							const uint8_t middle = (low + high) >> 1;
+							if (Sorted[middle] < outgoing)
+								low = middle + 1;
+							else
+								high = middle;
+						}
+
+						uint8_t position = low;
+						if (outgoing < value)
+						{
+							while (position + 1 < window && Sorted[position + 1] < value)
+							{
+								Sorted[position] = Sorted[position + 1];
+								position++;
+							}
+						}
+						else
+						{
+							while (position > 0 && value < Sorted[position - 1])
+							{
+								Sorted[position] = Sorted[position - 1];
+								position--;
+							}
+						}
+						Sorted[position] = value;
+
+						return Sorted[window >> 1];
+					}
+				};
+
+				/// <summary>
+				/// Median of a sliding window, with a branch-free selection network over a copy of the window.
+				/// </summary>
+				template<typename value_t,
+					uint8_t window>
+				class Kernel<value_t, window, true>
+				{
+				private:
+					value_t History[window]{};
+					uint8_t Index = 0;
+
+				public:
+					void Clear(const value_t value)
+					{
+						for (uint8_t i = 0; i < window; i++)
+						{
+							History[i] = value;
+						}
+						Index = 0;
+					}
+
+					value_t Push(const value_t value)
+					{
+						History[Index] = value;
+						Index = (Index + 1 < window) ? (Index + 1) : 0;
+
+						value_t values[window];
+						for (uint8_t i = 0; i < window; i++)
+						{
+							values[i] = History[i];
+						}
+
+						return Network::Selector<value_t, window>::Get(values);
+					}
+				};
+
+				/// <summary>
+				/// Median (rank-order) filter, without virtual dispatch.
+				/// Rejects impulse noise shorter than half the window, where averaging filters smear it.
+				/// Windows 3, 5, 7 and 9 use selection networks, larger windows a sorted window.
+				/// </summary>
+				/// <typeparam name="value_t">Signed or unsigned sample type.</typeparam>
+				/// <typeparam name="window">Odd window size [3 ; 63].</typeparam>
+				/// <typeparam name="InputType">Input storage, AbstractFilter for the AbstractFilter implementer.</typeparam>
+				template<typename value_t,
+					uint8_t window,
+					typename InputType = IntegerSignal::Filter::Template::StaticInput<value_t>>
+				class StaticFilter : public IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<value_t, window, InputType>, value_t, InputType>
+				{
+				private:
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<value_t, window, InputType>, value_t, InputType>;
+
+				public:
+					static_assert(window >= 3 && window <= 63 && (window & 1), "Median::Filter requires an odd window in [3 ; 63]");
+
+					static constexpr uint8_t Window = window;
+
+				protected:
+					using Base::Input;
+
+				private:
+					Kernel<value_t, window, (window <= 9)> Samples{};
+					value_t Output = 0;
+
+				public:
+					StaticFilter() : Base() {}
+
+					// Clear to a steady-state output equal to 'value'
+					void Clear(const value_t value = 0)
+					{
+						Base::Clear(value);
+						Samples.Clear(value);
+						Output = value;
+					}
+
+					void Step()
+					{
+						Output = Samples.Push(Input);
+					}
+
+					const value_t Get() const
+					{
+						return Output;
+					}
+
+					/// <summary>
+					/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Filtered samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const value_t* input, value_t* output, const size_t count)
+					{
+						if (count == 0)
+						{
+							return;
+						}
+
+						Input = input[count - 1];
+						for (size_t i = 0; i < count; i++)
+						{
+							output[i] = Samples.Push(input[i]);
+						}
+						Output = output[count - 1];
+					}
+				};
+
+				/// <summary>
+				/// AbstractFilter implementer of StaticFilter.
+				/// </summary>
+				template<typename value_t,
+					uint8_t window>
+				class Filter : public IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<value_t, window, IntegerSignal::Filter::AbstractFilter<value_t>>, value_t>
+				{
+				public:
+					Filter() : IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<value_t, window, IntegerSignal::Filter::AbstractFilter<value_t>>, value_t>() {}
+				};
+			}
+		}
+
+		/// <summary>
+		/// Median filters, signed types keep their own ordering, without the Signed wrapper.
+		/// </summary>
+		/// <typeparam name="window">Odd window size [3 ; 63]</typeparam>
+		template<uint8_t window = 5>
+		using MedianU8 = Median::Template::Filter<uint8_t, window>;
+
+		template<uint8_t window = 5>
+		using MedianU16 = Median::Template::Filter<uint16_t, window>;
+
+		template<uint8_t window = 5>
+		using MedianU32 = Median::Template::Filter<uint32_t, window>;
+
+		template<uint8_t window = 5>
+		using MedianI8 = Median::Template::Filter<int8_t, window>;
+
+		template<uint8_t window = 5>
+		using MedianI16 = Median::Template::Filter<int16_t, window>;
+
+		template<uint8_t window = 5>
+		using MedianI32 = Median::Template::Filter<int32_t, window>;
+
+		namespace Static
+		{
+			template<uint8_t window = 5>
+			using MedianU8 = Median::Template::StaticFilter<uint8_t, window>;
+
+			template<uint8_t window = 5>
+			using MedianU16 = Median::Template::StaticFilter<uint16_t, window>;
+
+			template<uint8_t window = 5>
+			using MedianU32 = Median::Template::StaticFilter<uint32_t, window>;
+
+			template<uint8_t window = 5>
+			using MedianI8 = Median::Template::StaticFilter<int8_t, window>;
+
+			template<uint8_t window = 5>
+			using MedianI16 = Median::Template::StaticFilter<int16_t, window>;
+
+			template<uint8_t window = 5>
+			using MedianI32 = Median::Template::StaticFilter<int32_t, window>;
+		}
+	}
+}
+#endif
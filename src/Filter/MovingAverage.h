@@ -0,0 +1,180 @@
+#ifndef _INTEGER_SIGNAL_MOVING_AVERAGE_FILTER_h
+#define _INTEGER_SIGNAL_MOVING_AVERAGE_FILTER_h
+
+#include "IFilter.h"
+#include "../Base/ByteSize.h"
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace MovingAverage
+		{
+			namespace Template
+			{
+				/// <summary>
+				/// Moving Average (boxcar) filter, without virtual dispatch.
+				/// Running sum over a circular history of 2^factor samples, O(1) per sample.
+				/// The average is rounded to the nearest, with a shift instead of a division.
+				/// </summary>
+				/// <typeparam name="unsigned_t"></typeparam>
+				/// <typeparam name="factor">Window of 2^factor samples [1 ; 12]</typeparam>
+				/// <typeparam name="InputType">Input storage, AbstractFilter for the AbstractFilter implementer.</typeparam>
+				template<typename unsigned_t,
+					uint8_t factor,
+					typename InputType = IntegerSignal::Filter::Template::StaticInput<unsigned_t>>
+				class StaticFilter : public IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, factor, InputType>, unsigned_t, InputType>
+				{
+				private:
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<StaticFilter<unsigned_t, factor, InputType>, unsigned_t, InputType>;
+
+				public:
+					static_assert(factor >= 1 && factor <= 12, "MovingAverage::Filter requires factor in [1 ; 12]");
+
+					static constexpr uint16_t Window = uint16_t(1) << factor;
+
+				private:
+					/// <summary>
+					/// Smallest types for the full window sum and the history index.
+					/// </summary>
+					using sum_t = typename ByteSize::uint_type<(uint64_t(TypeTraits::TypeLimits::type_limits<unsigned_t>::Max()) << factor) + (Window >> 1)>::type;
+					using index_t = typename ByteSize::uint_type<Window - 1>::type;
+
+					static constexpr sum_t Half = sum_t(Window >> 1);
+					static constexpr index_t IndexMask = index_t(Window - 1);
+
+				protected:
+					using Base::Input;
+
+				private:
+					unsigned_t History[Window]{};
+					sum_t Sum = 0;
+					index_t Index = 0;
+					unsigned_t Output = 0;
+
+				public:
+					StaticFilter() : Base() {}
+
+					// Clear to a steady-state output equal to 'value'
+					void Clear(const unsigned_t value = 0)
+					{
+						Base::Clear(value);
+						for (uint16_t i = 0; i < Window; i++)
+						{
+							History[i] = value;
+						}
+						Sum = sum_t(value) << factor;
+						Index = 0;
+						Output = value;
+					}
+
+					void Step()
+					{
+						Sum = Sum - History[Index] + Input;
+						History[Index] = Input;
+						Index = (Index + 1) & IndexMask;
+						Output = (unsigned_t)((Sum + Half) >> factor);
+					}
+
+					const unsigned_t Get() const
+					{
+						return Output;
+					}
+
+					/// <summary>
+					/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+					/// The running sum and index are kept local for the whole block, without virtual dispatch.
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Filtered samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const unsigned_t* input, unsigned_t* output, const size_t count)
+					{
+						sum_t sum = Sum;
+						index_t index = Index;
+						unsigned_t last = Input;
+						unsigned_t out = Output;
+
+						for (size_t i = 0; i < count; i++)
+						{
+							last = input[i];
+							sum = sum - History[index] + last;
+							History[index] = last;
+							index = (index + 1) & IndexMask;
+							out = (unsigned_t)((sum + Half) >> factor);
+							output[i] = out;
+						}
+
+						Sum = sum;
+						Index = index;
+						Input = last;
+						Output = out;
+					}
+				};
+
+				/// <summary>
+				/// AbstractFilter implementer of StaticFilter.
+				/// </summary>
+				template<typename unsigned_t,
+					uint8_t factor>
+				class Filter : public IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>
+				{
+				public:
+					Filter() : IntegerSignal::Filter::Template::AbstractInterface<StaticFilter<unsigned_t, factor, IntegerSignal::Filter::AbstractFilter<unsigned_t>>, unsigned_t>() {}
+				};
+			}
+		}
+
+		/// <summary>
+		/// Moving Average filter (unsigned 8 bit).
+		/// </summary>
+		/// <typeparam name="factor">Window of 2^factor samples [1 ; 12]</typeparam>
+		template<uint8_t factor = 4>
+		using MovingAverageU8 = MovingAverage::Template::Filter<uint8_t, factor>;
+
+		/// <summary>
+		/// Moving Average filter (unsigned 16 bit).
+		/// </summary>
+		/// <typeparam name="factor">Window of 2^factor samples [1 ; 12]</typeparam>
+		template<uint8_t factor = 4>
+		using MovingAverageU16 = MovingAverage::Template::Filter<uint16_t, factor>;
+
+		/// <summary>
+		/// Moving Average filter (unsigned 32 bit).
+		/// </summary>
+		/// <typeparam name="factor">Window of 2^factor samples [1 ; 12]</typeparam>
+		template<uint8_t factor = 4>
+		using MovingAverageU32 = MovingAverage::Template::Filter<uint32_t, factor>;
+
+		template<uint8_t factor = 4>
+		using MovingAverageI8 = Filter::SignedI8<MovingAverageU8<factor>>;
+
+		template<uint8_t factor = 4>
+		using MovingAverageI16 = Filter::SignedI16<MovingAverageU16<factor>>;
+
+		template<uint8_t factor = 4>
+		using MovingAverageI32 = Filter::SignedI32<MovingAverageU32<factor>>;
+
+		namespace Static
+		{
+			template<uint8_t factor = 4>
+			using MovingAverageU8 = MovingAverage::Template::StaticFilter<uint8_t, factor>;
+
+			template<uint8_t factor = 4>
+			using MovingAverageU16 = MovingAverage::Template::StaticFilter<uint16_t, factor>;
+
+			template<uint8_t factor = 4>
+			using MovingAverageU32 = MovingAverage::Template::StaticFilter<uint32_t, factor>;
+
+			template<uint8_t factor = 4>
+			using MovingAverageI8 = Filter::StaticSignedI8<MovingAverageU8<factor>>;
+
+			template<uint8_t factor = 4>
+			using MovingAverageI16 = Filter::StaticSignedI16<MovingAverageU16<factor>>;
+
+			template<uint8_t factor = 4>
+			using MovingAverageI32 = Filter::StaticSignedI32<MovingAverageU32<factor>>;
+		}
+	}
+}
+#endif
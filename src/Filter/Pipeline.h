@@ -0,0 +1,243 @@
+// Pipeline.h
+
+#ifndef _INTEGER_SIGNAL_FILTER_PIPELINE_h
+#define _INTEGER_SIGNAL_FILTER_PIPELINE_h
+
+#include "IFilter.h"
+
+namespace IntegerSignal
+{
+	namespace Filters
+	{
+		namespace Pipelines
+		{
+			namespace Template
+			{
+				/// <summary>
+				/// Filter stages have Step(), curve stages only have a static Get(input).
+				/// </summary>
+				template<typename StageType>
+				struct IsFilterStage
+				{
+				private:
+					template<typename T>
+					static uint8_t Test(decltype(&T::Step));
+
+					template<typename T>
+					static uint16_t Test(...);
+
+				public:
+					enum { value = sizeof(Test<StageType>(nullptr)) == sizeof(uint8_t) };
+				};
+
+				/// <summary>
+				/// Filter stage, owns the filter state.
+				/// </summary>
+				template<typename StageType,
+					typename value_t,
+					bool isFilter = IsFilterStage<StageType>::value>
+				class Stage
+				{
+				private:
+					StageType Filter{};
+
+				public:
+					void Clear()
+					{
+						Filter.Clear();
+					}
+
+					/// <summary>
+					/// Clear to the steady state of a constant input, for filters that support it.
+					/// </summary>
+					/// <returns>Steady-state output, to clear the next stage with.</returns>
+					value_t Clear(const value_t value)
+					{
+						Filter.Clear(value);
+
+						return Filter.Get();
+					}
+
+					value_t Apply(const value_t input)
+					{
+						Filter.Set(input);
+						Filter.Step();
+
+						return Filter.Get();
+					}
+				};
+
+				/// <summary>
+				/// Curve stage, stateless.
+				/// </summary>
+				template<typename StageType,
+					typename value_t>
+				class Stage<StageType, value_t, false>
+				{
+				public:
+					void Clear() {}
+
+					value_t Clear(const value_t value)
+					{
+						return StageType::Get(value);
+					}
+
+					value_t Apply(const value_t input)
+					{
+						return StageType::Get(input);
+					}
+				};
+
+				/// <summary>
+				/// Ordered stage list, each stage feeds the next one.
+				/// </summary>
+				template<typename value_t,
+					typename... Stages>
+				class Chain
+				{
+				public:
+					void Clear() {}
+
+					value_t Clear(const value_t value)
+					{
+						return value;
+					}
+
+					value_t Apply(const value_t input)
+					{
+						return input;
+					}
+				};
+
+				template<typename value_t,
+					typename FirstStage,
+					typename... Stages>
+				class Chain<value_t, FirstStage, Stages...> : private Stage<FirstStage, value_t>
+				{
+				private:
+					using Head = Stage<FirstStage, value_t>;
+
+				private:
+					Chain<value_t, Stages...> Tail{};
+
+				public:
+					void Clear()
+					{
+						Head::Clear();
+						Tail.Clear();
+					}
+
+					value_t Clear(const value_t value)
+					{
+						return Tail.Clear(Head::Clear(value));
+					}
+
+					value_t Apply(const value_t input)
+					{
+						return Tail.Apply(Head::Apply(input));
+					}
+				};
+
+				/// <summary>
+				/// Compile-time chain of filter and curve stages, run in order on every sample.
+				/// Stages are resolved statically: no virtual calls, the whole chain inlines into a single loop.
+				/// Filter stages should be static filters (e.g. Static::EmaU16<4>), curve stages are any curve (e.g. Power2U16<>).
+				/// </summary>
+				/// <typeparam name="value_t">Value type shared by all stages.</typeparam>
+				/// <typeparam name="StageTypes">Filter and curve stages, from input to output.</typeparam>
+				template<typename value_t,
+					typename... StageTypes>
+				class Pipeline : public IntegerSignal::Filter::Template::AbstractStaticFilter<Pipeline<value_t, StageTypes...>, value_t>
+				{
+				private:
+					using Base = IntegerSignal::Filter::Template::AbstractStaticFilter<Pipeline<value_t, StageTypes...>, value_t>;
+
+				protected:
+					using Base::Input;
+
+				private:
+					Chain<value_t, StageTypes...> Stages{};
+					value_t Output = 0;
+
+				public:
+					Pipeline() : Base() {}
+
+					/// <summary>
+					/// Clear the state of all stages.
+					/// </summary>
+					void Clear()
+					{
+						Base::Clear();
+						Stages.Clear();
+						Output = 0;
+					}
+
+					/// <summary>
+					/// Clear all stages to the steady state of a constant input.
+					/// Each filter stage is cleared to the steady-state output of the stage before it.
+					/// All filter stages must support Clear(value).
+					/// </summary>
+					void Clear(const value_t value)
+					{
+						Base::Clear(value);
+						Output = Stages.Clear(value);
+					}
+
+					void Step()
+					{
+						Output = Stages.Apply(Input);
+					}
+
+					const value_t Get() const
+					{
+						return Output;
+					}
+
+					/// <summary>
+					/// Runs a block of samples through all stages, bit-exact with Set(), Step() and Get() per sample.
+					/// The stages are updated in place, without copying their state (e.g. moving average windows).
+					/// </summary>
+					/// <param name="input">Input samples.</param>
+					/// <param name="output">Output samples, may alias input.</param>
+					/// <param name="count">Number of samples.</param>
+					void ProcessBlock(const value_t* input, value_t* output, const size_t count)
+					{
+						if (count == 0)
+						{
+							return;
+						}
+
+						const value_t last = input[count - 1];
+
+						for (size_t i = 0; i < count; i++)
+						{
+							output[i] = Stages.Apply(input[i]);
+						}
+
+						Input = last;
+						Output = output[count - 1];
+					}
+				};
+			}
+		}
+
+		template<typename... Stages>
+		using PipelineU8 = Pipelines::Template::Pipeline<uint8_t, Stages...>;
+
+		template<typename... Stages>
+		using PipelineU16 = Pipelines::Template::Pipeline<uint16_t, Stages...>;
+
+		template<typename... Stages>
+		using PipelineU32 = Pipelines::Template::Pipeline<uint32_t, Stages...>;
+
+		template<typename... Stages>
+		using PipelineI8 = Pipelines::Template::Pipeline<int8_t, Stages...>;
+
+		template<typename... Stages>
+		using PipelineI16 = Pipelines::Template::Pipeline<int16_t, Stages...>;
+
+		template<typename... Stages>
+		using PipelineI32 = Pipelines::Template::Pipeline<int32_t, Stages...>;
+	}
+}
+#endif
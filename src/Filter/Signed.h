@@ -12,14 +12,14 @@ namespace IntegerSignal
 		namespace Template
 		{
 			/// <summary>
-			/// Wraps an unsigned IFilter with a signed input/output.
+			/// Wraps an unsigned filter with a signed input/output, without virtual dispatch.
 			/// </summary>
-			/// <typeparam name="FilterType">Unsigned value IFilter type.</typeparam>
+			/// <typeparam name="FilterType">Unsigned value filter type.</typeparam>
 			/// <typeparam name="signed_t">The matching signed type, of the same bitwidth.</typeparam>
 			template<typename FilterType,
 				typename unsigned_t,
 				typename signed_t>
-			class Signed : public IFilter<signed_t>
+			class StaticSigned : public StaticFilter<StaticSigned<FilterType, unsigned_t, signed_t>, signed_t>
 			{
 			private:
 				static constexpr unsigned_t Middle()
@@ -34,28 +34,42 @@ namespace IntegerSignal
 				FilterType Signal{};
 
 			public:
-				Signed() : IFilter<signed_t>() {}
+				StaticSigned() : StaticFilter<StaticSigned<FilterType, unsigned_t, signed_t>, signed_t>() {}
 
-				virtual void Clear()
+				void Clear()
 				{
 					Signal.Clear(Middle());
 				}
 
-				virtual void Set(const signed_t value)
+				void Set(const signed_t value)
 				{
 					Signal.Set((unsigned_t)(Middle() + value));
 				}
 
-				virtual void Step()
+				void Step()
 				{
 					Signal.Step();
 				}
 
-				virtual const signed_t Get() const
+				const signed_t Get() const
 				{
 					return (signed_t)(Signal.Get()) - Middle();
 				}
 			};
+
+			/// <summary>
+			/// Wraps an unsigned IFilter with a signed input/output.
+			/// </summary>
+			/// <typeparam name="FilterType">Unsigned value IFilter type.</typeparam>
+			/// <typeparam name="signed_t">The matching signed type, of the same bitwidth.</typeparam>
+			template<typename FilterType,
+				typename unsigned_t,
+				typename signed_t>
+			class Signed : public Interface<StaticSigned<FilterType, unsigned_t, signed_t>, signed_t>
+			{
+			public:
+				Signed() : Interface<StaticSigned<FilterType, unsigned_t, signed_t>, signed_t>() {}
+			};
 		}
 
 		template<typename FilterType>
@@ -66,6 +80,15 @@ namespace IntegerSignal
 
 		template<typename FilterType>
 		using SignedI32 = Template::Signed<FilterType, uint32_t, int32_t>;
+
+		template<typename FilterType>
+		using StaticSignedI8 = Template::StaticSigned<FilterType, uint8_t, int8_t>;
+
+		template<typename FilterType>
+		using StaticSignedI16 = Template::StaticSigned<FilterType, uint16_t, int16_t>;
+
+		template<typename FilterType>
+		using StaticSignedI32 = Template::StaticSigned<FilterType, uint32_t, int32_t>;
 	}
 }
 
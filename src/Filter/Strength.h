@@ -13,6 +13,7 @@ namespace IntegerSignal
 		{
 			/// <summary>
 			/// Scales the base filter strength, between the input and raw output.
+			/// Non-virtual over a static base filter (e.g. Static::EmaU8), IFilter implementer over an IFilter base.
 			/// </summary>
 			/// <typeparam name="FilterType">Base filter type.</typeparam>
 			/// <typeparam name="unsigned_t">Filter value type.</typeparam>
@@ -33,22 +34,39 @@ namespace IntegerSignal
 			public:
 				Strength() : FilterType() {}
 
-				virtual void Clear()
+				void Clear()
 				{
 					FilterType::Clear();
 					Output = 0;
 				}
 
-				virtual void Step()
+				void Step()
 				{
 					FilterType::Step();
 					Output = Mix::Template::Linear<unsigned_t, intermediate_t>(Input, FilterType::Get(), filterStrength);
 				}
 
-				virtual const unsigned_t Get() const
+				const unsigned_t Get() const
 				{
 					return Output;
 				}
+
+				/// <summary>
+				/// Filters a block of samples, bit-exact with Set(), Step() and Get() per sample.
+				/// Hides the base filter's block processing, which has no strength scaling.
+				/// </summary>
+				/// <param name="input">Input samples.</param>
+				/// <param name="output">Filtered samples, may alias input.</param>
+				/// <param name="count">Number of samples.</param>
+				void ProcessBlock(const unsigned_t* input, unsigned_t* output, const size_t count)
+				{
+					for (size_t i = 0; i < count; i++)
+					{
+						FilterType::Set(input[i]);
+						Strength::Step();
+						output[i] = Output;
+					}
+				}
 			};
 		}
 
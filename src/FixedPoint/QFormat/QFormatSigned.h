@@ -5,6 +5,7 @@
 #include "Base/Operation.h"
 #include "Base/TypeTraits.h"
 #include "Base/BitSize.h"
+#include "Base/BitShift.h"
 
 // Configure strict compile-time checks.
 // Default: disabled on AVR and older GCC to avoid non-constant-expression issues.
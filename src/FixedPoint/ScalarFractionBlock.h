@@ -0,0 +1,782 @@
+#ifndef _INTEGER_SIGNAL_FIXED_POINT_FRACTION_BLOCK_h
+#define _INTEGER_SIGNAL_FIXED_POINT_FRACTION_BLOCK_h
+
+#include <stddef.h>
+#include "ScalarFraction.h"
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <arm_neon.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace FixedPoint
+	{
+		namespace ScalarFractionBlocks
+		{
+			using namespace ScalarFraction::ScalarAliases;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			/// <summary>
+			/// uint16_t values by ufraction16_t scalars: (value * scalar) >> 15, from the 32-bit product halves.
+			/// </summary>
+			struct FractionU16
+			{
+				using value_t = uint16_t;
+				static constexpr size_t Lanes = 16;
+
+				static __m256i Apply(const __m256i values, const __m256i scalars)
+				{
+					return _mm256_or_si256(_mm256_slli_epi16(_mm256_mulhi_epu16(values, scalars), 1),
+						_mm256_srli_epi16(_mm256_mullo_epi16(values, scalars), 15));
+				}
+			};
+
+			/// <summary>
+			/// int16_t values by ufraction16_t scalars: (value * scalar) >> 15.
+			/// The unsigned high product is corrected for negative values, so the 1X scalar (0x8000) is exact.
+			/// </summary>
+			struct FractionI16U
+			{
+				using value_t = int16_t;
+				static constexpr size_t Lanes = 16;
+
+				static __m256i Apply(const __m256i values, const __m256i scalars)
+				{
+					const __m256i high = _mm256_sub_epi16(_mm256_mulhi_epu16(values, scalars),
+						_mm256_and_si256(_mm256_srai_epi16(values, 15), scalars));
+
+					return _mm256_or_si256(_mm256_slli_epi16(high, 1),
+						_mm256_srli_epi16(_mm256_mullo_epi16(values, scalars), 15));
+				}
+			};
+
+			/// <summary>
+			/// int16_t values by fraction16_t scalars: (value * scalar) / 2^14, rounded towards zero as SignedRightShift().
+			/// </summary>
+			struct FractionI16
+			{
+				using value_t = int16_t;
+				static constexpr size_t Lanes = 16;
+
+				static __m256i Apply(const __m256i values, const __m256i scalars)
+				{
+					const __m256i high = _mm256_mulhi_epi16(values, scalars);
+					const __m256i low = _mm256_mullo_epi16(values, scalars);
+					const __m256i floor = _mm256_or_si256(_mm256_slli_epi16(high, 2), _mm256_srli_epi16(low, 14));
+
+					// Negative products with a remainder round up by one.
+					const __m256i exact = _mm256_cmpeq_epi16(_mm256_and_si256(low, _mm256_set1_epi16((1 << 14) - 1)), _mm256_setzero_si256());
+
+					return _mm256_sub_epi16(floor, _mm256_andnot_si256(exact, _mm256_srai_epi16(high, 15)));
+				}
+			};
+
+			/// <summary>
+			/// uint32_t values by ufraction32_t scalars: (value * scalar) >> 31, even and odd lanes in 64-bit products.
+			/// </summary>
+			struct FractionU32
+			{
+				using value_t = uint32_t;
+				static constexpr size_t Lanes = 8;
+
+				static __m256i Apply(const __m256i values, const __m256i scalars)
+				{
+					const __m256i even = _mm256_mul_epu32(values, scalars);
+					const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(values, 32), _mm256_srli_epi64(scalars, 32));
+
+					return _mm256_blend_epi32(_mm256_srli_epi64(even, 31), _mm256_slli_epi64(odd, 1), 0xAA);
+				}
+			};
+
+			/// <summary>
+			/// int32_t values by fraction32_t scalars: (value * scalar) / 2^30, rounded towards zero as SignedRightShift().
+			/// Even and odd lanes in 64-bit products, only the low 32 bits of the shifted product are kept.
+			/// </summary>
+			struct FractionI32
+			{
+				using value_t = int32_t;
+				static constexpr size_t Lanes = 8;
+
+				static __m256i Truncate(const __m256i product)
+				{
+					// Negative products are biased by (2^30 - 1), so the floor shift rounds towards zero.
+					const __m256i bias = _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), product), _mm256_set1_epi64x((1 << 30) - 1));
+
+					return _mm256_add_epi64(product, bias);
+				}
+
+				static __m256i Apply(const __m256i values, const __m256i scalars)
+				{
+					const __m256i even = Truncate(_mm256_mul_epi32(values, scalars));
+					const __m256i odd = Truncate(_mm256_mul_epi32(_mm256_srli_epi64(values, 32), _mm256_srli_epi64(scalars, 32)));
+
+					return _mm256_blend_epi32(_mm256_srli_epi64(even, 30), _mm256_slli_epi64(odd, 2), 0xAA);
+				}
+			};
+
+			/// <summary>
+			/// Widens 8 16-bit values to 32-bit lanes, zero or sign extended.
+			/// </summary>
+			template<typename T>
+			struct Widen16
+			{
+				static __m256i Apply(const __m128i values)
+				{
+					return _mm256_cvtepu16_epi32(values);
+				}
+			};
+
+			template<>
+			struct Widen16<int16_t>
+			{
+				static __m256i Apply(const __m128i values)
+				{
+					return _mm256_cvtepi16_epi32(values);
+				}
+			};
+
+			/// <summary>
+			/// 16-bit values interpolated by ufraction16_t scalars, in 32-bit lanes.
+			/// Only bits [15 ; 30] of the sum are kept, so unsigned and sign-extended values share the same modular math.
+			/// </summary>
+			template<typename T>
+			struct Interpolate16
+			{
+				static constexpr size_t Lanes = 16;
+
+				static __m256i Half(const __m128i from, const __m128i to, const __m128i scalars)
+				{
+					const __m256i s = _mm256_cvtepu16_epi32(scalars);
+					const __m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(Widen16<T>::Apply(to), s),
+						_mm256_mullo_epi32(Widen16<T>::Apply(from), _mm256_sub_epi32(_mm256_set1_epi32(ScalarFraction::UFraction16::FRACTION_1X), s)));
+
+					return _mm256_and_si256(_mm256_srli_epi32(sum, 15), _mm256_set1_epi32(UINT16_MAX));
+				}
+
+				static __m256i Apply(const T* from, const T* to, const ufraction16_t* scalars)
+				{
+					const __m256i low = Half(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&from[0])),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(&to[0])),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(&scalars[0])));
+					const __m256i high = Half(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&from[8])),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(&to[8])),
+						_mm_loadu_si128(reinterpret_cast<const __m128i*>(&scalars[8])));
+
+					// Pack works per 128-bit lane, restore the element order.
+					return _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0xD8);
+				}
+			};
+
+			template<typename Kernel>
+			static size_t Fraction(const __m256i scalars, const typename Kernel::value_t* values, typename Kernel::value_t* output, const size_t count)
+			{
+				size_t i = 0;
+				const size_t vectorEnd = count - (count % Kernel::Lanes);
+				for (; i < vectorEnd; i += Kernel::Lanes)
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+						Kernel::Apply(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&values[i])), scalars));
+				}
+
+				return i;
+			}
+
+			template<typename Kernel,
+				typename scalar_t>
+			static size_t Fraction(const scalar_t* scalars, const typename Kernel::value_t* values, typename Kernel::value_t* output, const size_t count)
+			{
+				size_t i = 0;
+				const size_t vectorEnd = count - (count % Kernel::Lanes);
+				for (; i < vectorEnd; i += Kernel::Lanes)
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+						Kernel::Apply(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&values[i])),
+							_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&scalars[i]))));
+				}
+
+				return i;
+			}
+
+			template<typename T>
+			static size_t Interpolate(const ufraction16_t* scalars, const size_t scalarStep, const T* from, const T* to, T* output, const size_t count)
+			{
+				size_t i = 0;
+				const size_t vectorEnd = count - (count % Interpolate16<T>::Lanes);
+				for (; i < vectorEnd; i += Interpolate16<T>::Lanes)
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+						Interpolate16<T>::Apply(&from[i], &to[i], &scalars[i * scalarStep]));
+				}
+
+				return i;
+			}
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			static uint16x8_t Load(const uint16_t* source) { return vld1q_u16(source); }
+			static int16x8_t Load(const int16_t* source) { return vld1q_s16(source); }
+			static uint32x4_t Load(const uint32_t* source) { return vld1q_u32(source); }
+			static int32x4_t Load(const int32_t* source) { return vld1q_s32(source); }
+
+			static void Store(uint16_t* target, const uint16x8_t value) { vst1q_u16(target, value); }
+			static void Store(int16_t* target, const int16x8_t value) { vst1q_s16(target, value); }
+			static void Store(uint32_t* target, const uint32x4_t value) { vst1q_u32(target, value); }
+			static void Store(int32_t* target, const int32x4_t value) { vst1q_s32(target, value); }
+
+			/// <summary>
+			/// uint16_t values by ufraction16_t scalars: (value * scalar) >> 15, from the widened 32-bit products.
+			/// </summary>
+			struct FractionU16
+			{
+				using value_t = uint16_t;
+				using scalars_t = uint16x8_t;
+				static constexpr size_t Lanes = 8;
+
+				static uint16x8_t Apply(const uint16x8_t values, const uint16x8_t scalars)
+				{
+					return vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(values), vget_low_u16(scalars)), 15),
+						vshrn_n_u32(vmull_u16(vget_high_u16(values), vget_high_u16(scalars)), 15));
+				}
+			};
+
+			/// <summary>
+			/// int16_t values by ufraction16_t scalars: (value * scalar) >> 15.
+			/// The scalars are zero extended, so the 1X scalar (0x8000) is exact.
+			/// </summary>
+			struct FractionI16U
+			{
+				using value_t = int16_t;
+				using scalars_t = uint16x8_t;
+				static constexpr size_t Lanes = 8;
+
+				static int16x4_t Half(const int16x4_t values, const uint16x4_t scalars)
+				{
+					return vshrn_n_s32(vmulq_s32(vmovl_s16(values), vreinterpretq_s32_u32(vmovl_u16(scalars))), 15);
+				}
+
+				static int16x8_t Apply(const int16x8_t values, const uint16x8_t scalars)
+				{
+					return vcombine_s16(Half(vget_low_s16(values), vget_low_u16(scalars)),
+						Half(vget_high_s16(values), vget_high_u16(scalars)));
+				}
+			};
+
+			/// <summary>
+			/// int16_t values by fraction16_t scalars: (value * scalar) / 2^14, rounded towards zero as SignedRightShift().
+			/// </summary>
+			struct FractionI16
+			{
+				using value_t = int16_t;
+				using scalars_t = int16x8_t;
+				static constexpr size_t Lanes = 8;
+
+				static int16x4_t Half(const int16x4_t values, const int16x4_t scalars)
+				{
+					const int32x4_t product = vmull_s16(values, scalars);
+
+					// Negative products are biased by (2^14 - 1), so the floor shift rounds towards zero.
+					const int32x4_t bias = vandq_s32(vshrq_n_s32(product, 31), vdupq_n_s32((1 << 14) - 1));
+
+					return vshrn_n_s32(vaddq_s32(product, bias), 14);
+				}
+
+				static int16x8_t Apply(const int16x8_t values, const int16x8_t scalars)
+				{
+					return vcombine_s16(Half(vget_low_s16(values), vget_low_s16(scalars)),
+						Half(vget_high_s16(values), vget_high_s16(scalars)));
+				}
+			};
+
+			/// <summary>
+			/// uint32_t values by ufraction32_t scalars: (value * scalar) >> 31, from the widened 64-bit products.
+			/// </summary>
+			struct FractionU32
+			{
+				using value_t = uint32_t;
+				using scalars_t = uint32x4_t;
+				static constexpr size_t Lanes = 4;
+
+				static uint32x4_t Apply(const uint32x4_t values, const uint32x4_t scalars)
+				{
+					return vcombine_u32(vshrn_n_u64(vmull_u32(vget_low_u32(values), vget_low_u32(scalars)), 31),
+						vshrn_n_u64(vmull_u32(vget_high_u32(values), vget_high_u32(scalars)), 31));
+				}
+			};
+
+			/// <summary>
+			/// int32_t values by fraction32_t scalars: (value * scalar) / 2^30, rounded towards zero as SignedRightShift().
+			/// Only the low 32 bits of the shifted 64-bit product are kept.
+			/// </summary>
+			struct FractionI32
+			{
+				using value_t = int32_t;
+				using scalars_t = int32x4_t;
+				static constexpr size_t Lanes = 4;
+
+				static int32x2_t Half(const int32x2_t values, const int32x2_t scalars)
+				{
+					const int64x2_t product = vmull_s32(values, scalars);
+
+					// Negative products are biased by (2^30 - 1), so the floor shift rounds towards zero.
+					const int64x2_t bias = vandq_s64(vshrq_n_s64(product, 63), vdupq_n_s64((1 << 30) - 1));
+
+					return vshrn_n_s64(vaddq_s64(product, bias), 30);
+				}
+
+				static int32x4_t Apply(const int32x4_t values, const int32x4_t scalars)
+				{
+					return vcombine_s32(Half(vget_low_s32(values), vget_low_s32(scalars)),
+						Half(vget_high_s32(values), vget_high_s32(scalars)));
+				}
+			};
+
+			/// <summary>
+			/// Widens 4 16-bit values to 32-bit lanes, zero or sign extended.
+			/// </summary>
+			template<typename T>
+			struct Widen16
+			{
+				static uint32x4_t Apply(const uint16x4_t values)
+				{
+					return vmovl_u16(values);
+				}
+			};
+
+			template<>
+			struct Widen16<int16_t>
+			{
+				static uint32x4_t Apply(const uint16x4_t values)
+				{
+					return vreinterpretq_u32_s32(vmovl_s16(vreinterpret_s16_u16(values)));
+				}
+			};
+
+			/// <summary>
+			/// 16-bit values interpolated by ufraction16_t scalars, in 32-bit lanes.
+			/// Only bits [15 ; 30] of the sum are kept, so unsigned and sign-extended values share the same modular math.
+			/// </summary>
+			template<typename T>
+			struct Interpolate16
+			{
+				static constexpr size_t Lanes = 8;
+
+				static uint16x4_t Half(const uint16x4_t from, const uint16x4_t to, const uint16x4_t scalars)
+				{
+					const uint32x4_t s = vmovl_u16(scalars);
+					const uint32x4_t sum = vmlaq_u32(vmulq_u32(Widen16<T>::Apply(to), s),
+						Widen16<T>::Apply(from), vsubq_u32(vdupq_n_u32(ScalarFraction::UFraction16::FRACTION_1X), s));
+
+					return vshrn_n_u32(sum, 15);
+				}
+
+				static uint16x8_t Apply(const T* from, const T* to, const ufraction16_t* scalars)
+				{
+					const uint16x8_t f = vld1q_u16(reinterpret_cast<const uint16_t*>(from));
+					const uint16x8_t t = vld1q_u16(reinterpret_cast<const uint16_t*>(to));
+					const uint16x8_t s = vld1q_u16(scalars);
+
+					return vcombine_u16(Half(vget_low_u16(f), vget_low_u16(t), vget_low_u16(s)),
+						Half(vget_high_u16(f), vget_high_u16(t), vget_high_u16(s)));
+				}
+			};
+
+			template<typename Kernel>
+			static size_t Fraction(const typename Kernel::scalars_t scalars, const typename Kernel::value_t* values, typename Kernel::value_t* output, const size_t count)
+			{
+				size_t i = 0;
+				const size_t vectorEnd = count - (count % Kernel::Lanes);
+				for (; i < vectorEnd; i += Kernel::Lanes)
+				{
+					Store(&output[i], Kernel::Apply(Load(&values[i]), scalars));
+				}
+
+				return i;
+			}
+
+			template<typename Kernel,
+				typename scalar_t>
+			static size_t Fraction(const scalar_t* scalars, const typename Kernel::value_t* values, typename Kernel::value_t* output, const size_t count)
+			{
+				size_t i = 0;
+				const size_t vectorEnd = count - (count % Kernel::Lanes);
+				for (; i < vectorEnd; i += Kernel::Lanes)
+				{
+					Store(&output[i], Kernel::Apply(Load(&values[i]), Load(&scalars[i])));
+				}
+
+				return i;
+			}
+
+			template<typename T>
+			static size_t Interpolate(const ufraction16_t* scalars, const size_t scalarStep, const T* from, const T* to, T* output, const size_t count)
+			{
+				size_t i = 0;
+				const size_t vectorEnd = count - (count % Interpolate16<T>::Lanes);
+				for (; i < vectorEnd; i += Interpolate16<T>::Lanes)
+				{
+					vst1q_u16(reinterpret_cast<uint16_t*>(&output[i]),
+						Interpolate16<T>::Apply(&from[i], &to[i], &scalars[i * scalarStep]));
+				}
+
+				return i;
+			}
+#endif
+			/// <summary>
+			/// Accelerated prefix of a block, returns the number of elements processed.
+			/// Falls back to none, for the portable loop.
+			/// </summary>
+			template<typename scalar_t,
+				typename T>
+			static size_t FractionPrefix(const scalar_t, const T*, T*, const size_t)
+			{
+				return 0;
+			}
+
+			template<typename scalar_t,
+				typename T>
+			static size_t FractionPrefix(const scalar_t*, const T*, T*, const size_t)
+			{
+				return 0;
+			}
+
+			template<typename scalar_t,
+				typename T>
+			static size_t InterpolatePrefix(const scalar_t, const T*, const T*, T*, const size_t)
+			{
+				return 0;
+			}
+
+			template<typename scalar_t,
+				typename T>
+			static size_t InterpolatePrefix(const scalar_t*, const T*, const T*, T*, const size_t)
+			{
+				return 0;
+			}
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			static size_t FractionPrefix(const ufraction16_t scalar, const uint16_t* values, uint16_t* output, const size_t count)
+			{
+				return Fraction<FractionU16>(_mm256_set1_epi16((int16_t)scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction16_t* scalars, const uint16_t* values, uint16_t* output, const size_t count)
+			{
+				return Fraction<FractionU16>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction16_t scalar, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16U>(_mm256_set1_epi16((int16_t)scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction16_t* scalars, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16U>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction16_t scalar, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16>(_mm256_set1_epi16(scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction16_t* scalars, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction32_t scalar, const uint32_t* values, uint32_t* output, const size_t count)
+			{
+				return Fraction<FractionU32>(_mm256_set1_epi32((int32_t)scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction32_t* scalars, const uint32_t* values, uint32_t* output, const size_t count)
+			{
+				return Fraction<FractionU32>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction32_t scalar, const int32_t* values, int32_t* output, const size_t count)
+			{
+				return Fraction<FractionI32>(_mm256_set1_epi32(scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction32_t* scalars, const int32_t* values, int32_t* output, const size_t count)
+			{
+				return Fraction<FractionI32>(scalars, values, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t scalar, const uint16_t* from, const uint16_t* to, uint16_t* output, const size_t count)
+			{
+				const ufraction16_t scalars[16] = { scalar, scalar, scalar, scalar, scalar, scalar, scalar, scalar,
+					scalar, scalar, scalar, scalar, scalar, scalar, scalar, scalar };
+
+				return Interpolate(scalars, 0, from, to, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t* scalars, const uint16_t* from, const uint16_t* to, uint16_t* output, const size_t count)
+			{
+				return Interpolate(scalars, 1, from, to, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t scalar, const int16_t* from, const int16_t* to, int16_t* output, const size_t count)
+			{
+				const ufraction16_t scalars[16] = { scalar, scalar, scalar, scalar, scalar, scalar, scalar, scalar,
+					scalar, scalar, scalar, scalar, scalar, scalar, scalar, scalar };
+
+				return Interpolate(scalars, 0, from, to, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t* scalars, const int16_t* from, const int16_t* to, int16_t* output, const size_t count)
+			{
+				return Interpolate(scalars, 1, from, to, output, count);
+			}
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+			static size_t FractionPrefix(const ufraction16_t scalar, const uint16_t* values, uint16_t* output, const size_t count)
+			{
+				return Fraction<FractionU16>(vdupq_n_u16(scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction16_t* scalars, const uint16_t* values, uint16_t* output, const size_t count)
+			{
+				return Fraction<FractionU16>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction16_t scalar, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16U>(vdupq_n_u16(scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction16_t* scalars, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16U>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction16_t scalar, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16>(vdupq_n_s16(scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction16_t* scalars, const int16_t* values, int16_t* output, const size_t count)
+			{
+				return Fraction<FractionI16>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction32_t scalar, const uint32_t* values, uint32_t* output, const size_t count)
+			{
+				return Fraction<FractionU32>(vdupq_n_u32(scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const ufraction32_t* scalars, const uint32_t* values, uint32_t* output, const size_t count)
+			{
+				return Fraction<FractionU32>(scalars, values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction32_t scalar, const int32_t* values, int32_t* output, const size_t count)
+			{
+				return Fraction<FractionI32>(vdupq_n_s32(scalar), values, output, count);
+			}
+
+			static size_t FractionPrefix(const fraction32_t* scalars, const int32_t* values, int32_t* output, const size_t count)
+			{
+				return Fraction<FractionI32>(scalars, values, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t scalar, const uint16_t* from, const uint16_t* to, uint16_t* output, const size_t count)
+			{
+				const ufraction16_t scalars[8] = { scalar, scalar, scalar, scalar, scalar, scalar, scalar, scalar };
+
+				return Interpolate(scalars, 0, from, to, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t* scalars, const uint16_t* from, const uint16_t* to, uint16_t* output, const size_t count)
+			{
+				return Interpolate(scalars, 1, from, to, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t scalar, const int16_t* from, const int16_t* to, int16_t* output, const size_t count)
+			{
+				const ufraction16_t scalars[8] = { scalar, scalar, scalar, scalar, scalar, scalar, scalar, scalar };
+
+				return Interpolate(scalars, 0, from, to, output, count);
+			}
+
+			static size_t InterpolatePrefix(const ufraction16_t* scalars, const int16_t* from, const int16_t* to, int16_t* output, const size_t count)
+			{
+				return Interpolate(scalars, 1, from, to, output, count);
+			}
+#endif
+
+			template<typename Format,
+				typename T>
+			static void FractionBlock(const typename Format::scalar_t scalar, const T* values, T* output, const size_t count)
+			{
+				for (size_t i = FractionPrefix(scalar, values, output, count); i < count; i++)
+				{
+					output[i] = Format::Fraction(scalar, values[i]);
+				}
+			}
+
+			template<typename Format,
+				typename T>
+			static void FractionBlock(const typename Format::scalar_t* scalars, const T* values, T* output, const size_t count)
+			{
+				for (size_t i = FractionPrefix(scalars, values, output, count); i < count; i++)
+				{
+					output[i] = Format::Fraction(scalars[i], values[i]);
+				}
+			}
+
+			template<typename Format,
+				typename T>
+			static void InterpolateBlock(const typename Format::scalar_t scalar, const T* from, const T* to, T* output, const size_t count)
+			{
+				for (size_t i = InterpolatePrefix(scalar, from, to, output, count); i < count; i++)
+				{
+					output[i] = Format::Interpolate(scalar, from[i], to[i]);
+				}
+			}
+
+			template<typename Format,
+				typename T>
+			static void InterpolateBlock(const typename Format::scalar_t* scalars, const T* from, const T* to, T* output, const size_t count)
+			{
+				for (size_t i = InterpolatePrefix(scalars, from, to, output, count); i < count; i++)
+				{
+					output[i] = Format::Interpolate(scalars[i], from[i], to[i]);
+				}
+			}
+		}
+
+		namespace ScalarFraction
+		{
+			/// <summary>
+			/// Block overloads of Fraction(), bit-exact with the scalar Fraction() for every element.
+			/// Either a single scalar for the whole block, or one scalar per element.
+			/// Output may alias values.
+			/// On AVX2 and NEON targets, 16-bit and 32-bit values with matching scalars are processed in vector lanes.
+			/// </summary>
+			namespace FractionBlockAliases
+			{
+				template<typename T>
+				static void FractionBlock(const ufraction8_t scalar, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<UFraction8::Base>(scalar, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const ufraction16_t scalar, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<UFraction16::Base>(scalar, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const ufraction32_t scalar, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<UFraction32::Base>(scalar, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const fraction8_t scalar, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<Fraction8::Base>(scalar, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const fraction16_t scalar, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<Fraction16::Base>(scalar, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const fraction32_t scalar, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<Fraction32::Base>(scalar, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const ufraction8_t* scalars, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<UFraction8::Base>(scalars, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const ufraction16_t* scalars, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<UFraction16::Base>(scalars, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const ufraction32_t* scalars, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<UFraction32::Base>(scalars, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const fraction8_t* scalars, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<Fraction8::Base>(scalars, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const fraction16_t* scalars, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<Fraction16::Base>(scalars, values, output, count);
+				}
+
+				template<typename T>
+				static void FractionBlock(const fraction32_t* scalars, const T* values, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::FractionBlock<Fraction32::Base>(scalars, values, output, count);
+				}
+			}
+			using namespace FractionBlockAliases;
+
+			/// <summary>
+			/// Block overloads of Interpolate(), bit-exact with the scalar Interpolate() for every element.
+			/// Either a single scalar for the whole block (e.g. crossfade), or one scalar per element.
+			/// Output may alias from or to.
+			/// On AVX2 and NEON targets, 16-bit values with ufraction16_t scalars are processed in vector lanes.
+			/// </summary>
+			namespace InterpolateBlockAliases
+			{
+				template<typename T>
+				static void InterpolateBlock(const ufraction8_t scalar, const T* from, const T* to, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::InterpolateBlock<UFraction8::Base>(scalar, from, to, output, count);
+				}
+
+				template<typename T>
+				static void InterpolateBlock(const ufraction16_t scalar, const T* from, const T* to, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::InterpolateBlock<UFraction16::Base>(scalar, from, to, output, count);
+				}
+
+				template<typename T>
+				static void InterpolateBlock(const ufraction32_t scalar, const T* from, const T* to, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::InterpolateBlock<UFraction32::Base>(scalar, from, to, output, count);
+				}
+
+				template<typename T>
+				static void InterpolateBlock(const ufraction8_t* scalars, const T* from, const T* to, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::InterpolateBlock<UFraction8::Base>(scalars, from, to, output, count);
+				}
+
+				template<typename T>
+				static void InterpolateBlock(const ufraction16_t* scalars, const T* from, const T* to, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::InterpolateBlock<UFraction16::Base>(scalars, from, to, output, count);
+				}
+
+				template<typename T>
+				static void InterpolateBlock(const ufraction32_t* scalars, const T* from, const T* to, T* output, const size_t count)
+				{
+					ScalarFractionBlocks::InterpolateBlock<UFraction32::Base>(scalars, from, to, output, count);
+				}
+			}
+			using namespace InterpolateBlockAliases;
+		}
+	}
+}
+#endif
@@ -11,14 +11,18 @@
 #include "Base/Convert.h"
 #include "Base/Mix.h"
 #include "Base/SquareRoot.h"
+#include "Base/SquareRootBatch.h"
 
 #include "FixedPoint/ScalarFraction.h"
+#include "FixedPoint/ScalarFractionBlock.h"
 #include "FixedPoint/FactorScale.h"
 
 
 #include "Color/Rgb8.h"
+#include "Color/Rgb8Block.h"
 #include "Color/Rgb10.h"
 #include "Color/RgbFraction16.h"
+#include "Color/HsvBlock.h"
 
 #include "Curve/ICurve.h"
 #include "Curve/Signed.h"
@@ -34,5 +38,14 @@
 #include "Filter/LowPass.h"
 #include "Filter/Ema.h"
 #include "Filter/Dema.h"
+#include "Filter/MovingAverage.h"
+#include "Filter/Median.h"
+#include "Filter/Fir.h"
+#include "Filter/Biquad.h"
+#include "Filter/Cic.h"
+#include "Filter/FilterBank.h"
+#include "Filter/Pipeline.h"
+
+#include "Stream/SpscRing.h"
 
 #endif
\ No newline at end of file
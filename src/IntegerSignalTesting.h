@@ -5,5 +5,11 @@
 #include "Testing/Testing.h"
 
 #include "Trigonometry/Lut/Generator.h"
+#include "Trigonometry/Lut/TableGenerator.h"
+
+// The Hermite Sine32 LUT is generated at compile time, with C++14.
+#if (__cplusplus >= 201402L)
+#include "Trigonometry/Lut/Sine32Lut.h"
+#endif
 
 #endif
\ No newline at end of file
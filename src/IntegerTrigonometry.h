@@ -1,8 +1,12 @@
 #ifndef _INTEGER_TRIGONOMETRY_INCLUDE_h
 #define _INTEGER_TRIGONOMETRY_INCLUDE_h
 
+#include "FixedPoint/ScalarFraction.h"
+
 #include "Trigonometry/Trigonometry.h"
+#include "Trigonometry/ArcTangent.h"
+#include "Trigonometry/Polynomial.h"
 
 
 
-#endif
\ No newline at end of file
+#endif
@@ -5,9 +5,18 @@
 
 #include "Trigonometry/Trigonometry.h"
 #include "Trigonometry/Sine16.h"
+#include "Trigonometry/Sine16Batch.h"
 #include "Trigonometry/Tangent16.h"
+#include "Trigonometry/ArcTangent16.h"
+#include "Trigonometry/ArcSine16.h"
 
 #include "Trigonometry/Sine32.h"
 #include "Trigonometry/Tangent32.h"
+#include "Trigonometry/Rotate.h"
+
+#include "Trigonometry/Nco.h"
+
+#include "Spectrum/Fft.h"
+#include "Spectrum/Goertzel.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,371 @@
+#ifndef _INTEGER_SIGNAL_SPECTRUM_FFT_h
+#define _INTEGER_SIGNAL_SPECTRUM_FFT_h
+
+#include "../Trigonometry/Sine16.h"
+#include "../Trigonometry/Sine32.h"
+
+namespace IntegerSignal
+{
+	namespace Spectrum
+	{
+		namespace Fft
+		{
+			using namespace FixedPoint::ScalarFraction;
+
+			namespace Template
+			{
+				/// <summary>
+				/// Twiddle sources, W_N^k = Cosine(k) - j * Sine(k), from the Sine16/Sine32 LUTs.
+				/// </summary>
+				template<typename value_t>
+				struct Twiddle;
+
+				template<>
+				struct Twiddle<int16_t>
+				{
+					using Format = Fraction16;
+
+					static int16_t Cosine(const Trigonometry::angle_t angle) { return Trigonometry::Cosine16(angle); }
+					static int16_t Sine(const Trigonometry::angle_t angle) { return Trigonometry::Sine16(angle); }
+				};
+
+				template<>
+				struct Twiddle<int32_t>
+				{
+					using Format = Fraction32;
+
+					static int32_t Cosine(const Trigonometry::angle_t angle) { return Trigonometry::Cosine32(angle); }
+					static int32_t Sine(const Trigonometry::angle_t angle) { return Trigonometry::Sine32(angle); }
+				};
+
+				/// <summary>
+				/// In-place complex radix-2 FFT/IFFT with block floating-point scaling.
+				/// Data is interleaved complex, { re[0], im[0], re[1], im[1], ... }.
+				/// Before every stage, the largest magnitude decides a right shift of 0, 1 or 2 bits for that stage,
+				/// so the butterflies never overflow. The shifts are returned as a block exponent.
+				/// Each butterfly output is rounded once, from the full accumulator.
+				/// </summary>
+				/// <typeparam name="value_t">Signed sample type (int16_t with Q0.14 twiddles, int32_t with Q0.30 twiddles).</typeparam>
+				/// <typeparam name="accumulator_t">Signed accumulator, twice the width of value_t.</typeparam>
+				/// <typeparam name="size">Power-of-two number of twiddles source points [64 ; 16384].</typeparam>
+				template<typename value_t,
+					typename accumulator_t,
+					uint16_t size>
+				class AbstractTransform
+				{
+				protected:
+					using Format = typename Twiddle<value_t>::Format;
+					using limits = TypeTraits::TypeLimits::type_limits<value_t>;
+
+					static constexpr uint8_t Shifts = GetBitShifts(Format::FRACTION_1X);
+					static constexpr uint8_t SizeShifts = GetBitShifts(size);
+					static constexpr uint16_t AngleStep = uint16_t(((uint32_t)Trigonometry::ANGLE_RANGE + 1) >> SizeShifts);
+
+					static_assert(sizeof(accumulator_t) >= 2 * sizeof(value_t), "Fft requires a widened accumulator");
+					static_assert(size >= 64 && size <= 16384 && (size & (size - 1)) == 0, "Fft requires a power-of-two size in [64 ; 16384]");
+
+				protected:
+					/// <summary>
+					/// W_size^k for k in [0 ; size / 2[, interleaved { cos, -sin }.
+					/// </summary>
+					value_t Twiddles[size]{};
+
+				public:
+					AbstractTransform()
+					{
+						for (uint16_t k = 0; k < size / 2; k++)
+						{
+							const Trigonometry::angle_t angle = Trigonometry::angle_t(k * AngleStep);
+							Twiddles[2 * k] = Unit(Twiddle<value_t>::Cosine(angle));
+							Twiddles[(2 * k) + 1] = -Unit(Twiddle<value_t>::Sine(angle));
+						}
+					}
+
+				private:
+					/// <summary>
+					/// Sine32 peaks slightly above FRACTION_1X, the butterfly headroom assumes |W| <= 1.
+					/// </summary>
+					static value_t Unit(const value_t value)
+					{
+						return (value > (value_t)Format::FRACTION_1X) ? (value_t)Format::FRACTION_1X
+							: ((value < -(value_t)Format::FRACTION_1X) ? -(value_t)Format::FRACTION_1X : value);
+					}
+
+				protected:
+					/// <summary>
+					/// Sign-symmetric rounding right shift.
+					/// </summary>
+					static value_t Round(const accumulator_t value, const uint8_t shifts)
+					{
+						const accumulator_t half = accumulator_t(1) << (shifts - 1);
+
+						return (value >= 0) ? value_t((value + half) >> shifts)
+							: value_t(-((-value + half) >> shifts));
+					}
+
+					static accumulator_t Abs(const value_t value)
+					{
+						return (value < 0) ? -(accumulator_t)value : (accumulator_t)value;
+					}
+
+					static accumulator_t GetMaxMagnitude(const value_t* data, const uint32_t count)
+					{
+						accumulator_t magnitude = 0;
+						for (uint32_t i = 0; i < count; i++)
+						{
+							const accumulator_t value = Abs(data[i]);
+							magnitude = (value > magnitude) ? value : magnitude;
+						}
+
+						return magnitude;
+					}
+
+					/// <summary>
+					/// Stage shift for a component magnitude, a butterfly grows it by up to 1 + sqrt(2) < 5/2.
+					/// </summary>
+					static uint8_t GetStageShifts(const accumulator_t magnitude)
+					{
+						uint8_t shifts = 0;
+						while ((((5 * magnitude) >> (shifts + 1)) + 1) > limits::Max())
+						{
+							shifts++;
+						}
+
+						return shifts;
+					}
+
+					/// <summary>
+					/// Complex FFT of count points, with twiddles W_count^k = Twiddles[k * stride].
+					/// </summary>
+					/// <param name="data">Interleaved complex data, 2 * count values.</param>
+					/// <param name="count">Power-of-two number of complex points.</param>
+					/// <param name="stride">Twiddle table stride, size / count.</param>
+					/// <param name="inverse">Use conjugate twiddles.</param>
+					/// <returns>Total right shifts applied.</returns>
+					uint8_t Run(value_t* data, const uint16_t count, const uint16_t stride, const bool inverse) const
+					{
+						// Bit-reversal permutation.
+						for (uint16_t i = 0, j = 0; i < count; i++)
+						{
+							if (i < j)
+							{
+								const value_t real = data[2 * i];
+								const value_t imaginary = data[(2 * i) + 1];
+								data[2 * i] = data[2 * j];
+								data[(2 * i) + 1] = data[(2 * j) + 1];
+								data[2 * j] = real;
+								data[(2 * j) + 1] = imaginary;
+							}
+
+							uint16_t bit = count >> 1;
+							while (bit > 0 && (j & bit))
+							{
+								j ^= bit;
+								bit >>= 1;
+							}
+							j |= bit;
+						}
+
+						uint8_t exponent = 0;
+						accumulator_t magnitude = GetMaxMagnitude(data, (uint32_t)count * 2);
+
+						for (uint16_t half = 1; half < count; half <<= 1)
+						{
+							const uint8_t stageShifts = GetStageShifts(magnitude);
+							const uint8_t outputShifts = Shifts + stageShifts;
+							const uint16_t twiddleStep = (uint16_t)(stride * (count / (2 * half)));
+							exponent += stageShifts;
+							magnitude = 0;
+
+							for (uint16_t k = 0; k < half; k++)
+							{
+								const accumulator_t wr = Twiddles[2 * k * twiddleStep];
+								const accumulator_t wi = inverse ? -(accumulator_t)Twiddles[(2 * k * twiddleStep) + 1] : (accumulator_t)Twiddles[(2 * k * twiddleStep) + 1];
+
+								for (uint32_t i = k; i < count; i += 2 * half)
+								{
+									value_t* a = &data[2 * i];
+									value_t* b = &data[2 * (i + half)];
+
+									const accumulator_t tr = (wr * b[0]) - (wi * b[1]);
+									const accumulator_t ti = (wr * b[1]) + (wi * b[0]);
+									const accumulator_t ar = (accumulator_t)a[0] * Format::FRACTION_1X;
+									const accumulator_t ai = (accumulator_t)a[1] * Format::FRACTION_1X;
+
+									a[0] = Round(ar + tr, outputShifts);
+									a[1] = Round(ai + ti, outputShifts);
+									b[0] = Round(ar - tr, outputShifts);
+									b[1] = Round(ai - ti, outputShifts);
+
+									const accumulator_t m0 = (Abs(a[0]) > Abs(a[1])) ? Abs(a[0]) : Abs(a[1]);
+									const accumulator_t m1 = (Abs(b[0]) > Abs(b[1])) ? Abs(b[0]) : Abs(b[1]);
+									magnitude = (m0 > magnitude) ? m0 : magnitude;
+									magnitude = (m1 > magnitude) ? m1 : magnitude;
+								}
+							}
+						}
+
+						return exponent;
+					}
+				};
+
+				/// <summary>
+				/// In-place complex FFT/IFFT of size points.
+				/// </summary>
+				template<typename value_t,
+					typename accumulator_t,
+					uint16_t size>
+				class ComplexTransform : public AbstractTransform<value_t, accumulator_t, size>
+				{
+				private:
+					using Base = AbstractTransform<value_t, accumulator_t, size>;
+
+				public:
+					static constexpr uint16_t Size = size;
+
+				public:
+					ComplexTransform() : Base() {}
+
+					/// <summary>
+					/// Forward transform, X[k] = sum(x[n] * W^(nk)).
+					/// </summary>
+					/// <param name="data">Interleaved complex data, 2 * Size values, replaced by the spectrum.</param>
+					/// <returns>Block exponent e [0 ; 2 * log2(Size)], X[k] = data[k] * 2^e.</returns>
+					int8_t Forward(value_t* data) const
+					{
+						return (int8_t)Base::Run(data, size, 1, false);
+					}
+
+					/// <summary>
+					/// Inverse transform, x[n] = sum(X[k] * W^(-nk)) / Size.
+					/// </summary>
+					/// <param name="data">Interleaved complex spectrum, 2 * Size values, replaced by the signal.</param>
+					/// <returns>Block exponent e, x[n] = data[n] * 2^e, negative for the 1 / Size scale.</returns>
+					int8_t Inverse(value_t* data) const
+					{
+						return (int8_t)Base::Run(data, size, 1, true) - (int8_t)Base::SizeShifts;
+					}
+				};
+
+				/// <summary>
+				/// In-place real-input FFT of size points, through a complex FFT of size / 2 points.
+				/// The output is packed in the size input values:
+				/// { X[0], X[size/2], re X[1], im X[1], ... re X[size/2 - 1], im X[size/2 - 1] },
+				/// the remaining bins are the complex conjugates, X[size - k] = conj(X[k]).
+				/// </summary>
+				template<typename value_t,
+					typename accumulator_t,
+					uint16_t size>
+				class RealTransform : public AbstractTransform<value_t, accumulator_t, size>
+				{
+				private:
+					using Base = AbstractTransform<value_t, accumulator_t, size>;
+					using Format = typename Base::Format;
+					using Base::Twiddles;
+					using Base::Round;
+
+					static constexpr uint16_t Half = size / 2;
+
+				public:
+					static constexpr uint16_t Size = size;
+
+				public:
+					RealTransform() : Base() {}
+
+					/// <summary>
+					/// Forward transform of real samples.
+					/// </summary>
+					/// <param name="data">Size real samples, replaced by the packed spectrum.</param>
+					/// <returns>Block exponent e, X[k] = data[k] * 2^e.</returns>
+					int8_t Forward(value_t* data) const
+					{
+						// Even and odd samples as the real and imaginary parts of Z, size / 2 points.
+						uint8_t exponent = Base::Run(data, Half, 2, false);
+
+						// Split needs one extra bit of headroom in the accumulator.
+						accumulator_t magnitude = Base::GetMaxMagnitude(data, size);
+						if (magnitude > (Base::limits::Max() >> 1))
+						{
+							for (uint16_t i = 0; i < size; i++)
+							{
+								data[i] = Round(data[i], 1);
+							}
+							magnitude = (magnitude + 1) >> 1;
+							exponent++;
+						}
+
+						const uint8_t stageShifts = Base::GetStageShifts(magnitude);
+						const uint8_t outputShifts = Base::Shifts + 1 + stageShifts;
+						exponent += stageShifts;
+
+						// X[0] and X[size / 2] are real, from Z[0].
+						const accumulator_t z0r = data[0];
+						const accumulator_t z0i = data[1];
+						data[0] = Round((z0r + z0i) * 2 * Format::FRACTION_1X, outputShifts);
+						data[1] = Round((z0r - z0i) * 2 * Format::FRACTION_1X, outputShifts);
+
+						// X[k] = ((Z[k] + conj(Z[M-k])) - j * W^k * (Z[k] - conj(Z[M-k]))) / 2, with M = size / 2.
+						for (uint16_t k = 1; k <= Half / 2; k++)
+						{
+							const uint16_t m = Half - k;
+							const value_t ar = data[2 * k];
+							const value_t ai = data[(2 * k) + 1];
+							const value_t br = data[2 * m];
+							const value_t bi = data[(2 * m) + 1];
+
+							Split(&data[2 * k], ar, ai, br, bi, k, outputShifts);
+							if (m != k)
+							{
+								Split(&data[2 * m], br, bi, ar, ai, m, outputShifts);
+							}
+						}
+
+						return (int8_t)exponent;
+					}
+
+				private:
+					void Split(value_t* x, const accumulator_t ar, const accumulator_t ai, const accumulator_t br, const accumulator_t bi,
+						const uint16_t k, const uint8_t outputShifts) const
+					{
+						const accumulator_t wr = Twiddles[2 * k];
+						const accumulator_t wi = Twiddles[(2 * k) + 1];
+						const accumulator_t dr = ai + bi;
+						const accumulator_t di = br - ar;
+
+						x[0] = Round(((ar + br) * Format::FRACTION_1X) + (wr * dr) - (wi * di), outputShifts);
+						x[1] = Round(((ai - bi) * Format::FRACTION_1X) + (wr * di) + (wi * dr), outputShifts);
+					}
+				};
+			}
+		}
+
+		/// <summary>
+		/// Complex FFT (signed 16 bit), Q0.14 twiddles.
+		/// </summary>
+		/// <typeparam name="Size">Power of two [64 ; 16384]</typeparam>
+		template<uint16_t Size>
+		using FftI16 = Fft::Template::ComplexTransform<int16_t, int32_t, Size>;
+
+		/// <summary>
+		/// Complex FFT (signed 32 bit), Q0.30 twiddles.
+		/// </summary>
+		/// <typeparam name="Size">Power of two [64 ; 16384]</typeparam>
+		template<uint16_t Size>
+		using FftI32 = Fft::Template::ComplexTransform<int32_t, int64_t, Size>;
+
+		/// <summary>
+		/// Real-input FFT (signed 16 bit), Q0.14 twiddles.
+		/// </summary>
+		/// <typeparam name="Size">Power of two [64 ; 16384]</typeparam>
+		template<uint16_t Size>
+		using RealFftI16 = Fft::Template::RealTransform<int16_t, int32_t, Size>;
+
+		/// <summary>
+		/// Real-input FFT (signed 32 bit), Q0.30 twiddles.
+		/// </summary>
+		/// <typeparam name="Size">Power of two [64 ; 16384]</typeparam>
+		template<uint16_t Size>
+		using RealFftI32 = Fft::Template::RealTransform<int32_t, int64_t, Size>;
+	}
+}
+#endif
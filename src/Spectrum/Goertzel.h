@@ -0,0 +1,383 @@
+#ifndef _INTEGER_SIGNAL_SPECTRUM_GOERTZEL_h
+#define _INTEGER_SIGNAL_SPECTRUM_GOERTZEL_h
+
+#include "../Trigonometry/Trigonometry.h"
+#include "../Trigonometry/Lut/TableGenerator.h"
+
+namespace IntegerSignal
+{
+	namespace Spectrum
+	{
+		namespace Goertzel
+		{
+			using namespace FixedPoint::ScalarFraction;
+
+			/// <summary>
+			/// Calculates the angle per sample of a frequency, for SetAngle().
+			/// The k-th bin of an N-point DFT is GetAngle(k, N).
+			/// </summary>
+			/// <param name="frequency">Bin frequency [0 ; sampleRate/2].</param>
+			/// <param name="sampleRate">Sample rate, in the same units as frequency.</param>
+			/// <returns>Rounded angle per sample, 0 if sampleRate is 0.</returns>
+			static constexpr Trigonometry::angle_t GetAngle(const uint32_t frequency, const uint32_t sampleRate)
+			{
+				return (sampleRate == 0) ? 0
+					: Trigonometry::angle_t(((((uint64_t)frequency << 16) << 1) / sampleRate + 1) >> 1);
+			}
+
+			/// <summary>
+			/// Cosine and sine of an angle in Q0.30, from the integer Taylor series of Lut::TableGenerator.
+			/// The resonance frequency moves by the coefficient error / (2 * sin(w)),
+			/// so low bins need more than the LUT interpolation accuracy.
+			/// </summary>
+			/// <param name="angle">Angle per sample.</param>
+			/// <param name="cosine">cos(angle) in [-Fraction32::FRACTION_1X ; Fraction32::FRACTION_1X].</param>
+			/// <param name="sine">sin(angle) in [-Fraction32::FRACTION_1X ; Fraction32::FRACTION_1X].</param>
+			static void GetCoefficients(const Trigonometry::angle_t angle, Fraction32::scalar_t& cosine, Fraction32::scalar_t& sine)
+			{
+				using namespace Trigonometry::Lut;
+
+				static constexpr uint8_t QuadrantShifts = 14;
+				static constexpr uint8_t Shifts = TableGenerator::Q62Shifts - GetBitShifts(Fraction32::FRACTION_1X);
+
+				const uint16_t index = angle & ((uint16_t(1) << QuadrantShifts) - 1);
+				const TableGenerator::q62_t x = TableGenerator::GetStepAngle(TableGenerator::HalfPi, index, QuadrantShifts);
+				const Fraction32::scalar_t c = Fraction32::scalar_t((TableGenerator::Cosine(x) + (TableGenerator::q62_t(1) << (Shifts - 1))) >> Shifts);
+				const Fraction32::scalar_t s = Fraction32::scalar_t((TableGenerator::Sine(x) + (TableGenerator::q62_t(1) << (Shifts - 1))) >> Shifts);
+
+				switch (angle >> QuadrantShifts)
+				{
+				case 0:
+					cosine = c;
+					sine = s;
+					break;
+				case 1:
+					cosine = -s;
+					sine = c;
+					break;
+				case 2:
+					cosine = -c;
+					sine = -s;
+					break;
+				default:
+					cosine = s;
+					sine = -c;
+					break;
+				}
+			}
+
+			namespace Template
+			{
+				/// <summary>
+				/// Goertzel resonator, s[n] = x[n] + 2cos(w) * s[n-1] - s[n-2], over a 64 bit state with Q0.30 coefficients.
+				/// The coefficient product is split over the high and low parts of s[n-1],
+				/// so it never exceeds the state width, and the truncated fraction is fed back (fraction saving).
+				/// </summary>
+				template<typename value_t>
+				struct Resonator
+				{
+					using Format = Fraction32;
+					using state_t = int64_t;
+
+					static constexpr uint8_t Shifts = GetBitShifts(Format::FRACTION_1X);
+
+					/// <summary>
+					/// Power is calculated from components shifted right by PowerShifts, so it fits in 64 bits.
+					/// </summary>
+					static constexpr uint8_t PowerShifts = (sizeof(value_t) - sizeof(int16_t)) * 8;
+
+					static_assert(sizeof(value_t) == 2 || sizeof(value_t) == 4, "Goertzel requires int16_t or int32_t samples");
+
+					/// <summary>
+					/// (coefficient * value) >> Shifts, with the truncated fraction accumulated in error.
+					/// </summary>
+					static state_t Multiply(const state_t coefficient, const state_t value, state_t& error)
+					{
+						const state_t high = SignedRightShift<state_t, Shifts>(value);
+						const state_t low = value - (high * Format::FRACTION_1X);
+						const state_t sum = error + (coefficient * low);
+						const state_t fraction = SignedRightShift<state_t, Shifts>(sum);
+						error = sum - (fraction * Format::FRACTION_1X);
+
+						return (coefficient * high) + fraction;
+					}
+
+					static void Step(const value_t value, const state_t coefficient, state_t& s1, state_t& s2, state_t& error)
+					{
+						const state_t s0 = value + Multiply(coefficient, s1, error) - s2;
+						s2 = s1;
+						s1 = s0;
+					}
+
+					/// <summary>
+					/// X = s[N-1] - W^-1 * s[N-2], the DFT bin up to a phase rotation.
+					/// </summary>
+					static void GetComponents(const state_t cosine, const state_t sine, const state_t s1, const state_t s2,
+						state_t& real, state_t& imaginary)
+					{
+						state_t error = 0;
+						real = s1 - Multiply(cosine, s2, error);
+						error = 0;
+						imaginary = Multiply(sine, s2, error);
+					}
+
+					static uint64_t GetPower(const state_t real, const state_t imaginary)
+					{
+						const uint64_t re = (uint64_t)((real < 0) ? -real : real) >> PowerShifts;
+						const uint64_t im = (uint64_t)((imaginary < 0) ? -imaginary : imaginary) >> PowerShifts;
+
+						return (re * re) + (im * im);
+					}
+				};
+
+				/// <summary>
+				/// Single-bin DFT (Goertzel algorithm), O(1) work per sample.
+				/// Clear(), push the N samples of a block, then read the bin with GetComponents() or GetPower().
+				/// Blocks of up to 65536 full-scale samples fit the state and the power.
+				/// </summary>
+				/// <typeparam name="value_t">Signed sample type (int16_t or int32_t).</typeparam>
+				template<typename value_t>
+				class Detector
+				{
+				private:
+					using Kernel = Resonator<value_t>;
+
+				public:
+					using state_t = typename Kernel::state_t;
+
+					static constexpr uint8_t PowerShifts = Kernel::PowerShifts;
+
+				private:
+					state_t Coefficient = 2 * (state_t)Kernel::Format::FRACTION_1X;
+					state_t Cosine = Kernel::Format::FRACTION_1X;
+					state_t Sine = 0;
+
+					state_t S1 = 0;
+					state_t S2 = 0;
+					state_t Error = 0;
+
+				public:
+					Detector() {}
+
+					Detector(const Trigonometry::angle_t angle)
+					{
+						SetAngle(angle);
+					}
+
+					/// <summary>
+					/// Sets the bin frequency, does not clear the state.
+					/// </summary>
+					/// <param name="angle">Angle per sample, see Goertzel::GetAngle().</param>
+					void SetAngle(const Trigonometry::angle_t angle)
+					{
+						Fraction32::scalar_t cosine, sine;
+						GetCoefficients(angle, cosine, sine);
+						Cosine = cosine;
+						Sine = sine;
+						Coefficient = 2 * Cosine;
+					}
+
+					void SetFrequency(const uint32_t frequency, const uint32_t sampleRate)
+					{
+						SetAngle(GetAngle(frequency, sampleRate));
+					}
+
+					void Clear()
+					{
+						S1 = 0;
+						S2 = 0;
+						Error = 0;
+					}
+
+					void Push(const value_t value)
+					{
+						Kernel::Step(value, Coefficient, S1, S2, Error);
+					}
+
+					void ProcessBlock(const value_t* input, const size_t count)
+					{
+						state_t s1 = S1;
+						state_t s2 = S2;
+						state_t error = Error;
+						for (size_t i = 0; i < count; i++)
+						{
+							Kernel::Step(input[i], Coefficient, s1, s2, error);
+						}
+						S1 = s1;
+						S2 = s2;
+						Error = error;
+					}
+
+					/// <summary>
+					/// DFT bin of the samples pushed since Clear(), |X| = |sum(x[n] * W^(nk))|.
+					/// </summary>
+					void GetComponents(state_t& real, state_t& imaginary) const
+					{
+						Kernel::GetComponents(Cosine, Sine, S1, S2, real, imaginary);
+					}
+
+					/// <summary>
+					/// |X|^2 / 2^(2 * PowerShifts).
+					/// </summary>
+					uint64_t GetPower() const
+					{
+						state_t real, imaginary;
+						GetComponents(real, imaginary);
+
+						return Kernel::GetPower(real, imaginary);
+					}
+				};
+
+				/// <summary>
+				/// Bank of Goertzel bins evaluated in one pass over the same block.
+				/// Each sample is read once and fed to every bin, the bin states stay in contiguous arrays.
+				/// Bit-exact with one Detector per bin.
+				/// </summary>
+				/// <typeparam name="value_t">Signed sample type (int16_t or int32_t).</typeparam>
+				/// <typeparam name="bins">Number of bins [1 ; 255].</typeparam>
+				template<typename value_t,
+					uint8_t bins>
+				class DetectorBank
+				{
+				private:
+					using Kernel = Resonator<value_t>;
+
+				public:
+					using state_t = typename Kernel::state_t;
+
+					static constexpr uint8_t Bins = bins;
+					static constexpr uint8_t PowerShifts = Kernel::PowerShifts;
+
+					static_assert(bins >= 1, "DetectorBank requires at least one bin");
+
+				private:
+					state_t Coefficient[bins]{};
+					state_t Cosine[bins]{};
+					state_t Sine[bins]{};
+
+					state_t S1[bins]{};
+					state_t S2[bins]{};
+					state_t Error[bins]{};
+
+				public:
+					DetectorBank()
+					{
+						for (uint8_t i = 0; i < bins; i++)
+						{
+							SetAngle(i, 0);
+						}
+					}
+
+					/// <summary>
+					/// Sets the frequency of a bin, does not clear the state.
+					/// </summary>
+					/// <param name="bin">Bin index [0 ; Bins[.</param>
+					/// <param name="angle">Angle per sample, see Goertzel::GetAngle().</param>
+					void SetAngle(const uint8_t bin, const Trigonometry::angle_t angle)
+					{
+						if (bin < bins)
+						{
+							Fraction32::scalar_t cosine, sine;
+							GetCoefficients(angle, cosine, sine);
+							Cosine[bin] = cosine;
+							Sine[bin] = sine;
+							Coefficient[bin] = 2 * Cosine[bin];
+						}
+					}
+
+					void SetFrequency(const uint8_t bin, const uint32_t frequency, const uint32_t sampleRate)
+					{
+						SetAngle(bin, GetAngle(frequency, sampleRate));
+					}
+
+					void Clear()
+					{
+						for (uint8_t i = 0; i < bins; i++)
+						{
+							S1[i] = 0;
+							S2[i] = 0;
+							Error[i] = 0;
+						}
+					}
+
+					void Push(const value_t value)
+					{
+						for (uint8_t i = 0; i < bins; i++)
+						{
+							Kernel::Step(value, Coefficient[i], S1[i], S2[i], Error[i]);
+						}
+					}
+
+					void ProcessBlock(const value_t* input, const size_t count)
+					{
+						for (size_t n = 0; n < count; n++)
+						{
+							Push(input[n]);
+						}
+					}
+
+					void GetComponents(const uint8_t bin, state_t& real, state_t& imaginary) const
+					{
+						if (bin < bins)
+						{
+							Kernel::GetComponents(Cosine[bin], Sine[bin], S1[bin], S2[bin], real, imaginary);
+						}
+						else
+						{
+							real = 0;
+							imaginary = 0;
+						}
+					}
+
+					/// <summary>
+					/// |X|^2 / 2^(2 * PowerShifts) of a bin.
+					/// </summary>
+					uint64_t GetPower(const uint8_t bin) const
+					{
+						state_t real, imaginary;
+						GetComponents(bin, real, imaginary);
+
+						return Kernel::GetPower(real, imaginary);
+					}
+
+					/// <summary>
+					/// Power of every bin.
+					/// </summary>
+					/// <param name="power">Bins power values.</param>
+					void GetPower(uint64_t* power) const
+					{
+						for (uint8_t i = 0; i < bins; i++)
+						{
+							power[i] = GetPower(i);
+						}
+					}
+				};
+			}
+		}
+
+		/// <summary>
+		/// Goertzel single-bin detector (signed 16 bit).
+		/// </summary>
+		using GoertzelI16 = Goertzel::Template::Detector<int16_t>;
+
+		/// <summary>
+		/// Goertzel single-bin detector (signed 32 bit).
+		/// </summary>
+		using GoertzelI32 = Goertzel::Template::Detector<int32_t>;
+
+		/// <summary>
+		/// Goertzel detector bank (signed 16 bit).
+		/// </summary>
+		/// <typeparam name="Bins">[1 ; 255]</typeparam>
+		template<uint8_t Bins>
+		using GoertzelBankI16 = Goertzel::Template::DetectorBank<int16_t, Bins>;
+
+		/// <summary>
+		/// Goertzel detector bank (signed 32 bit).
+		/// </summary>
+		/// <typeparam name="Bins">[1 ; 255]</typeparam>
+		template<uint8_t Bins>
+		using GoertzelBankI32 = Goertzel::Template::DetectorBank<int32_t, Bins>;
+	}
+}
+#endif
@@ -0,0 +1,280 @@
+// SpscRing.h
+
+#ifndef _INTEGER_SIGNAL_SPSC_RING_h
+#define _INTEGER_SIGNAL_SPSC_RING_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../Base/TypeTraits.h"
+
+#if !defined(__AVR__)
+#include <atomic>
+#endif
+
+namespace IntegerSignal
+{
+	namespace Stream
+	{
+		namespace Template
+		{
+#if defined(__AVR__)
+			/// <summary>
+			/// Ring index shared between producer and consumer.
+			/// Single core: 8-bit accesses are atomic, ordering only needs a compiler barrier.
+			/// </summary>
+			template<typename index_t>
+			class SharedIndex
+			{
+			private:
+				volatile index_t Value = 0;
+
+			public:
+				index_t Load() const
+				{
+					const index_t value = Value;
+					asm volatile("" ::: "memory");
+					return value;
+				}
+
+				void Store(const index_t value)
+				{
+					asm volatile("" ::: "memory");
+					Value = value;
+				}
+			};
+#else
+			/// <summary>
+			/// Ring index shared between producer and consumer.
+			/// Acquire/release ordering publishes the samples written before the index update.
+			/// </summary>
+			template<typename index_t>
+			class SharedIndex
+			{
+			private:
+				std::atomic<index_t> Value{ 0 };
+
+			public:
+				index_t Load() const
+				{
+					return Value.load(std::memory_order_acquire);
+				}
+
+				void Store(const index_t value)
+				{
+					Value.store(value, std::memory_order_release);
+				}
+			};
+#endif
+		}
+
+		/// <summary>
+		/// Lock-free, allocation-free single-producer/single-consumer sample ring.
+		/// The producer (e.g. ADC interrupt) only calls Push() and GetFree(),
+		/// the consumer (processing loop) only calls Pop(), Process(), GetCount() and Clear().
+		/// Indices are free-running, so all capacity slots are usable.
+		/// </summary>
+		/// <typeparam name="value_t">Sample type.</typeparam>
+		/// <typeparam name="capacity">Power of two, [2 ; 128] on AVR (atomic 8-bit indices), [2 ; 32768] otherwise.</typeparam>
+		template<typename value_t,
+			uint16_t capacity>
+		class SpscRing
+		{
+		public:
+			static constexpr uint16_t Capacity = capacity;
+
+			static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0, "SpscRing capacity must be a power of two.");
+#if defined(__AVR__)
+			static_assert(capacity <= 128, "SpscRing capacity is limited to 128 on AVR.");
+#else
+			static_assert(capacity <= 32768, "SpscRing capacity is limited to 32768.");
+#endif
+
+		private:
+			using index_t = typename TypeTraits::TypeConditional::conditional_type<uint8_t, uint16_t, (capacity <= 128)>::type;
+
+			static constexpr index_t Mask = capacity - 1;
+
+		private:
+			value_t Buffer[capacity]{};
+
+			/// <summary>
+			/// Written by the producer only.
+			/// </summary>
+			Template::SharedIndex<index_t> Head{};
+
+			/// <summary>
+			/// Written by the consumer only.
+			/// </summary>
+			Template::SharedIndex<index_t> Tail{};
+
+		public:
+			SpscRing() {}
+
+			/// <summary>
+			/// Producer: number of samples that can be pushed.
+			/// </summary>
+			size_t GetFree() const
+			{
+				return capacity - (index_t)(Head.Load() - Tail.Load());
+			}
+
+			/// <summary>
+			/// Producer: push a single sample.
+			/// </summary>
+			/// <returns>False if the ring is full, the sample is dropped.</returns>
+			bool Push(const value_t value)
+			{
+				const index_t head = Head.Load();
+				if ((index_t)(head - Tail.Load()) >= capacity)
+				{
+					return false;
+				}
+
+				Buffer[head & Mask] = value;
+				Head.Store(head + 1);
+
+				return true;
+			}
+
+			/// <summary>
+			/// Producer: push as many samples as fit.
+			/// </summary>
+			/// <returns>Number of samples pushed.</returns>
+			size_t Push(const value_t* values, const size_t count)
+			{
+				const index_t head = Head.Load();
+				const index_t free = capacity - (index_t)(head - Tail.Load());
+				const index_t pushCount = (count < free) ? (index_t)count : free;
+
+				for (index_t i = 0; i < pushCount; i++)
+				{
+					Buffer[(index_t)(head + i) & Mask] = values[i];
+				}
+				Head.Store(head + pushCount);
+
+				return pushCount;
+			}
+
+			/// <summary>
+			/// Consumer: number of samples available.
+			/// </summary>
+			size_t GetCount() const
+			{
+				return (index_t)(Head.Load() - Tail.Load());
+			}
+
+			/// <summary>
+			/// Consumer: pop a single sample.
+			/// </summary>
+			/// <returns>False if the ring is empty.</returns>
+			bool Pop(value_t& value)
+			{
+				const index_t tail = Tail.Load();
+				if (Head.Load() == tail)
+				{
+					return false;
+				}
+
+				value = Buffer[tail & Mask];
+				Tail.Store(tail + 1);
+
+				return true;
+			}
+
+			/// <summary>
+			/// Consumer: pop up to count samples.
+			/// </summary>
+			/// <returns>Number of samples popped.</returns>
+			size_t Pop(value_t* values, const size_t count)
+			{
+				const index_t tail = Tail.Load();
+				const index_t available = Head.Load() - tail;
+				const index_t popCount = (count < available) ? (index_t)count : available;
+
+				for (index_t i = 0; i < popCount; i++)
+				{
+					values[i] = Buffer[(index_t)(tail + i) & Mask];
+				}
+				Tail.Store(tail + popCount);
+
+				return popCount;
+			}
+
+			/// <summary>
+			/// Consumer: discard all available samples.
+			/// </summary>
+			void Clear()
+			{
+				Tail.Store(Head.Load());
+			}
+
+			/// <summary>
+			/// Consumer: zero-copy drain of all available samples through a block processor.
+			/// The processor runs in place over the (at most two) contiguous spans of the ring,
+			/// before the slots are released to the producer.
+			/// </summary>
+			/// <typeparam name="FilterChain">Any type with ProcessBlock(const value_t* input, value_t* output, size_t count), output may alias input.</typeparam>
+			/// <param name="chain">Filter, curve block or chain instance.</param>
+			/// <returns>Number of samples processed.</returns>
+			template<typename FilterChain>
+			size_t Process(FilterChain& chain)
+			{
+				return Drain(chain, nullptr, SIZE_MAX);
+			}
+
+			/// <summary>
+			/// Consumer: zero-copy drain of up to maxCount samples through a block processor,
+			/// with the processed samples copied to output.
+			/// </summary>
+			/// <typeparam name="FilterChain">Any type with ProcessBlock(const value_t* input, value_t* output, size_t count), output may alias input.</typeparam>
+			/// <param name="chain">Filter, curve block or chain instance.</param>
+			/// <param name="output">Processed samples, in order.</param>
+			/// <param name="maxCount">Maximum number of samples to drain.</param>
+			/// <returns>Number of samples processed.</returns>
+			template<typename FilterChain>
+			size_t Process(FilterChain& chain, value_t* output, const size_t maxCount)
+			{
+				return Drain(chain, output, maxCount);
+			}
+
+		private:
+			template<typename FilterChain>
+			size_t Drain(FilterChain& chain, value_t* output, const size_t maxCount)
+			{
+				const index_t tail = Tail.Load();
+				const index_t available = Head.Load() - tail;
+				const index_t count = (maxCount < available) ? (index_t)maxCount : available;
+
+				const index_t start = tail & Mask;
+				const index_t firstCount = ((capacity - start) < count) ? (index_t)(capacity - start) : count;
+				const index_t secondCount = count - firstCount;
+
+				ProcessSpan(chain, &Buffer[start], output, firstCount);
+				ProcessSpan(chain, Buffer, (output != nullptr) ? &output[firstCount] : nullptr, secondCount);
+
+				Tail.Store(tail + count);
+
+				return count;
+			}
+
+			template<typename FilterChain>
+			static void ProcessSpan(FilterChain& chain, value_t* span, value_t* output, const index_t count)
+			{
+				if (count == 0)
+				{
+					return;
+				}
+
+				if (output != nullptr)
+				{
+					chain.ProcessBlock(span, output, count);
+				}
+				else
+				{
+					chain.ProcessBlock(span, span, count);
+				}
+			}
+		};
+	}
+}
+#endif
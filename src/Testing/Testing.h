@@ -30,5 +30,73 @@ namespace IntegerSignal::Testing
 		}
 		Serial.print(&buffer[idx]);
 	}
+
+	// Linear congruential generator step, with the high bits folded into the low bits.
+	uint32_t NextRandom(uint32_t& seed)
+	{
+		seed = (seed * 1103515245u) + 12345u;
+
+		return seed ^ (seed >> 16);
+	}
+
+	// Checks ProcessBlock against per-sample Set/Step/Get on cleared filters, including state carried across blocks.
+	// Blocks have variable lengths, including empty blocks.
+	template<typename ValueT, typename FilterT, uint16_t BlockSize = 64>
+	bool TestProcessBlock(FilterT& block, FilterT& reference, const __FlashStringHelper* name, const uint32_t blocks)
+	{
+		ValueT input[BlockSize];
+		ValueT output[BlockSize];
+		uint32_t seed = 0x1234567;
+
+		for (uint32_t b = 0; b < blocks; b++)
+		{
+			const uint16_t count = b % (BlockSize + 1);
+			for (uint16_t i = 0; i < count; i++)
+			{
+				const uint32_t random = NextRandom(seed);
+				input[i] = (ValueT)(((uint64_t)random << 32 | (random >> 3)) >> (b % 32));
+			}
+
+			block.ProcessBlock(input, output, count);
+
+			for (uint16_t i = 0; i < count; i++)
+			{
+				reference.Set(input[i]);
+				reference.Step();
+				if (reference.Get() != output[i])
+				{
+					Serial.print(name);
+					Serial.print(F(" ProcessBlock mismatch at block "));
+					Serial.print(b);
+					Serial.print(F(" i=")); Serial.print(i);
+					Serial.print(F(" got=")); PrintUInt64((uint64_t)output[i]);
+					Serial.print(F(" ref=")); PrintUInt64((uint64_t)reference.Get());
+					Serial.println();
+					return false;
+				}
+			}
+
+			if (reference.Get() != block.Get())
+			{
+				Serial.print(name);
+				Serial.print(F(" ProcessBlock state mismatch at block "));
+				Serial.println(b);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// Checks ProcessBlock against per-sample Set/Step/Get, both filters cleared to init.
+	template<typename FilterT, typename ValueT, uint16_t BlockSize = 64>
+	bool TestProcessBlock(const __FlashStringHelper* name, const ValueT init, const uint32_t blocks)
+	{
+		FilterT block, reference;
+		block.Clear(init);
+		reference.Clear(init);
+
+		return TestProcessBlock<ValueT, FilterT, BlockSize>(block, reference, name, blocks);
+	}
 }
 #endif
\ No newline at end of file
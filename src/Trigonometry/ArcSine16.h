@@ -0,0 +1,163 @@
+#ifndef _INTEGER_TRIGONOMETRY_ARC_SINE16_h
+#define _INTEGER_TRIGONOMETRY_ARC_SINE16_h
+
+#include "Lut/Sine16Lut.h"
+#include "Lut/ArcSine16Lut.h"
+#include "../Base/SquareRoot.h"
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		using namespace FixedPoint::ScalarFraction;
+
+		namespace ArcSines
+		{
+			/// <summary>
+			/// Sine folded into [0 ; sqrt(1/2)], where the inverse is well conditioned.
+			/// Above sqrt(1/2), asin(v) = 90 - asin(sqrt(1 - v^2)).
+			/// </summary>
+			struct Folded
+			{
+				/// <summary>
+				/// [0 ; sqrt(1/2)] in UQ0.16.
+				/// </summary>
+				uint16_t Sine;
+				bool Complement;
+				bool Negative;
+
+				Folded(const fraction16_t value)
+				{
+					static constexpr uint16_t Half = 11585; // sqrt(1/2) in Q0.14.
+
+					const uint16_t absolute = (value < 0) ? (uint16_t)(0 - value) : (uint16_t)value;
+					const uint32_t sine = (absolute > FRACTION16_1X) ? FRACTION16_1X : absolute;
+
+					Negative = value < 0;
+					Complement = sine > Half;
+					if (Complement)
+					{
+						// 1 - v^2 in Q0.28, up-shifted to Q0.32 for a Q0.16 root.
+						Sine = SquareRoot32(((uint32_t(1) << 28) - (sine * sine)) << 4);
+					}
+					else
+					{
+						Sine = (uint16_t)(sine << 2);
+					}
+				}
+
+				/// <summary>
+				/// [0 ; 45] degrees angle to [-90 ; 90] degrees.
+				/// </summary>
+				angle_t Unfold(angle_t angle) const
+				{
+					if (Complement)
+						angle = ANGLE_90 - angle;
+					if (Negative)
+						angle = 0 - angle;
+
+					return angle;
+				}
+			};
+
+			namespace Search
+			{
+				static constexpr uint16_t LutSize = Lut::Sine16::LutSize;
+				static constexpr angle_t StepAngle = ANGLE_90 / LutSize;
+
+				static_assert((LutSize & (LutSize - 1)) == 0, "ArcSine16 requires a power-of-two Sine16 LUT.");
+
+				static uint16_t Read(const uint16_t index)
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					return pgm_read_word(&Lut::Sine16::Table[index]);
+#else
+					return Lut::Sine16::Table[index];
+#endif
+				}
+
+				/// <summary>
+				/// Inverse of Lut::Sine16, by branch-free binary search and linear interpolation.
+				/// Only the first half of the table is reached.
+				/// </summary>
+				/// <param name="sine">[0 ; sqrt(1/2)] in UQ0.16.</param>
+				/// <returns>[0 ; ANGLE_45].</returns>
+				static angle_t Get(const uint16_t sine)
+				{
+					// UQ0.16 to the [0 ; UINT16_MAX] scale of the LUT.
+					const uint16_t target = (uint16_t)((((uint32_t)sine * UINT16_MAX) + (uint32_t(1) << 15)) >> 16);
+
+					uint16_t index = 0;
+					for (uint16_t step = LutSize >> 1; step > 0; step >>= 1)
+					{
+						index += (Read(index + step) <= target) ? step : 0;
+					}
+
+					const uint16_t a = Read(index);
+					const uint16_t range = Read(index + 1) - a;
+					const uint16_t interpolated = (uint16_t)((((uint32_t)(target - a) * StepAngle) + (range >> 1)) / range);
+
+					return (angle_t)((index * StepAngle) + ((interpolated < StepAngle) ? interpolated : StepAngle));
+				}
+			}
+
+			namespace Direct
+			{
+				static uint16_t Read(const uint16_t index)
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					return pgm_read_word(&Lut::ArcSine16::Table[index]);
+#else
+					return Lut::ArcSine16::Table[index];
+#endif
+				}
+
+				/// <summary>
+				/// Direct lookup in Lut::ArcSine16, with linear interpolation.
+				/// </summary>
+				/// <param name="sine">[0 ; sqrt(1/2)] in UQ0.16.</param>
+				/// <returns>[0 ; ANGLE_45].</returns>
+				static angle_t Get(const uint16_t sine)
+				{
+					static constexpr uint16_t FractionMask = (uint16_t(1) << Lut::ArcSine16::InputShifts) - 1;
+
+					const uint16_t index = sine >> Lut::ArcSine16::InputShifts;
+					const uint16_t a = Read(index);
+					const uint16_t b = Read(index + 1);
+					const uint32_t interpolated = ((uint32_t)(b - a) * (sine & FractionMask)) >> Lut::ArcSine16::InputShifts;
+
+					return (angle_t)((a + interpolated + (uint32_t(1) << (Lut::ArcSine16::AngleShifts - 1))) >> Lut::ArcSine16::AngleShifts);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Arc sine using fixed-point Q-format (16-bit signed fraction, Q0.14).
+		/// Inverse search in the Sine16 LUT, log2(LUT size) table reads.
+		/// Define INTEGER_TRIGONOMETRY_ARC_SINE_LUT to use the direct ArcSine16 LUT instead (constant time, 366 bytes).
+		/// </summary>
+		/// <param name="value">Signed Q-format fraction in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X], saturated.</param>
+		/// <returns>Modular angle_t in [-ANGLE_90 ; ANGLE_90].</returns>
+		static angle_t ArcSine16(const fraction16_t value)
+		{
+			const ArcSines::Folded folded(value);
+
+#if defined(INTEGER_TRIGONOMETRY_ARC_SINE_LUT)
+			return folded.Unfold(ArcSines::Direct::Get(folded.Sine));
+#else
+			return folded.Unfold(ArcSines::Search::Get(folded.Sine));
+#endif
+		}
+
+		/// <summary>
+		/// Arc cosine using fixed-point Q-format (16-bit signed fraction, Q0.14).
+		/// </summary>
+		/// <param name="value">Signed Q-format fraction in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X], saturated.</param>
+		/// <returns>angle_t in [0 ; ANGLE_180].</returns>
+		static angle_t ArcCosine16(const fraction16_t value)
+		{
+			return ANGLE_90 - ArcSine16(value);
+		}
+	}
+}
+#endif
@@ -0,0 +1,217 @@
+#ifndef _INTEGER_TRIGONOMETRY_ARC_TANGENT_h
+#define _INTEGER_TRIGONOMETRY_ARC_TANGENT_h
+
+#include "Trigonometry.h"
+#include <stddef.h>
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace ArcTangents
+		{
+			/// <summary>
+			/// Vector folded into the first octant, 0 <= Min <= Max.
+			/// Unfold() maps a first octant angle back to the quadrant and side of the vector.
+			/// </summary>
+			struct Octant
+			{
+				uint32_t Max;
+				uint32_t Min;
+				bool Swapped;
+				bool NegativeX;
+				bool NegativeY;
+
+				Octant(const int32_t y, const int32_t x)
+				{
+					const uint32_t absoluteX = (x < 0) ? (0u - (uint32_t)x) : (uint32_t)x;
+					const uint32_t absoluteY = (y < 0) ? (0u - (uint32_t)y) : (uint32_t)y;
+
+					Swapped = absoluteY > absoluteX;
+					NegativeX = x < 0;
+					NegativeY = y < 0;
+					Max = Swapped ? absoluteY : absoluteX;
+					Min = Swapped ? absoluteX : absoluteY;
+				}
+
+				/// <summary>
+				/// First octant angle to full rotation.
+				/// </summary>
+				/// <typeparam name="unsigned_t">angle_t, or uint32_t for a 32 bit full-rotation angle.</typeparam>
+				/// <param name="angle">[0 ; 45] degrees.</param>
+				template<typename unsigned_t>
+				unsigned_t Unfold(unsigned_t angle) const
+				{
+					static constexpr uint8_t Shifts = (sizeof(unsigned_t) - sizeof(angle_t)) * 8;
+					static constexpr unsigned_t Angle90 = unsigned_t(ANGLE_90) << Shifts;
+					static constexpr unsigned_t Angle180 = unsigned_t(ANGLE_180) << Shifts;
+
+					if (Swapped)
+						angle = Angle90 - angle;
+					if (NegativeX)
+						angle = Angle180 - angle;
+					if (NegativeY)
+						angle = unsigned_t(0) - angle;
+
+					return angle;
+				}
+			};
+
+			namespace Cordic
+			{
+				static constexpr uint8_t Iterations = 18;
+
+				/// <summary>
+				/// Fixed-point position of the normalized Max, leaves room for the CORDIC gain (1.65 * sqrt(2)).
+				/// </summary>
+				static constexpr uint8_t NormalShifts = 28;
+
+				/// <summary>
+				/// atan(2^-i), in 2^-32 turns.
+				/// </summary>
+				static constexpr uint32_t Angles[Iterations]
+				{
+					536870912, 316933406, 167458907, 85004756, 42667331, 21354465,
+					10679838, 5340245, 2670163, 1335087, 667544, 333772,
+					166886, 83443, 41722, 20861, 10430, 5215
+				};
+
+				/// <summary>
+				/// 1 / CORDIC gain, prod(1 / sqrt(1 + 2^-2i)), in UQ0.32.
+				/// </summary>
+				static constexpr uint32_t InverseGain = 2608131496;
+
+				/// <summary>
+				/// CORDIC vectoring of a first octant vector.
+				/// Max is scaled to [2^NormalShifts ; 2^(NormalShifts + 1)[ so every vector gets the same precision.
+				/// </summary>
+				/// <param name="octant">Folded vector, Max > 0.</param>
+				/// <param name="magnitude">Vector magnitude, rounded.</param>
+				/// <returns>First octant angle, in 2^-32 turns.</returns>
+				static uint32_t Vector(const Octant& octant, uint32_t& magnitude)
+				{
+					uint32_t max = octant.Max;
+					uint32_t min = octant.Min;
+
+					// Normalize, right for large vectors, left in binary steps for small ones.
+					int8_t shifts = 0;
+					while (max >= (uint32_t(1) << (NormalShifts + 1)))
+					{
+						max >>= 1;
+						min >>= 1;
+						shifts--;
+					}
+					for (uint8_t step = 16; step > 0; step >>= 1)
+					{
+						if (max < (uint32_t(1) << (NormalShifts + 1 - step)))
+						{
+							max <<= step;
+							min <<= step;
+							shifts += step;
+						}
+					}
+
+					int32_t x = (int32_t)max;
+					int32_t y = (int32_t)min;
+					uint32_t angle = 0;
+					for (uint8_t i = 0; i < Iterations; i++)
+					{
+						// Rotate towards y = 0, branch-free: sign is 0 or -1, (v ^ sign) - sign is v or -v.
+						// x stays positive, shifts only apply to non-negative values.
+						const int32_t sign = -(int32_t)(y < 0);
+						const int32_t dx = ((y ^ sign) - sign) >> i;
+						const int32_t dy = x >> i;
+						x += dx;
+						y -= (dy ^ sign) - sign;
+						angle += (Angles[i] ^ (uint32_t)sign) - (uint32_t)sign;
+					}
+
+					const uint64_t scaled = (((uint64_t)(uint32_t)x * InverseGain) + (uint64_t(1) << 31)) >> 32;
+					if (shifts > 0)
+					{
+						magnitude = (uint32_t)((scaled + (uint64_t(1) << (shifts - 1))) >> shifts);
+					}
+					else
+					{
+						magnitude = (uint32_t)(scaled << -shifts);
+					}
+
+					return angle;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Four-quadrant arc tangent of y / x, with shift-add CORDIC (no lookup tables, no divisions).
+		/// </summary>
+		/// <param name="y">Any int32_t value.</param>
+		/// <param name="x">Any int32_t value.</param>
+		/// <returns>Modular angle_t of the vector (x, y), 0 for (0, 0).</returns>
+		static angle_t ArcTangent2(const int32_t y, const int32_t x)
+		{
+			const ArcTangents::Octant octant(y, x);
+			if (octant.Max == 0)
+			{
+				return 0;
+			}
+
+			uint32_t magnitude;
+			const uint32_t angle = octant.Unfold<uint32_t>(ArcTangents::Cordic::Vector(octant, magnitude));
+
+			return angle_t((angle + (uint32_t(1) << 15)) >> 16);
+		}
+
+		/// <summary>
+		/// Magnitude and phase of the vector (x, y), with shift-add CORDIC.
+		/// </summary>
+		/// <param name="y">Any int32_t value.</param>
+		/// <param name="x">Any int32_t value.</param>
+		/// <param name="magnitude">sqrt(x^2 + y^2), rounded, [0 ; 2^31 * sqrt(2)].</param>
+		/// <returns>Modular angle_t of the vector (x, y), 0 for (0, 0).</returns>
+		static angle_t Polar(const int32_t y, const int32_t x, uint32_t& magnitude)
+		{
+			const ArcTangents::Octant octant(y, x);
+			if (octant.Max == 0)
+			{
+				magnitude = 0;
+				return 0;
+			}
+
+			const uint32_t angle = octant.Unfold<uint32_t>(ArcTangents::Cordic::Vector(octant, magnitude));
+
+			return angle_t((angle + (uint32_t(1) << 15)) >> 16);
+		}
+
+		/// <summary>
+		/// ArcTangent2() over arrays.
+		/// </summary>
+		/// <param name="y">Vector y components.</param>
+		/// <param name="x">Vector x components.</param>
+		/// <param name="angles">Output angles.</param>
+		/// <param name="count">Number of vectors.</param>
+		static void ArcTangent2Batch(const int32_t* y, const int32_t* x, angle_t* angles, const size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				angles[i] = ArcTangent2(y[i], x[i]);
+			}
+		}
+
+		/// <summary>
+		/// Polar() over arrays.
+		/// </summary>
+		/// <param name="y">Vector y components.</param>
+		/// <param name="x">Vector x components.</param>
+		/// <param name="magnitudes">Output magnitudes.</param>
+		/// <param name="angles">Output angles.</param>
+		/// <param name="count">Number of vectors.</param>
+		static void PolarBatch(const int32_t* y, const int32_t* x, uint32_t* magnitudes, angle_t* angles, const size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				angles[i] = Polar(y[i], x[i], magnitudes[i]);
+			}
+		}
+	}
+}
+#endif
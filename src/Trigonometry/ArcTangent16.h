@@ -0,0 +1,173 @@
+#ifndef _INTEGER_TRIGONOMETRY_ARC_TANGENT16_h
+#define _INTEGER_TRIGONOMETRY_ARC_TANGENT16_h
+
+#include "ArcTangent.h"
+#include "Lut/Tangent16Lut.h"
+#include "Lut/Sine16Lut.h"
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace ArcTangents
+		{
+			namespace Tangent16
+			{
+				static constexpr uint16_t LutSize = Lut::Tangent16::LutSize;
+
+				/// <summary>
+				/// The search needs a true tangent LUT (not the hand-tuned tiny LUT),
+				/// and at least 256 items for the Sine16 magnitude interpolation (about 20 ppm, 300 ppm with 64 items).
+				/// Otherwise ArcTangent16 and Polar16 use CORDIC.
+				/// </summary>
+				static constexpr bool Enabled = (INTEGER_TRIGONOMETRY_LUT != INTEGER_TRIGONOMETRY_LUT_TINY) && (LutSize >= 256);
+				static constexpr angle_t StepAngle = ANGLE_45 / LutSize;
+
+				static_assert((LutSize & (LutSize - 1)) == 0, "ArcTangent16 requires a power-of-two Tangent16 LUT.");
+
+				static uint16_t Read(const uint16_t index)
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					return pgm_read_word(&Lut::Tangent16::Table[index]);
+#else
+					return Lut::Tangent16::Table[index];
+#endif
+				}
+
+				/// <summary>
+				/// Inverse of Lut::Tangent16, by branch-free binary search and linear interpolation.
+				/// </summary>
+				/// <param name="octant">Folded vector, Max > 0.</param>
+				/// <returns>First octant angle [0 ; ANGLE_45].</returns>
+				static angle_t Search(const Octant& octant)
+				{
+					// Normalize Max to [2^31 ; 2^32[, the ratio keeps the full precision of Min.
+					uint32_t max = octant.Max;
+					uint32_t min = octant.Min;
+					for (uint8_t step = 16; step > 0; step >>= 1)
+					{
+						if (max < (uint32_t(1) << (32 - step)))
+						{
+							max <<= step;
+							min <<= step;
+						}
+					}
+
+					// tan in [0 ; UINT16_MAX], the scale of the LUT.
+					const uint32_t ratio = min / (max >> 16);
+					const uint16_t tangent = (ratio >= UINT16_MAX) ? UINT16_MAX : (uint16_t)(ratio - (ratio >> 16));
+
+					uint16_t index = 0;
+					for (uint16_t step = LutSize >> 1; step > 0; step >>= 1)
+					{
+						index += (Read(index + step) <= tangent) ? step : 0;
+					}
+
+					const uint16_t a = Read(index);
+					const uint16_t b = (index < (LutSize - 1)) ? Read(index + 1) : UINT16_MAX;
+					const uint16_t range = b - a;
+					const uint16_t interpolated = (range == 0) ? 0
+						: (uint16_t)((((uint32_t)(tangent - a) * StepAngle) + (range >> 1)) / range);
+
+					return (angle_t)((index * StepAngle) + ((interpolated < StepAngle) ? interpolated : StepAngle));
+				}
+
+				/// <summary>
+				/// |v| = Max * cos(a) + Min * sin(a), with a the first octant angle, from Lut::Sine16.
+				/// </summary>
+				static uint32_t GetMagnitude(const Octant& octant, const angle_t angle)
+				{
+					const uint64_t sum = ((uint64_t)octant.Max * Lut::Sine16::GetInterpolated(ANGLE_90 - angle))
+						+ ((uint64_t)octant.Min * Lut::Sine16::GetInterpolated(angle));
+
+					// Divide by UINT16_MAX, rounded.
+					return (uint32_t)((sum + (sum >> 16) + (uint64_t(1) << 15)) >> 16);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Four-quadrant arc tangent of y / x, by inverse search in the Tangent16 LUT.
+		/// One division, then log2(LUT size) table reads.
+		/// Same as ArcTangent2() with the tiny LUT or a LUT smaller than 256 items.
+		/// </summary>
+		/// <param name="y">Any int32_t value.</param>
+		/// <param name="x">Any int32_t value.</param>
+		/// <returns>Modular angle_t of the vector (x, y), 0 for (0, 0).</returns>
+		static angle_t ArcTangent16(const int32_t y, const int32_t x)
+		{
+			if (!ArcTangents::Tangent16::Enabled)
+			{
+				return ArcTangent2(y, x);
+			}
+
+			const ArcTangents::Octant octant(y, x);
+			if (octant.Max == 0)
+			{
+				return 0;
+			}
+
+			return octant.Unfold<angle_t>(ArcTangents::Tangent16::Search(octant));
+		}
+
+		/// <summary>
+		/// Magnitude and phase of the vector (x, y), from the Tangent16 and Sine16 LUTs.
+		/// Same as Polar() with the tiny LUT or a LUT smaller than 256 items.
+		/// </summary>
+		/// <param name="y">Any int32_t value.</param>
+		/// <param name="x">Any int32_t value.</param>
+		/// <param name="magnitude">sqrt(x^2 + y^2), [0 ; 2^31 * sqrt(2)].</param>
+		/// <returns>Modular angle_t of the vector (x, y), 0 for (0, 0).</returns>
+		static angle_t Polar16(const int32_t y, const int32_t x, uint32_t& magnitude)
+		{
+			if (!ArcTangents::Tangent16::Enabled)
+			{
+				return Polar(y, x, magnitude);
+			}
+
+			const ArcTangents::Octant octant(y, x);
+			if (octant.Max == 0)
+			{
+				magnitude = 0;
+				return 0;
+			}
+
+			const angle_t angle = ArcTangents::Tangent16::Search(octant);
+			magnitude = ArcTangents::Tangent16::GetMagnitude(octant, angle);
+
+			return octant.Unfold<angle_t>(angle);
+		}
+
+		/// <summary>
+		/// ArcTangent16() over arrays.
+		/// </summary>
+		/// <param name="y">Vector y components.</param>
+		/// <param name="x">Vector x components.</param>
+		/// <param name="angles">Output angles.</param>
+		/// <param name="count">Number of vectors.</param>
+		static void ArcTangent16Batch(const int32_t* y, const int32_t* x, angle_t* angles, const size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				angles[i] = ArcTangent16(y[i], x[i]);
+			}
+		}
+
+		/// <summary>
+		/// Polar16() over arrays.
+		/// </summary>
+		/// <param name="y">Vector y components.</param>
+		/// <param name="x">Vector x components.</param>
+		/// <param name="magnitudes">Output magnitudes.</param>
+		/// <param name="angles">Output angles.</param>
+		/// <param name="count">Number of vectors.</param>
+		static void Polar16Batch(const int32_t* y, const int32_t* x, uint32_t* magnitudes, angle_t* angles, const size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				angles[i] = Polar16(y[i], x[i], magnitudes[i]);
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,64 @@
+#ifndef _INTEGER_TRIGONOMETRY_LUT_ARC_SINE16_h
+#define _INTEGER_TRIGONOMETRY_LUT_ARC_SINE16_h
+
+#include "../Trigonometry.h"
+
+#if defined(ARDUINO_ARCH_AVR)
+#include <avr/pgmspace.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace Lut
+		{
+			namespace ArcSine16
+			{
+				/// <summary>
+				/// Input step of the table, sine in UQ0.16 >> InputShifts.
+				/// </summary>
+				static constexpr uint8_t InputShifts = 8;
+
+				/// <summary>
+				/// Extra precision of the table angles, angle_t << AngleShifts.
+				/// </summary>
+				static constexpr uint8_t AngleShifts = 2;
+
+				/// <summary>
+				/// [0 ; sqrt(1/2)] ArcSine function table (1/256th divided), plus one item for interpolation.
+				/// [0 ; ANGLE_45 << AngleShifts] angle.
+				/// </summary>
+				static constexpr uint16_t Table[] PROGMEM
+				{
+					0, 163, 326, 489, 652, 815, 978, 1141,
+					1304, 1467, 1630, 1793, 1956, 2120, 2283, 2446,
+					2609, 2773, 2936, 3099, 3263, 3426, 3590, 3753,
+					3917, 4081, 4245, 4409, 4572, 4736, 4901, 5065,
+					5229, 5393, 5558, 5722, 5887, 6051, 6216, 6381,
+					6546, 6711, 6876, 7041, 7207, 7372, 7538, 7704,
+					7869, 8035, 8201, 8368, 8534, 8701, 8867, 9034,
+					9201, 9368, 9535, 9703, 9870, 10038, 10206, 10374,
+					10542, 10711, 10879, 11048, 11217, 11386, 11555, 11725,
+					11895, 12065, 12235, 12405, 12576, 12746, 12917, 13089,
+					13260, 13432, 13604, 13776, 13948, 14121, 14294, 14467,
+					14640, 14814, 14988, 15162, 15337, 15512, 15687, 15862,
+					16038, 16214, 16390, 16566, 16743, 16920, 17098, 17276,
+					17454, 17633, 17811, 17991, 18170, 18350, 18530, 18711,
+					18892, 19074, 19255, 19438, 19620, 19803, 19987, 20171,
+					20355, 20540, 20725, 20910, 21096, 21283, 21470, 21657,
+					21845, 22034, 22223, 22412, 22602, 22793, 22984, 23175,
+					23367, 23560, 23753, 23947, 24141, 24336, 24532, 24728,
+					24925, 25122, 25320, 25519, 25718, 25918, 26119, 26321,
+					26523, 26726, 26929, 27134, 27339, 27545, 27752, 27959,
+					28168, 28377, 28587, 28798, 29009, 29222, 29436, 29650,
+					29866, 30082, 30300, 30518, 30738, 30958, 31180, 31403,
+					31627, 31852, 32078, 32305, 32534, 32764, 32995
+				};
+
+				static constexpr uint16_t LutSize = sizeof(Table) / sizeof(Table[0]);
+			}
+		}
+	}
+}
+#endif
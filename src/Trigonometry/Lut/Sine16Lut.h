@@ -3,6 +3,13 @@
 
 #include "../Trigonometry.h"
 
+#if (INTEGER_TRIGONOMETRY_LUT == INTEGER_TRIGONOMETRY_LUT_GENERATED)
+#if (__cplusplus < 201402L)
+#error INTEGER_TRIGONOMETRY_LUT_GENERATED requires C++14 (compile-time table generation).
+#endif
+#include "TableGenerator.h"
+#endif
+
 #if defined(ARDUINO_ARCH_AVR)
 #include <avr/pgmspace.h>
 #endif
@@ -72,6 +79,19 @@ namespace IntegerSignal
 					60546, 61143, 61704, 62227, 62713, 63161, 63570, 63942,
 					64275, 64570, 64825, 65042, 65219, 65357, 65456, 65520
 				};
+#elif (INTEGER_TRIGONOMETRY_LUT == INTEGER_TRIGONOMETRY_LUT_GENERATED)
+				static_assert(INTEGER_TRIGONOMETRY_LUT_SIZE >= 64 && INTEGER_TRIGONOMETRY_LUT_SIZE <= 8192, "INTEGER_TRIGONOMETRY_LUT_SIZE must be in [64 ; 8192].");
+
+				/// <summary>
+				/// Compile-time generated table storage.
+				/// </summary>
+				static constexpr TableGenerator::Sine16Table<INTEGER_TRIGONOMETRY_LUT_SIZE> Generated PROGMEM{};
+
+				/// <summary>
+				/// [0 ; 90] degrees Sine function table (1/INTEGER_TRIGONOMETRY_LUT_SIZE divided).
+				/// [0 ; UINT16_MAX] fraction.
+				/// </summary>
+				static constexpr auto& Table = Generated.Table;
 #else
 #error Integer Sine has no LUT size defined.
 #endif
@@ -119,6 +139,80 @@ namespace IntegerSignal
 						return UINT16_MAX;
 					}
 				}
+
+				/// <summary>
+				/// Reads the adjacent table values at index and index + 1.
+				/// On AVR, both words come from a single flash read.
+				/// </summary>
+				/// <param name="index">[0 ; LutSize - 2]</param>
+				static void ReadPair(const uint16_t index, uint16_t& a, uint16_t& b)
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					const uint32_t pair = pgm_read_dword(&Table[index]);
+					a = (uint16_t)pair;
+					b = (uint16_t)(pair >> 16);
+#else
+					a = Table[index];
+					b = Table[index + 1];
+#endif
+				}
+
+				/// <summary>
+				/// Sine and cosine LUT values of the same angle, from a single index computation.
+				/// Bit-exact with GetInterpolated(angle) and GetInterpolated(ANGLE_90 - angle).
+				/// The quarter table holds the cosine mirrored, so the cosine interpolates the adjacent pair at the mirrored index:
+				/// one adjacent pair per output, single values on table points.
+				/// </summary>
+				/// <param name="angle">[0 ; ANGLE_90[</param>
+				/// <param name="sine">Sine scale [0 ; UINT16_MAX].</param>
+				/// <param name="cosine">Cosine scale [0 ; UINT16_MAX].</param>
+				static void GetInterpolatedPair(const angle_t angle, uint16_t& sine, uint16_t& cosine)
+				{
+					static constexpr auto StepError = (ANGLE_90 / LutSize);
+
+					const uint16_t flooredIndex = ((uint32_t)angle << GetBitShifts(LutSize)) >> GetBitShifts(ANGLE_90);
+					const angle_t flooredAngle = ((uint32_t)(flooredIndex) << GetBitShifts(ANGLE_90)) >> GetBitShifts(LutSize);
+					const uint16_t angleError = angle - flooredAngle;
+
+					if (angleError == 0)
+					{
+						// Both on table points, ANGLE_90 - angle is the mirrored index.
+						// The last table point reads as UINT16_MAX, as in GetInterpolated().
+						const uint16_t mirroredIndex = LutSize - flooredIndex;
+#if defined(ARDUINO_ARCH_AVR)
+						sine = (flooredIndex < (LutSize - 1)) ? pgm_read_word(&Table[flooredIndex]) : UINT16_MAX;
+						cosine = (mirroredIndex < (LutSize - 1)) ? pgm_read_word(&Table[mirroredIndex]) : UINT16_MAX;
+#else
+						sine = (flooredIndex < (LutSize - 1)) ? Table[flooredIndex] : UINT16_MAX;
+						cosine = (mirroredIndex < (LutSize - 1)) ? Table[mirroredIndex] : UINT16_MAX;
+#endif
+						return;
+					}
+
+					// ANGLE_90 - angle falls between the mirrored pair, with the complementary step error.
+					// The last table segment is flat at UINT16_MAX and needs no read.
+					const uint16_t mirroredIndex = LutSize - 1 - flooredIndex;
+					uint16_t a, b;
+					if (flooredIndex < (LutSize - 1))
+					{
+						ReadPair(flooredIndex, a, b);
+						sine = a + (((static_cast<uint32_t>(b - a) * angleError) + StepError) >> GetBitShifts(StepError));
+					}
+					else
+					{
+						sine = UINT16_MAX;
+					}
+
+					if (mirroredIndex < (LutSize - 1))
+					{
+						ReadPair(mirroredIndex, a, b);
+						cosine = a + (((static_cast<uint32_t>(b - a) * (StepError - angleError)) + StepError) >> GetBitShifts(StepError));
+					}
+					else
+					{
+						cosine = UINT16_MAX;
+					}
+				}
 			}
 		}
 	}
@@ -0,0 +1,135 @@
+#ifndef _INTEGER_TRIGONOMETRY_LUT_SINE32_h
+#define _INTEGER_TRIGONOMETRY_LUT_SINE32_h
+
+#include "../Trigonometry.h"
+
+#if (__cplusplus < 201402L)
+#error INTEGER_TRIGONOMETRY_SINE32_HERMITE requires C++14 (compile-time table generation).
+#endif
+#include "TableGenerator.h"
+#include "../../Base/BitShift.h"
+
+#if defined(ARDUINO_ARCH_AVR)
+#include <avr/pgmspace.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace Lut
+		{
+			/// <summary>
+			/// Q0.30 quarter-wave LUT with cubic Hermite interpolation, for INTEGER_TRIGONOMETRY_SINE32_HERMITE.
+			/// The derivative at each node is the cosine, read from the mirrored node of the same table.
+			/// 129 items of 32 bits, about the size of the 256 items Sine16 LUT.
+			/// </summary>
+			namespace Sine32
+			{
+				static constexpr uint16_t LutSize = 128;
+
+				/// <summary>
+				/// Compile-time generated table storage.
+				/// </summary>
+				static constexpr TableGenerator::Sine32Table<LutSize> Generated PROGMEM{};
+
+				/// <summary>
+				/// [0 ; 90] degrees Sine function table (1/128th divided), LutSize + 1 items.
+				/// [0 ; 2^30] Q0.30 fraction.
+				/// </summary>
+				static constexpr auto& Table = Generated.Table;
+
+				static constexpr angle_t StepAngle = ANGLE_90 / LutSize;
+				static constexpr uint8_t StepShifts = GetBitShifts(StepAngle);
+
+				/// <summary>
+				/// Table step in radians, UQ0.32, rounded.
+				/// </summary>
+				static constexpr uint32_t StepRadians = uint32_t((((TableGenerator::HalfPi >> (TableGenerator::Q62Shifts - 33)) / LutSize) + 1) >> 1);
+
+				static uint32_t Read(const uint16_t index)
+				{
+#if defined(ARDUINO_ARCH_AVR)
+					return pgm_read_dword(&Table[index]);
+#else
+					return Table[index];
+#endif
+				}
+
+				/// <summary>
+				/// Cubic Hermite interpolation between two nodes, in Horner form over t = angleError / StepAngle.
+				/// </summary>
+				/// <param name="a">Sine at the lower node, Q0.30.</param>
+				/// <param name="b">Sine at the upper node, Q0.30.</param>
+				/// <param name="slopeA">Cosine at the lower node, Q0.30.</param>
+				/// <param name="slopeB">Cosine at the upper node, Q0.30.</param>
+				/// <param name="angleError">]0 ; StepAngle[</param>
+				static uint32_t Interpolate(const uint32_t a, const uint32_t b, const uint32_t slopeA, const uint32_t slopeB, const int32_t angleError)
+				{
+					// Node derivatives scaled by the step, h * cos(x).
+					const int32_t da = (int32_t)((((uint64_t)slopeA * StepRadians) + (uint64_t(1) << 31)) >> 32);
+					const int32_t db = (int32_t)((((uint64_t)slopeB * StepRadians) + (uint64_t(1) << 31)) >> 32);
+					const int32_t delta = (int32_t)(b - a);
+
+					const int32_t c2 = (3 * delta) - (2 * da) - db;
+					const int32_t c3 = da + db - (2 * delta);
+
+					// Exact in t^3 * StepAngle^3 units, a single rounding at the end.
+					int64_t sum = ((int64_t)c3 * angleError) + ((int64_t)c2 * StepAngle);
+					sum = (sum * angleError) + ((int64_t)da * StepAngle * StepAngle);
+					sum = (sum * angleError) + (int64_t(1) << ((3 * StepShifts) - 1));
+
+					return a + (uint32_t)SignedRightShift<int64_t, 3 * StepShifts>(sum);
+				}
+
+				/// <summary>
+				/// LUT table based Sine calculator up to 90 degrees, Hermite interpolated.
+				/// </summary>
+				/// <param name="angle">[0 ; ANGLE_90]</param>
+				/// <returns>Q0.30 fraction [0 ; 2^30].</returns>
+				static uint32_t GetInterpolated(const angle_t angle)
+				{
+					const uint16_t index = angle >> StepShifts;
+					const int32_t angleError = angle & (StepAngle - 1);
+
+					if (angleError == 0)
+					{
+						return Read(index);
+					}
+
+					return Interpolate(Read(index), Read(index + 1), Read(LutSize - index), Read(LutSize - 1 - index), angleError);
+				}
+
+				/// <summary>
+				/// Sine and cosine of the same angle, from the same 4 table reads.
+				/// Bit-exact with GetInterpolated(angle) and GetInterpolated(ANGLE_90 - angle).
+				/// </summary>
+				/// <param name="angle">[0 ; ANGLE_90[</param>
+				/// <param name="sine">Q0.30 fraction [0 ; 2^30].</param>
+				/// <param name="cosine">Q0.30 fraction [0 ; 2^30].</param>
+				static void GetInterpolatedPair(const angle_t angle, uint32_t& sine, uint32_t& cosine)
+				{
+					const uint16_t index = angle >> StepShifts;
+					const int32_t angleError = angle & (StepAngle - 1);
+
+					if (angleError == 0)
+					{
+						sine = Read(index);
+						cosine = Read(LutSize - index);
+						return;
+					}
+
+					// The cosine interval is the mirrored one, with swapped roles of values and slopes.
+					const uint32_t a = Read(index);
+					const uint32_t b = Read(index + 1);
+					const uint32_t mirroredA = Read(LutSize - 1 - index);
+					const uint32_t mirroredB = Read(LutSize - index);
+
+					sine = Interpolate(a, b, mirroredB, mirroredA, angleError);
+					cosine = Interpolate(mirroredA, mirroredB, b, a, StepAngle - angleError);
+				}
+			}
+		}
+	}
+}
+#endif
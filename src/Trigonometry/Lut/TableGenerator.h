@@ -0,0 +1,193 @@
+#ifndef _INTEGER_TRIGONOMETRY_LUT_TABLE_GENERATOR_h
+#define _INTEGER_TRIGONOMETRY_LUT_TABLE_GENERATOR_h
+
+#include <stdint.h>
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace Lut
+		{
+			/// <summary>
+			/// Compile-time quarter-wave table generator.
+			/// Integer-only Q2.62 arithmetic, so the tables are identical on every target,
+			/// regardless of the width of double (e.g. 32-bit double on AVR).
+			/// The Q2.62 functions are C++11 constexpr, also usable at run time. The tables require C++14.
+			/// Reproduces the tables printed by Lut::Generator (truncated sin/tan * UINT16_MAX).
+			/// </summary>
+			namespace TableGenerator
+			{
+				/// <summary>
+				/// Unsigned Q2.62 fixed-point, [0 ; 4).
+				/// </summary>
+				typedef uint64_t q62_t;
+
+				static constexpr uint8_t Q62Shifts = 62;
+				static constexpr q62_t Q62One = q62_t(1) << Q62Shifts;
+
+				/// <summary>
+				/// Pi/2 and Pi/4 in Q2.62.
+				/// </summary>
+				static constexpr q62_t HalfPi = 7244019458077122842ULL;
+				static constexpr q62_t QuarterPi = 3622009729038561421ULL;
+
+				/// <summary>
+				/// Multiplication truncated to Q2.62, without 128-bit intermediates.
+				/// Product must be less than 4.
+				/// </summary>
+				static constexpr q62_t Multiply(const q62_t a, const q62_t b)
+				{
+					return ((a >> 32) * (b >> 32) << 2)
+						+ (((a >> 32) * (b & UINT32_MAX)) >> 30)
+						+ (((a & UINT32_MAX) * (b >> 32)) >> 30)
+						+ (((a & UINT32_MAX) * (b & UINT32_MAX)) >> Q62Shifts);
+				}
+
+				/// <summary>
+				/// One restoring long division step per remaining quotient bit.
+				/// </summary>
+				static constexpr q62_t DivideBits(const q62_t quotient, const q62_t remainder, const q62_t denominator, const uint8_t bits)
+				{
+					return (bits == 0) ? quotient
+						: ((remainder << 1) >= denominator) ? DivideBits((quotient << 1) | 1, (remainder << 1) - denominator, denominator, bits - 1)
+						: DivideBits(quotient << 1, remainder << 1, denominator, bits - 1);
+				}
+
+				/// <summary>
+				/// Division truncated to Q2.62, by restoring long division.
+				/// Quotient must be less than 4.
+				/// </summary>
+				static constexpr q62_t Divide(const q62_t numerator, const q62_t denominator)
+				{
+					return DivideBits(numerator / denominator, numerator % denominator, denominator, Q62Shifts);
+				}
+
+				/// <summary>
+				/// Fraction of a range, range * index / size, for power-of-two sizes.
+				/// </summary>
+				static constexpr q62_t GetStepAngle(const q62_t range, const uint16_t index, const uint8_t sizeShifts)
+				{
+					return ((range >> sizeShifts) * index)
+						+ (((range & ((q62_t(1) << sizeShifts) - 1)) * index) >> sizeShifts);
+				}
+
+				/// <summary>
+				/// Alternating Taylor series, adds the term of order n + 1 and the next ones until they vanish.
+				/// The sign alternates from a subtraction, for n = 1 (cosine) or n = 2 (sine).
+				/// </summary>
+				/// <param name="x2">Squared radians in Q2.62.</param>
+				/// <param name="sum">Partial sum, up to order n - 1.</param>
+				/// <param name="term">Term of order n + 1, x^(n + 1) / (n + 1)!.</param>
+				static constexpr q62_t Series(const q62_t x2, const q62_t sum, const q62_t term, const uint8_t n)
+				{
+					return (term == 0) ? sum
+						: Series(x2, (((n + 1) & 2) != 0) ? (sum - term) : (sum + term), Multiply(term, x2) / (uint32_t(n + 2) * (n + 3)), n + 2);
+				}
+
+				/// <summary>
+				/// Taylor series sine, converges to Q2.62 precision in [0 ; Pi/2].
+				/// </summary>
+				/// <param name="x">Radians in Q2.62.</param>
+				static constexpr q62_t Sine(const q62_t x)
+				{
+					return Series(Multiply(x, x), x, Multiply(x, Multiply(x, x)) / (2 * 3), 2);
+				}
+
+				/// <summary>
+				/// Taylor series cosine, converges to Q2.62 precision in [0 ; Pi/2].
+				/// </summary>
+				/// <param name="x">Radians in Q2.62.</param>
+				static constexpr q62_t Cosine(const q62_t x)
+				{
+					return Series(Multiply(x, x), Q62One, Multiply(Q62One, Multiply(x, x)) / (1 * 2), 1);
+				}
+
+				/// <summary>
+				/// Scales a Q2.62 value in [0 ; 1] to [0 ; scale], truncated.
+				/// </summary>
+				static constexpr uint16_t GetUnit(const q62_t value, const uint16_t scale)
+				{
+					return uint16_t((((value >> 32) * scale) + (((value & UINT32_MAX) * scale) >> 32)) >> (Q62Shifts - 32));
+				}
+
+				static constexpr uint8_t GetSizeShifts(const uint16_t size, const uint8_t shifts = 0)
+				{
+					return ((uint16_t(1) << shifts) < size) ? GetSizeShifts(size, shifts + 1) : shifts;
+				}
+
+				static constexpr bool IsPowerOfTwo(const uint16_t size)
+				{
+					return size > 0 && (size & (size - 1)) == 0;
+				}
+
+#if (__cplusplus >= 201402L)
+				/// <summary>
+				/// [0 ; 90[ degrees Sine function table (1/Size divided).
+				/// [0 ; UINT16_MAX] fraction.
+				/// </summary>
+				/// <typeparam name="Size">Power-of-two table size [2 ; 8192].</typeparam>
+				template<uint16_t Size>
+				struct Sine16Table
+				{
+					static_assert(IsPowerOfTwo(Size) && Size >= 2 && Size <= 8192, "Sine16Table size must be a power of two in [2 ; 8192].");
+
+					uint16_t Table[Size];
+
+					constexpr Sine16Table() : Table()
+					{
+						for (uint16_t i = 0; i < Size; i++)
+						{
+							Table[i] = GetUnit(Sine(GetStepAngle(HalfPi, i, GetSizeShifts(Size))), UINT16_MAX);
+						}
+					}
+				};
+
+				/// <summary>
+				/// [0 ; 90] degrees Sine function table (1/Size divided), including the 90 degrees point.
+				/// [0 ; 2^30] Q0.30 fraction, rounded.
+				/// </summary>
+				/// <typeparam name="Size">Power-of-two table size [2 ; 8192].</typeparam>
+				template<uint16_t Size>
+				struct Sine32Table
+				{
+					static_assert(IsPowerOfTwo(Size) && Size >= 2 && Size <= 8192, "Sine32Table size must be a power of two in [2 ; 8192].");
+
+					uint32_t Table[Size + 1];
+
+					constexpr Sine32Table() : Table()
+					{
+						for (uint16_t i = 0; i <= Size; i++)
+						{
+							Table[i] = uint32_t((Sine(GetStepAngle(HalfPi, i, GetSizeShifts(Size))) + (q62_t(1) << 31)) >> 32);
+						}
+					}
+				};
+
+				/// <summary>
+				/// [0 ; 45[ degrees Tangent function table (1/Size divided).
+				/// [0 ; UINT16_MAX] scale.
+				/// </summary>
+				/// <typeparam name="Size">Power-of-two table size [2 ; 8192].</typeparam>
+				template<uint16_t Size>
+				struct Tangent16Table
+				{
+					static_assert(IsPowerOfTwo(Size) && Size >= 2 && Size <= 8192, "Tangent16Table size must be a power of two in [2 ; 8192].");
+
+					uint16_t Table[Size];
+
+					constexpr Tangent16Table() : Table()
+					{
+						for (uint16_t i = 0; i < Size; i++)
+						{
+							const q62_t angle = GetStepAngle(QuarterPi, i, GetSizeShifts(Size));
+							Table[i] = GetUnit(Divide(Sine(angle), Cosine(angle)), UINT16_MAX);
+						}
+					}
+				};
+#endif
+			}
+		}
+	}
+}
+#endif
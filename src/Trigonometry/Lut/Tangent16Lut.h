@@ -3,6 +3,13 @@
 
 #include "../Trigonometry.h"
 
+#if (INTEGER_TRIGONOMETRY_LUT == INTEGER_TRIGONOMETRY_LUT_GENERATED)
+#if (__cplusplus < 201402L)
+#error INTEGER_TRIGONOMETRY_LUT_GENERATED requires C++14 (compile-time table generation).
+#endif
+#include "TableGenerator.h"
+#endif
+
 #if defined(ARDUINO_ARCH_AVR)
 #include <avr/pgmspace.h>
 #endif
@@ -72,6 +79,19 @@ namespace IntegerSignal
 					65340,  65360,  65380,  65400,  65420,  65440,  65460,  65480,
 					65490,  65500,  65510,  65520,  65525,  65530,  65532,  65534
 				};
+#elif (INTEGER_TRIGONOMETRY_LUT == INTEGER_TRIGONOMETRY_LUT_GENERATED)
+				static_assert(INTEGER_TRIGONOMETRY_LUT_SIZE >= 64 && INTEGER_TRIGONOMETRY_LUT_SIZE <= 8192, "INTEGER_TRIGONOMETRY_LUT_SIZE must be in [64 ; 8192].");
+
+				/// <summary>
+				/// Compile-time generated table storage.
+				/// </summary>
+				static constexpr TableGenerator::Tangent16Table<INTEGER_TRIGONOMETRY_LUT_SIZE> Generated PROGMEM{};
+
+				/// <summary>
+				/// [0 ; 45] degrees Tan function table (1/INTEGER_TRIGONOMETRY_LUT_SIZE divided).
+				/// [0 ; UINT16_MAX] scale.
+				/// </summary>
+				static constexpr auto& Table = Generated.Table;
 #else
 #error Integer Tangent has no LUT size defined.
 #endif
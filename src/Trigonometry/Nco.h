@@ -0,0 +1,211 @@
+#ifndef _INTEGER_TRIGONOMETRY_NCO_h
+#define _INTEGER_TRIGONOMETRY_NCO_h
+
+#include "Sine16Batch.h"
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		using namespace FixedPoint::ScalarFraction;
+
+		/// <summary>
+		/// Numerically Controlled Oscillator (Direct Digital Synthesis).
+		/// - Phase: 32-bit modular accumulator for a full rotation, advanced by the tuning word every sample.
+		/// - Output: the upper 16 bits of the phase are the angle_t fed to the quarter-wave Sine16 LUT.
+		/// - Frequency resolution: sampleRate / 2^32.
+		/// Block outputs are bit-exact with Sine16()/Cosine16()/Sine32()/Cosine32() of the truncated phase.
+		/// </summary>
+		class Nco
+		{
+		public:
+			/// <summary>
+			/// Modular fixed-point phase for a full rotation, [0 ; UINT32_MAX].
+			/// </summary>
+			using phase_t = uint32_t;
+
+		private:
+			/// <summary>
+			/// Angles are computed in small chunks, to feed the batch kernels without allocation.
+			/// </summary>
+			static constexpr uint8_t ChunkSize = 32;
+
+			static constexpr uint8_t AngleShifts = (sizeof(phase_t) - sizeof(angle_t)) * 8;
+
+		private:
+			phase_t Phase = 0;
+			phase_t TuningWord = 0;
+
+		public:
+			Nco() {}
+
+			Nco(const phase_t tuningWord, const phase_t phase = 0)
+				: Phase(phase)
+				, TuningWord(tuningWord)
+			{
+			}
+
+			/// <summary>
+			/// Calculates the phase increment per sample for a frequency.
+			/// </summary>
+			/// <param name="frequency">Output frequency [0 ; sampleRate/2].</param>
+			/// <param name="sampleRate">Sample rate, in the same units as frequency.</param>
+			/// <returns>Tuning word, 0 if sampleRate is 0.</returns>
+			static constexpr phase_t GetTuningWord(const uint32_t frequency, const uint32_t sampleRate)
+			{
+				return (sampleRate == 0) ? 0 : phase_t(((uint64_t)frequency << 32) / sampleRate);
+			}
+
+			void SetFrequency(const uint32_t frequency, const uint32_t sampleRate)
+			{
+				TuningWord = GetTuningWord(frequency, sampleRate);
+			}
+
+			void SetTuningWord(const phase_t tuningWord)
+			{
+				TuningWord = tuningWord;
+			}
+
+			phase_t GetTuningWord() const
+			{
+				return TuningWord;
+			}
+
+			void SetPhase(const phase_t phase)
+			{
+				Phase = phase;
+			}
+
+			phase_t GetPhase() const
+			{
+				return Phase;
+			}
+
+			void SetAngle(const angle_t angle)
+			{
+				Phase = phase_t(angle) << AngleShifts;
+			}
+
+			/// <summary>
+			/// Current phase, truncated to angle_t.
+			/// </summary>
+			angle_t GetAngle() const
+			{
+				return angle_t(Phase >> AngleShifts);
+			}
+
+			/// <summary>
+			/// Advance the phase by one sample.
+			/// </summary>
+			void Step()
+			{
+				Phase += TuningWord;
+			}
+
+			fraction16_t GetSine16() const
+			{
+				return Sine16Batches::Sine16Branchless(GetAngle());
+			}
+
+			fraction16_t GetCosine16() const
+			{
+				return Sine16Batches::Sine16Branchless(GetAngle() + ANGLE_90);
+			}
+
+			Fraction32::scalar_t GetSine32() const
+			{
+				return Sine16Batches::Sine32Branchless(GetAngle());
+			}
+
+			Fraction32::scalar_t GetCosine32() const
+			{
+				return Sine16Batches::Sine32Branchless(GetAngle() + ANGLE_90);
+			}
+
+			/// <summary>
+			/// Generates a block of Q0.14 sine samples, advancing the phase once per sample.
+			/// </summary>
+			/// <param name="output">Signed Q-format fractions in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</param>
+			/// <param name="count">Number of samples.</param>
+			void Sine16Block(fraction16_t* output, const size_t count)
+			{
+				angle_t angles[ChunkSize];
+				for (size_t i = 0; i < count; i += ChunkSize)
+				{
+					const uint8_t chunk = FillAngles(angles, count - i);
+					Sine16Batches::Batch(angles, &output[i], chunk, 0);
+				}
+			}
+
+			/// <summary>
+			/// Generates a block of Q0.30 sine samples, advancing the phase once per sample.
+			/// </summary>
+			/// <param name="output">Signed Q-format fractions in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</param>
+			/// <param name="count">Number of samples.</param>
+			void Sine32Block(Fraction32::scalar_t* output, const size_t count)
+			{
+				angle_t angles[ChunkSize];
+				for (size_t i = 0; i < count; i += ChunkSize)
+				{
+					const uint8_t chunk = FillAngles(angles, count - i);
+					Sine16Batches::Batch(angles, &output[i], chunk, 0);
+				}
+			}
+
+			/// <summary>
+			/// Generates a block of Q0.14 quadrature (sine and cosine) samples in a single phase pass.
+			/// </summary>
+			/// <param name="sine">In-phase output, Sine16 of the phase.</param>
+			/// <param name="cosine">Quadrature output, Cosine16 of the phase.</param>
+			/// <param name="count">Number of samples.</param>
+			void Quadrature16Block(fraction16_t* sine, fraction16_t* cosine, const size_t count)
+			{
+				angle_t angles[ChunkSize];
+				for (size_t i = 0; i < count; i += ChunkSize)
+				{
+					const uint8_t chunk = FillAngles(angles, count - i);
+					Sine16Batches::Batch(angles, &sine[i], chunk, 0);
+					Sine16Batches::Batch(angles, &cosine[i], chunk, ANGLE_90);
+				}
+			}
+
+			/// <summary>
+			/// Generates a block of Q0.30 quadrature (sine and cosine) samples in a single phase pass.
+			/// </summary>
+			/// <param name="sine">In-phase output, Sine32 of the phase.</param>
+			/// <param name="cosine">Quadrature output, Cosine32 of the phase.</param>
+			/// <param name="count">Number of samples.</param>
+			void Quadrature32Block(Fraction32::scalar_t* sine, Fraction32::scalar_t* cosine, const size_t count)
+			{
+				angle_t angles[ChunkSize];
+				for (size_t i = 0; i < count; i += ChunkSize)
+				{
+					const uint8_t chunk = FillAngles(angles, count - i);
+					Sine16Batches::Batch(angles, &sine[i], chunk, 0);
+					Sine16Batches::Batch(angles, &cosine[i], chunk, ANGLE_90);
+				}
+			}
+
+		private:
+			/// <summary>
+			/// Fills up to ChunkSize truncated angles and advances the phase.
+			/// </summary>
+			/// <returns>Number of angles filled.</returns>
+			uint8_t FillAngles(angle_t* angles, const size_t remaining)
+			{
+				const uint8_t chunk = (remaining < ChunkSize) ? uint8_t(remaining) : ChunkSize;
+
+				phase_t phase = Phase;
+				for (uint8_t i = 0; i < chunk; i++)
+				{
+					angles[i] = angle_t(phase >> AngleShifts);
+					phase += TuningWord;
+				}
+				Phase = phase;
+
+				return chunk;
+			}
+		};
+	}
+}
+#endif
@@ -0,0 +1,242 @@
+#ifndef _INTEGER_TRIGONOMETRY_POLYNOMIAL_h
+#define _INTEGER_TRIGONOMETRY_POLYNOMIAL_h
+
+#include "Trigonometry.h"
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		/// <summary>
+		/// Table-free sine, cosine and tangent, with minimax polynomials of the quarter wave.
+		/// sin(z * 90 deg) ~= z * (A1 - z^2 * (B3 - z^2 * (B5 - ...))), z in [0 ; 1[.
+		/// The alternating series is evaluated in the nested form, every partial sum stays positive,
+		/// so Horner runs on unsigned fixed-point with a single rounding per step.
+		/// </summary>
+		namespace Polynomial
+		{
+			using namespace FixedPoint::ScalarFraction;
+
+			/// <summary>
+			/// Quarter wave sine, unrounded, for quarter angles in [0 ; ANGLE_90[.
+			/// </summary>
+			namespace Quarter
+			{
+				/// <summary>
+				/// Degree 3, Q.10 coefficients and z.
+				/// </summary>
+				/// <returns>sin in Q.20.</returns>
+				static uint32_t Sine8(const uint16_t angle)
+				{
+					static constexpr uint32_t A1 = 1581;
+					static constexpr uint32_t B3 = 556;
+
+					const uint32_t z = angle >> 4;
+					const uint32_t z2 = ((z * z) + (uint32_t(1) << 9)) >> 10;
+					const uint32_t p = A1 - (((B3 * z2) + (uint32_t(1) << 9)) >> 10);
+
+					return p * z;
+				}
+
+				/// <summary>
+				/// Degree 7, Q.16 coefficients and z^2, z in Q.15 for the last product.
+				/// </summary>
+				/// <returns>sin in Q.31.</returns>
+				static uint32_t Sine16(const uint16_t angle)
+				{
+					static constexpr uint32_t A1 = 102943;
+					static constexpr uint32_t B3 = 42329;
+					static constexpr uint32_t B5 = 5205;
+					static constexpr uint32_t B7 = 283;
+					static constexpr uint32_t Half = uint32_t(1) << 15;
+
+					const uint32_t z2 = (((uint32_t)angle * angle) + (uint32_t(1) << 11)) >> 12;
+
+					uint32_t p = B5 - (((B7 * z2) + Half) >> 16);
+					p = B3 - (((p * z2) + Half) >> 16);
+					p = A1 - (((p * z2) + Half) >> 16);
+
+					return p * ((uint32_t)angle << 1);
+				}
+
+				/// <summary>
+				/// Degree 11, Q.32 coefficients and z^2, z in Q.31 for the last product.
+				/// </summary>
+				/// <returns>sin in Q.63.</returns>
+				static uint64_t Sine32(const uint16_t angle)
+				{
+					static constexpr uint64_t A1 = 6746518851ULL;
+					static constexpr uint64_t B3 = 2774394650ULL;
+					static constexpr uint64_t B5 = 342277045ULL;
+					static constexpr uint64_t B7 = 20107377ULL;
+					static constexpr uint64_t B9 = 688096ULL;
+					static constexpr uint64_t B11 = 14669ULL;
+					static constexpr uint64_t Half = uint64_t(1) << 31;
+
+					const uint64_t z2 = ((uint64_t)angle * angle) << 4;
+
+					uint64_t p = B9 - (((B11 * z2) + Half) >> 32);
+					p = B7 - (((p * z2) + Half) >> 32);
+					p = B5 - (((p * z2) + Half) >> 32);
+					p = B3 - (((p * z2) + Half) >> 32);
+					p = A1 - (((p * z2) + Half) >> 32);
+
+					return p * ((uint64_t)angle << 17);
+				}
+
+				/// <summary>
+				/// Folds a full-turn angle into the quarter wave [0 ; ANGLE_90], sign is given by (angle & ANGLE_180).
+				/// </summary>
+				static uint16_t Fold(const angle_t angle)
+				{
+					const uint16_t halfAngle = angle & (ANGLE_180 - 1);
+					const uint16_t mirrorAngle = ANGLE_180 - halfAngle;
+
+					return (halfAngle < mirrorAngle) ? halfAngle : mirrorAngle;
+				}
+			}
+
+			/// <summary>
+			/// Table-free sine using fixed-point Q-format (8-bit signed fraction, Q0.6).
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction8::FRACTION_1X; +Fraction8::FRACTION_1X].</returns>
+			static Fraction8::scalar_t Sine8(const angle_t angle)
+			{
+				const uint16_t quarterAngle = Quarter::Fold(angle);
+				const Fraction8::scalar_t magnitude = (quarterAngle == ANGLE_90) ? Fraction8::FRACTION_1X
+					: Fraction8::scalar_t((Quarter::Sine8(quarterAngle) + (uint32_t(1) << 13)) >> 14);
+
+				return (angle & ANGLE_180) ? Fraction8::scalar_t(-magnitude) : magnitude;
+			}
+
+			/// <summary>
+			/// Table-free sine using fixed-point Q-format (16-bit signed fraction, Q0.14).
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</returns>
+			static fraction16_t Sine16(const angle_t angle)
+			{
+				const uint16_t quarterAngle = Quarter::Fold(angle);
+				const fraction16_t magnitude = (quarterAngle == ANGLE_90) ? Fraction16::FRACTION_1X
+					: fraction16_t((Quarter::Sine16(quarterAngle) + (uint32_t(1) << 16)) >> 17);
+
+				return (angle & ANGLE_180) ? fraction16_t(-magnitude) : magnitude;
+			}
+
+			/// <summary>
+			/// Table-free sine using fixed-point Q-format (32-bit signed fraction, Q0.30).
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</returns>
+			static Fraction32::scalar_t Sine32(const angle_t angle)
+			{
+				const uint16_t quarterAngle = Quarter::Fold(angle);
+				const Fraction32::scalar_t magnitude = (quarterAngle == ANGLE_90) ? Fraction32::FRACTION_1X
+					: Fraction32::scalar_t((Quarter::Sine32(quarterAngle) + (uint64_t(1) << 32)) >> 33);
+
+				return (angle & ANGLE_180) ? Fraction32::scalar_t(-magnitude) : magnitude;
+			}
+
+			/// <summary>
+			/// Table-free cosine via phase shift: cos(x) = sin(x + 90 deg).
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction8::FRACTION_1X; +Fraction8::FRACTION_1X].</returns>
+			static Fraction8::scalar_t Cosine8(const angle_t angle)
+			{
+				return Sine8(angle + ANGLE_90);
+			}
+
+			/// <summary>
+			/// Table-free cosine via phase shift: cos(x) = sin(x + 90 deg).
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</returns>
+			static fraction16_t Cosine16(const angle_t angle)
+			{
+				return Sine16(angle + ANGLE_90);
+			}
+
+			/// <summary>
+			/// Table-free cosine via phase shift: cos(x) = sin(x + 90 deg).
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</returns>
+			static Fraction32::scalar_t Cosine32(const angle_t angle)
+			{
+				return Sine32(angle + ANGLE_90);
+			}
+
+			/// <summary>
+			/// Table-free tangent (8-bit signed fraction, Q0.6), rounded sin / cos of the unrounded polynomials.
+			/// Saturates to the Fraction8::scalar_t range, |tan| below 2.
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [INT8_MIN + 1 ; INT8_MAX].</returns>
+			static Fraction8::scalar_t Tangent8(const angle_t angle)
+			{
+				// tan(x) = tan(x - 180 deg), tan(x) = -tan(180 deg - x)
+				const uint16_t halfAngle = angle & (ANGLE_180 - 1);
+				const uint16_t quarterAngle = (halfAngle <= ANGLE_90) ? halfAngle : (ANGLE_180 - halfAngle);
+				if (quarterAngle == 0)
+				{
+					return 0;
+				}
+
+				const uint32_t cosine = (quarterAngle == ANGLE_90) ? 0 : (Quarter::Sine8(ANGLE_90 - quarterAngle) >> 6);
+				const uint32_t tangent = (cosine == 0) ? INT8_MAX : ((Quarter::Sine8(quarterAngle) + (cosine >> 1)) / cosine);
+				const Fraction8::scalar_t magnitude = Fraction8::scalar_t((tangent > INT8_MAX) ? INT8_MAX : tangent);
+
+				return (halfAngle <= ANGLE_90) ? magnitude : Fraction8::scalar_t(-magnitude);
+			}
+
+			/// <summary>
+			/// Table-free tangent (16-bit signed fraction, Q0.14), rounded sin / cos of the unrounded polynomials.
+			/// Saturates to the fraction16_t range, |tan| below 2.
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [INT16_MIN + 1 ; INT16_MAX].</returns>
+			static fraction16_t Tangent16(const angle_t angle)
+			{
+				// tan(x) = tan(x - 180 deg), tan(x) = -tan(180 deg - x)
+				const uint16_t halfAngle = angle & (ANGLE_180 - 1);
+				const uint16_t quarterAngle = (halfAngle <= ANGLE_90) ? halfAngle : (ANGLE_180 - halfAngle);
+				if (quarterAngle == 0)
+				{
+					return 0;
+				}
+
+				const uint32_t cosine = (quarterAngle == ANGLE_90) ? 0 : (Quarter::Sine16(ANGLE_90 - quarterAngle) >> 14);
+				const uint32_t tangent = (cosine == 0) ? INT16_MAX : ((Quarter::Sine16(quarterAngle) + (cosine >> 1)) / cosine);
+				const fraction16_t magnitude = fraction16_t((tangent > INT16_MAX) ? INT16_MAX : tangent);
+
+				return (halfAngle <= ANGLE_90) ? magnitude : fraction16_t(-magnitude);
+			}
+
+			/// <summary>
+			/// Table-free tangent (32-bit signed fraction, Q0.30), rounded sin / cos of the unrounded polynomials.
+			/// Saturates to the Fraction32::scalar_t range, |tan| below 2.
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [INT32_MIN + 1 ; INT32_MAX].</returns>
+			static Fraction32::scalar_t Tangent32(const angle_t angle)
+			{
+				// tan(x) = tan(x - 180 deg), tan(x) = -tan(180 deg - x)
+				const uint16_t halfAngle = angle & (ANGLE_180 - 1);
+				const uint16_t quarterAngle = (halfAngle <= ANGLE_90) ? halfAngle : (ANGLE_180 - halfAngle);
+				if (quarterAngle == 0)
+				{
+					return 0;
+				}
+
+				const uint64_t cosine = (quarterAngle == ANGLE_90) ? 0 : (Quarter::Sine32(ANGLE_90 - quarterAngle) >> 30);
+				const uint64_t tangent = (cosine == 0) ? INT32_MAX : ((Quarter::Sine32(quarterAngle) + (cosine >> 1)) / cosine);
+				const Fraction32::scalar_t magnitude = Fraction32::scalar_t((tangent > INT32_MAX) ? INT32_MAX : tangent);
+
+				return (halfAngle <= ANGLE_90) ? magnitude : Fraction32::scalar_t(-magnitude);
+			}
+		}
+	}
+}
+#endif
@@ -0,0 +1,68 @@
+#ifndef _INTEGER_TRIGONOMETRY_ROTATE_h
+#define _INTEGER_TRIGONOMETRY_ROTATE_h
+
+#include "Sine16.h"
+#include "Sine32.h"
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace Rotations
+		{
+			/// <summary>
+			/// Q-format product sum to value_t, rounded half away from zero and saturated.
+			/// </summary>
+			template<typename value_t, typename accumulator_t, uint8_t shifts>
+			static value_t RoundSaturate(const accumulator_t value)
+			{
+				static constexpr accumulator_t Half = accumulator_t(1) << (shifts - 1);
+				static constexpr accumulator_t Max = TypeTraits::TypeLimits::type_limits<value_t>::Max();
+				static constexpr accumulator_t Min = TypeTraits::TypeLimits::type_limits<value_t>::Min();
+
+				const accumulator_t rounded = (value >= 0) ? ((value + Half) >> shifts) : -((-value + Half) >> shifts);
+
+				return value_t((rounded > Max) ? Max : ((rounded < Min) ? Min : rounded));
+			}
+		}
+
+		/// <summary>
+		/// Rotates the vector (x, y) by angle, with Q0.14 SineCosine16().
+		/// The result saturates to int16_t, a full-scale vector grows up to sqrt(2) on the diagonals.
+		/// </summary>
+		/// <param name="x">Vector x component, rotated in place.</param>
+		/// <param name="y">Vector y component, rotated in place.</param>
+		/// <param name="angle">Modular angle_t, counter-clockwise.</param>
+		static void Rotate(int16_t& x, int16_t& y, const angle_t angle)
+		{
+			fraction16_t sine, cosine;
+			SineCosine16(angle, sine, cosine);
+
+			const int32_t rotatedX = ((int32_t)x * cosine) - ((int32_t)y * sine);
+			const int32_t rotatedY = ((int32_t)x * sine) + ((int32_t)y * cosine);
+
+			x = Rotations::RoundSaturate<int16_t, int32_t, GetBitShifts(Fraction16::FRACTION_1X)>(rotatedX);
+			y = Rotations::RoundSaturate<int16_t, int32_t, GetBitShifts(Fraction16::FRACTION_1X)>(rotatedY);
+		}
+
+		/// <summary>
+		/// Rotates the vector (x, y) by angle, with Q0.30 SineCosine32().
+		/// The result saturates to int32_t, a full-scale vector grows up to sqrt(2) on the diagonals.
+		/// </summary>
+		/// <param name="x">Vector x component, rotated in place.</param>
+		/// <param name="y">Vector y component, rotated in place.</param>
+		/// <param name="angle">Modular angle_t, counter-clockwise.</param>
+		static void Rotate(int32_t& x, int32_t& y, const angle_t angle)
+		{
+			Fraction32::scalar_t sine, cosine;
+			SineCosine32(angle, sine, cosine);
+
+			const int64_t rotatedX = ((int64_t)x * cosine) - ((int64_t)y * sine);
+			const int64_t rotatedY = ((int64_t)x * sine) + ((int64_t)y * cosine);
+
+			x = Rotations::RoundSaturate<int32_t, int64_t, GetBitShifts(Fraction32::FRACTION_1X)>(rotatedX);
+			y = Rotations::RoundSaturate<int32_t, int64_t, GetBitShifts(Fraction32::FRACTION_1X)>(rotatedY);
+		}
+	}
+}
+#endif
@@ -53,6 +53,45 @@ namespace IntegerSignal
 		{
 			return Sine16(angle + ANGLE_90);
 		}
+
+		/// <summary>
+		/// Sine and cosine of the same angle (16-bit signed fraction, Q0.14), in one call.
+		/// One quadrant fold and one LUT index for both outputs.
+		/// Bit-exact with Sine16(angle) and Cosine16(angle).
+		/// </summary>
+		/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+		/// <param name="sine">Signed Q-format fraction in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</param>
+		/// <param name="cosine">Signed Q-format fraction in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</param>
+		static void SineCosine16(const angle_t angle, fraction16_t& sine, fraction16_t& cosine)
+		{
+			uint16_t lutSine, lutCosine;
+			Lut::Sine16::GetInterpolatedPair(angle & (ANGLE_90 - 1), lutSine, lutCosine);
+
+			// Zero crossings are exact, as in Sine16().
+			const fraction16_t a = (lutSine == 0) ? 0 : fraction16_t((static_cast<uint32_t>(lutSine) + 4) >> 2);
+			const fraction16_t b = fraction16_t((static_cast<uint32_t>(lutCosine) + 4) >> 2);
+
+			switch (angle >> GetBitShifts(ANGLE_90))
+			{
+			case 0:
+				sine = a;
+				cosine = b;
+				break;
+			case 1:
+				// sin(x + 90 deg) = cos(x), cos(x + 90 deg) = -sin(x)
+				sine = b;
+				cosine = -a;
+				break;
+			case 2:
+				sine = -a;
+				cosine = -b;
+				break;
+			default:
+				sine = -b;
+				cosine = a;
+				break;
+			}
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,332 @@
+#ifndef _INTEGER_TRIGONOMETRY_SINE16_BATCH_h
+#define _INTEGER_TRIGONOMETRY_SINE16_BATCH_h
+
+#include <stddef.h>
+#include "Sine16.h"
+#if (INTEGER_TRIGONOMETRY_SINE32 == INTEGER_TRIGONOMETRY_SINE32_HERMITE)
+#include "Lut/Sine32Lut.h"
+#endif
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <arm_neon.h>
+#elif defined(__SSE2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+#include <emmintrin.h>
+#endif
+
+namespace IntegerSignal
+{
+	namespace Trigonometry
+	{
+		namespace Sine16Batches
+		{
+			using namespace FixedPoint::ScalarFraction;
+
+			/// <summary>
+			/// Angle to LUT index shifts, for the quarter-wave [0 ; ANGLE_90] domain.
+			/// </summary>
+			static constexpr uint8_t IndexShifts = GetBitShifts(ANGLE_90) - GetBitShifts(Lut::Sine16::LutSize);
+
+			/// <summary>
+			/// Angle error mask within a LUT step.
+			/// </summary>
+			static constexpr uint16_t ErrorMask = (uint16_t(1) << IndexShifts) - 1;
+
+			/// <summary>
+			/// Last index that can be interpolated with its next neighbour.
+			/// </summary>
+			static constexpr uint16_t LastIndex = Lut::Sine16::LutSize - 2;
+
+			/// <summary>
+			/// Folds a full-turn angle into the quarter-wave [0 ; ANGLE_90] domain without branches.
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Quarter-wave angle [0 ; ANGLE_90], sign is given by (angle & ANGLE_180).</returns>
+			static uint16_t GetQuarterAngle(const angle_t angle)
+			{
+				// sin(x) = -sin(x - 180 deg)
+				const uint16_t halfAngle = angle & (ANGLE_180 - 1);
+
+				// sin(x) = sin(180 deg - x)
+				const uint16_t mirrorAngle = ANGLE_180 - halfAngle;
+
+				return (halfAngle < mirrorAngle) ? halfAngle : mirrorAngle;
+			}
+
+			/// <summary>
+			/// Branch-free equivalent of Lut::Sine16::GetInterpolated().
+			/// The LUT interpolation rounding is folded into a single add.
+			/// </summary>
+			/// <param name="quarterAngle">[0 ; ANGLE_90]</param>
+			/// <returns>Sine scale [0 ; UINT16_MAX].</returns>
+			static uint16_t GetInterpolated(const uint16_t quarterAngle)
+			{
+				const uint16_t index = quarterAngle >> IndexShifts;
+				const uint16_t clampedIndex = (index < LastIndex) ? index : LastIndex;
+				const uint16_t angleError = quarterAngle & ErrorMask;
+
+#if defined(ARDUINO_ARCH_AVR)
+				const uint16_t a = pgm_read_word(&Lut::Sine16::Table[clampedIndex]);
+				const uint16_t b = pgm_read_word(&Lut::Sine16::Table[clampedIndex + 1]);
+#else
+				const uint16_t a = Lut::Sine16::Table[clampedIndex];
+				const uint16_t b = Lut::Sine16::Table[clampedIndex + 1];
+#endif
+				// Ceiling interpolation within the LUT step, only when off the LUT grid.
+				const uint16_t interpolated = a + ((static_cast<uint32_t>(b - a) * angleError) >> IndexShifts) + (angleError != 0);
+
+				return (index <= LastIndex) ? interpolated : UINT16_MAX;
+			}
+
+			/// <summary>
+			/// Branch-free Sine16, bit-exact with Sine16() for all angles.
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</returns>
+			static fraction16_t Sine16Branchless(const angle_t angle)
+			{
+				const uint16_t quarterAngle = GetQuarterAngle(angle);
+
+				// Scale quarter-wave LUT to Q-format fraction (power-of-two unit), sin(0) = 0.
+				const fraction16_t magnitude = (quarterAngle != 0) ? fraction16_t((static_cast<uint32_t>(GetInterpolated(quarterAngle)) + 4) >> 2) : 0;
+
+				return (angle & ANGLE_180) ? fraction16_t(-magnitude) : magnitude;
+			}
+
+			/// <summary>
+			/// Branch-free Sine32, bit-exact with Sine32() for all angles.
+			/// </summary>
+			/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+			/// <returns>Signed Q-format fraction in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</returns>
+			static Fraction32::scalar_t Sine32Branchless(const angle_t angle)
+			{
+				const uint16_t quarterAngle = GetQuarterAngle(angle);
+
+#if (INTEGER_TRIGONOMETRY_SINE32 == INTEGER_TRIGONOMETRY_SINE32_HERMITE)
+				const Fraction32::scalar_t magnitude = Fraction32::scalar_t(Lut::Sine32::GetInterpolated(quarterAngle));
+#else
+				// Map 16-bit quarter-wave amplitude to Q0.30 range, sin(0) = 0.
+				const Fraction32::scalar_t magnitude = (quarterAngle != 0) ? Fraction32::scalar_t((static_cast<uint32_t>(GetInterpolated(quarterAngle)) + 3) << 14) : 0;
+#endif
+
+				return (angle & ANGLE_180) ? Fraction32::scalar_t(-magnitude) : magnitude;
+			}
+
+			/// <summary>
+			/// Batch kernel for a phase offset (0 for sine, ANGLE_90 for cosine).
+			/// </summary>
+			static void Batch(const angle_t* angles, fraction16_t* output, const size_t count, const angle_t offset)
+			{
+				size_t i = 0;
+
+#if defined(__AVX2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+				const __m256i offsets = _mm256_set1_epi32(offset);
+				const __m256i halfMask = _mm256_set1_epi32(ANGLE_180 - 1);
+				const __m256i half = _mm256_set1_epi32(ANGLE_180);
+				const __m256i lastIndex = _mm256_set1_epi32(LastIndex);
+				const __m256i errorMask = _mm256_set1_epi32(ErrorMask);
+				const __m256i lowMask = _mm256_set1_epi32(UINT16_MAX);
+				const __m256i one = _mm256_set1_epi32(1);
+				const __m256i rounding = _mm256_set1_epi32(4);
+				const __m256i zero = _mm256_setzero_si256();
+
+				const size_t vectorEnd = count - (count % 8);
+				for (; i < vectorEnd; i += 8)
+				{
+					const __m256i angle = _mm256_and_si256(_mm256_add_epi32(
+						_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&angles[i]))), offsets), lowMask);
+
+					const __m256i halfAngle = _mm256_and_si256(angle, halfMask);
+					const __m256i quarterAngle = _mm256_min_epi32(halfAngle, _mm256_sub_epi32(half, halfAngle));
+
+					const __m256i index = _mm256_srli_epi32(quarterAngle, IndexShifts);
+					const __m256i clampedIndex = _mm256_min_epi32(index, lastIndex);
+					const __m256i angleError = _mm256_and_si256(quarterAngle, errorMask);
+
+					// Single gather reads both neighbours: Table[i] in the low half, Table[i + 1] in the high half.
+					const __m256i pair = _mm256_i32gather_epi32(reinterpret_cast<const int*>(Lut::Sine16::Table), clampedIndex, 2);
+					const __m256i a = _mm256_and_si256(pair, lowMask);
+					const __m256i b = _mm256_srli_epi32(pair, 16);
+
+					// a + ((b - a) * error >> shifts) + (error != 0)
+					__m256i unit = _mm256_add_epi32(a, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(b, a), angleError), IndexShifts));
+					unit = _mm256_add_epi32(unit, _mm256_add_epi32(one, _mm256_cmpeq_epi32(angleError, zero)));
+					unit = _mm256_blendv_epi8(unit, lowMask, _mm256_cmpgt_epi32(index, lastIndex));
+
+					__m256i magnitude = _mm256_srli_epi32(_mm256_add_epi32(unit, rounding), 2);
+					magnitude = _mm256_andnot_si256(_mm256_cmpeq_epi32(quarterAngle, zero), magnitude);
+
+					const __m256i negative = _mm256_cmpeq_epi32(_mm256_and_si256(angle, half), half);
+					const __m256i result = _mm256_sub_epi32(_mm256_xor_si256(magnitude, negative), negative);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]),
+						_mm_packs_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1)));
+				}
+#elif defined(__ARM_NEON) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+				// 16 bit lanes, the table pairs are read per lane.
+				const uint16x8_t offsets = vdupq_n_u16(offset);
+				const uint16x8_t halfMask = vdupq_n_u16(ANGLE_180 - 1);
+				const uint16x8_t half = vdupq_n_u16(ANGLE_180);
+				const uint16x8_t lastIndex = vdupq_n_u16(LastIndex);
+				const uint16x8_t errorMask = vdupq_n_u16(ErrorMask);
+				const uint16x8_t one = vdupq_n_u16(1);
+				const uint16x8_t rounding = vdupq_n_u16(4);
+				const uint16x8_t zero = vdupq_n_u16(0);
+
+				uint16_t indexes[8];
+				uint16_t lower[8];
+				uint16_t upper[8];
+
+				const size_t vectorEnd = count - (count % 8);
+				for (; i < vectorEnd; i += 8)
+				{
+					const uint16x8_t angle = vaddq_u16(vld1q_u16(&angles[i]), offsets);
+
+					const uint16x8_t halfAngle = vandq_u16(angle, halfMask);
+					const uint16x8_t quarterAngle = vminq_u16(halfAngle, vsubq_u16(half, halfAngle));
+
+					const uint16x8_t index = vshrq_n_u16(quarterAngle, IndexShifts);
+					const uint16x8_t angleError = vandq_u16(quarterAngle, errorMask);
+
+					vst1q_u16(indexes, vminq_u16(index, lastIndex));
+					for (uint8_t k = 0; k < 8; k++)
+					{
+						Lut::Sine16::ReadPair(indexes[k], lower[k], upper[k]);
+					}
+					const uint16x8_t a = vld1q_u16(lower);
+					const uint16x8_t delta = vsubq_u16(vld1q_u16(upper), a);
+
+					// a + ((b - a) * error >> shifts) + (error != 0)
+					const uint16x8_t step = vcombine_u16(
+						vshrn_n_u32(vmull_u16(vget_low_u16(delta), vget_low_u16(angleError)), IndexShifts),
+						vshrn_n_u32(vmull_u16(vget_high_u16(delta), vget_high_u16(angleError)), IndexShifts));
+					uint16x8_t unit = vaddq_u16(vaddq_u16(a, step), vminq_u16(angleError, one));
+					unit = vorrq_u16(unit, vcgtq_u16(index, lastIndex));
+
+					// (unit + 4) >> 2, without overflowing the lane.
+					const uint16x8_t magnitude = vbicq_u16(vshrq_n_u16(vhaddq_u16(unit, rounding), 1), vceqq_u16(quarterAngle, zero));
+
+					const uint16x8_t negative = vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(angle), 15));
+					vst1q_s16(&output[i], vreinterpretq_s16_u16(vsubq_u16(veorq_u16(magnitude, negative), negative)));
+				}
+#elif defined(__SSE2__) && !defined(INTEGER_SIGNAL_DISABLE_ACCELERATION)
+				// 16 bit lanes, the table pairs are read per lane.
+				const __m128i offsets = _mm_set1_epi16(int16_t(offset));
+				const __m128i halfMask = _mm_set1_epi16(ANGLE_180 - 1);
+				const __m128i half = _mm_set1_epi16(int16_t(ANGLE_180));
+				const __m128i lastIndex = _mm_set1_epi16(LastIndex);
+				const __m128i errorMask = _mm_set1_epi16(ErrorMask);
+				const __m128i one = _mm_set1_epi16(1);
+				const __m128i rounding = _mm_set1_epi16(2);
+				const __m128i zero = _mm_setzero_si128();
+
+				uint16_t indexes[8];
+				uint16_t lower[8];
+				uint16_t upper[8];
+
+				const size_t vectorEnd = count - (count % 8);
+				for (; i < vectorEnd; i += 8)
+				{
+					const __m128i angle = _mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&angles[i])), offsets);
+
+					// Unsigned minimum as a signed one with flipped sign bits, the mirrored angle reaches ANGLE_180.
+					const __m128i halfAngle = _mm_and_si128(angle, halfMask);
+					const __m128i quarterAngle = _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(halfAngle, half),
+						_mm_xor_si128(_mm_sub_epi16(half, halfAngle), half)), half);
+
+					const __m128i index = _mm_srli_epi16(quarterAngle, IndexShifts);
+					const __m128i angleError = _mm_and_si128(quarterAngle, errorMask);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(indexes), _mm_min_epi16(index, lastIndex));
+					for (uint8_t k = 0; k < 8; k++)
+					{
+						Lut::Sine16::ReadPair(indexes[k], lower[k], upper[k]);
+					}
+					const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lower));
+					const __m128i delta = _mm_sub_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(upper)), a);
+
+					// a + ((b - a) * error >> shifts) + (error != 0), from the 32 bit product halves.
+					const __m128i step = _mm_or_si128(_mm_srli_epi16(_mm_mullo_epi16(delta, angleError), IndexShifts),
+						_mm_slli_epi16(_mm_mulhi_epu16(delta, angleError), 16 - IndexShifts));
+					__m128i unit = _mm_add_epi16(_mm_add_epi16(a, step), _mm_min_epi16(angleError, one));
+					unit = _mm_or_si128(unit, _mm_cmpgt_epi16(index, lastIndex));
+
+					// (unit + 4) >> 2, without overflowing the lane.
+					const __m128i magnitude = _mm_andnot_si128(_mm_cmpeq_epi16(quarterAngle, zero),
+						_mm_srli_epi16(_mm_add_epi16(_mm_srli_epi16(unit, 1), rounding), 1));
+
+					const __m128i negative = _mm_srai_epi16(angle, 15);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]), _mm_sub_epi16(_mm_xor_si128(magnitude, negative), negative));
+				}
+#endif
+				for (; i < count; i++)
+				{
+					output[i] = Sine16Branchless(angle_t(angles[i] + offset));
+				}
+			}
+
+			/// <summary>
+			/// Q0.30 batch kernel for a phase offset (0 for sine, ANGLE_90 for cosine).
+			/// </summary>
+			static void Batch(const angle_t* angles, Fraction32::scalar_t* output, const size_t count, const angle_t offset)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					output[i] = Sine32Branchless(angle_t(angles[i] + offset));
+				}
+			}
+		}
+
+		/// <summary>
+		/// Batch Sine using fixed-point Q-format (16-bit signed fraction, Q0.14).
+		/// Bit-exact with Sine16() for every angle.
+		/// Uses branch-free quadrant folding and, on AVX2 targets, vectorized LUT gather and interpolation.
+		/// SSE2 and NEON targets fold and interpolate in 16 bit lanes, with per-lane table reads.
+		/// </summary>
+		/// <param name="angles">Modular angles in [0; ANGLE_RANGE].</param>
+		/// <param name="output">Signed Q-format fractions in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</param>
+		/// <param name="count">Number of angles.</param>
+		static void Sine16Batch(const angle_t* angles, fraction16_t* output, const size_t count)
+		{
+			Sine16Batches::Batch(angles, output, count, 0);
+		}
+
+		/// <summary>
+		/// Batch Cosine via phase shift: cos(x) = sin(x + 90 deg).
+		/// Bit-exact with Cosine16() for every angle.
+		/// </summary>
+		/// <param name="angles">Modular angles in [0; ANGLE_RANGE].</param>
+		/// <param name="output">Signed Q-format fractions in [-Fraction16::FRACTION_1X; +Fraction16::FRACTION_1X].</param>
+		/// <param name="count">Number of angles.</param>
+		static void Cosine16Batch(const angle_t* angles, fraction16_t* output, const size_t count)
+		{
+			Sine16Batches::Batch(angles, output, count, ANGLE_90);
+		}
+
+		/// <summary>
+		/// Batch Sine using fixed-point Q-format (32-bit signed fraction, Q0.30).
+		/// Bit-exact with Sine32() for every angle.
+		/// </summary>
+		/// <param name="angles">Modular angles in [0; ANGLE_RANGE].</param>
+		/// <param name="output">Signed Q-format fractions in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</param>
+		/// <param name="count">Number of angles.</param>
+		static void Sine32Batch(const angle_t* angles, Fraction32::scalar_t* output, const size_t count)
+		{
+			Sine16Batches::Batch(angles, output, count, 0);
+		}
+
+		/// <summary>
+		/// Batch Cosine via phase shift: cos(x) = sin(x + 90 deg).
+		/// Bit-exact with Cosine32() for every angle.
+		/// </summary>
+		/// <param name="angles">Modular angles in [0; ANGLE_RANGE].</param>
+		/// <param name="output">Signed Q-format fractions in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</param>
+		/// <param name="count">Number of angles.</param>
+		static void Cosine32Batch(const angle_t* angles, Fraction32::scalar_t* output, const size_t count)
+		{
+			Sine16Batches::Batch(angles, output, count, ANGLE_90);
+		}
+	}
+}
+#endif
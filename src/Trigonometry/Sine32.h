@@ -3,6 +3,10 @@
 
 #include "Lut/Sine16Lut.h"
 
+#if (INTEGER_TRIGONOMETRY_SINE32 == INTEGER_TRIGONOMETRY_SINE32_HERMITE)
+#include "Lut/Sine32Lut.h"
+#endif
+
 namespace IntegerSignal
 {
 	namespace Trigonometry
@@ -37,8 +41,12 @@ namespace IntegerSignal
 			}
 			else
 			{
+#if (INTEGER_TRIGONOMETRY_SINE32 == INTEGER_TRIGONOMETRY_SINE32_HERMITE)
+				return Lut::Sine32::GetInterpolated(angle);
+#else
 				// Map 16-bit quarter-wave amplitude to Q0.30 range
 				return (static_cast<uint32_t>(Lut::Sine16::GetInterpolated(angle)) + 3) << 14;
+#endif
 			}
 		}
 
@@ -53,6 +61,53 @@ namespace IntegerSignal
 		{
 			return Sine32(angle + ANGLE_90);
 		}
+
+		/// <summary>
+		/// Sine and cosine of the same angle (32-bit signed fraction, Q0.30), in one call.
+		/// One quadrant fold and one LUT index for both outputs.
+		/// Bit-exact with Sine32(angle) and Cosine32(angle).
+		/// </summary>
+		/// <param name="angle">Modular angle_t in [0; ANGLE_RANGE].</param>
+		/// <param name="sine">Signed Q-format fraction in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</param>
+		/// <param name="cosine">Signed Q-format fraction in [-Fraction32::FRACTION_1X; +Fraction32::FRACTION_1X].</param>
+		static void SineCosine32(const angle_t angle, Fraction32::scalar_t& sine, Fraction32::scalar_t& cosine)
+		{
+#if (INTEGER_TRIGONOMETRY_SINE32 == INTEGER_TRIGONOMETRY_SINE32_HERMITE)
+			uint32_t lutSine, lutCosine;
+			Lut::Sine32::GetInterpolatedPair(angle & (ANGLE_90 - 1), lutSine, lutCosine);
+
+			const Fraction32::scalar_t a = Fraction32::scalar_t(lutSine);
+			const Fraction32::scalar_t b = Fraction32::scalar_t(lutCosine);
+#else
+			uint16_t lutSine, lutCosine;
+			Lut::Sine16::GetInterpolatedPair(angle & (ANGLE_90 - 1), lutSine, lutCosine);
+
+			// Zero crossings are exact, as in Sine32().
+			const Fraction32::scalar_t a = (lutSine == 0) ? 0 : Fraction32::scalar_t((static_cast<uint32_t>(lutSine) + 3) << 14);
+			const Fraction32::scalar_t b = Fraction32::scalar_t((static_cast<uint32_t>(lutCosine) + 3) << 14);
+#endif
+
+			switch (angle >> GetBitShifts(ANGLE_90))
+			{
+			case 0:
+				sine = a;
+				cosine = b;
+				break;
+			case 1:
+				// sin(x + 90 deg) = cos(x), cos(x + 90 deg) = -sin(x)
+				sine = b;
+				cosine = -a;
+				break;
+			case 2:
+				sine = -a;
+				cosine = -b;
+				break;
+			default:
+				sine = -b;
+				cosine = a;
+				break;
+			}
+		}
 	}
 }
 #endif
\ No newline at end of file
@@ -9,11 +9,36 @@
 // Define INTEGER_TRIGONOMETRY_LUT as INTEGER_TRIGONOMETRY_LUT_DEFAULT to use the 256 items LUT.
 #define INTEGER_TRIGONOMETRY_LUT_DEFAULT 2
 
+// Define INTEGER_TRIGONOMETRY_LUT as INTEGER_TRIGONOMETRY_LUT_GENERATED to use a compile-time generated LUT,
+// with INTEGER_TRIGONOMETRY_LUT_SIZE items (power of two in [64 ; 8192]).
+#define INTEGER_TRIGONOMETRY_LUT_GENERATED 3
+
+// Define INTEGER_TRIGONOMETRY_ARC_SINE_LUT to use a direct inverse LUT for ArcSine16 and ArcCosine16,
+// instead of the inverse search in the Sine16 LUT.
+
 // No LUT size defined, use default.
 #if !defined(INTEGER_TRIGONOMETRY_LUT)
 #define INTEGER_TRIGONOMETRY_LUT INTEGER_TRIGONOMETRY_LUT_DEFAULT
 #endif
 
+// No generated LUT size defined, use 1024 items.
+#if !defined(INTEGER_TRIGONOMETRY_LUT_SIZE)
+#define INTEGER_TRIGONOMETRY_LUT_SIZE 1024
+#endif
+
+// Define INTEGER_TRIGONOMETRY_SINE32 as INTEGER_TRIGONOMETRY_SINE32_LINEAR to use the linear interpolated Sine16 LUT
+// for Sine32 (16-bit precision).
+#define INTEGER_TRIGONOMETRY_SINE32_LINEAR 1
+
+// Define INTEGER_TRIGONOMETRY_SINE32 as INTEGER_TRIGONOMETRY_SINE32_HERMITE to use cubic Hermite interpolation
+// on a compile-time generated Q0.30 LUT for Sine32 (near 30-bit precision).
+#define INTEGER_TRIGONOMETRY_SINE32_HERMITE 2
+
+// No Sine32 interpolation defined, use linear.
+#if !defined(INTEGER_TRIGONOMETRY_SINE32)
+#define INTEGER_TRIGONOMETRY_SINE32 INTEGER_TRIGONOMETRY_SINE32_LINEAR
+#endif
+
 namespace IntegerSignal
 {
 	namespace Trigonometry